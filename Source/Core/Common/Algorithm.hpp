@@ -343,6 +343,60 @@ void Sort(range r, Comparer comparer)
   QuickSort(r.Begin(), r.End(), &r.Front(), comparer);
 }
 
+// Stable least significant digit radix sort on an unsigned integer key, one byte
+// per pass. The scratch buffer must hold count elements. Passes where every key has
+// the same byte are skipped, so keys that only use some of their bits stay cheap.
+template <typename type, typename KeyGetter>
+void RadixSort(type* data, type* scratch, size_t count, KeyGetter getKey)
+{
+  typedef decltype(getKey(*data)) keyType;
+  const size_t cPassCount = sizeof(keyType);
+
+  if (count < 2)
+    return;
+
+  // Histogram every pass in a single read of the data
+  size_t counts[cPassCount][256] = {};
+  for (size_t i = 0; i < count; ++i)
+  {
+    keyType key = getKey(data[i]);
+    for (size_t pass = 0; pass < cPassCount; ++pass)
+      ++counts[pass][(key >> (pass * 8)) & 0xFF];
+  }
+
+  type* source = data;
+  type* dest = scratch;
+  for (size_t pass = 0; pass < cPassCount; ++pass)
+  {
+    size_t shift = pass * 8;
+    size_t* offsets = counts[pass];
+
+    // Every element would stay where it is
+    if (offsets[(getKey(*source) >> shift) & 0xFF] == count)
+      continue;
+
+    size_t offset = 0;
+    for (size_t digit = 0; digit < 256; ++digit)
+    {
+      size_t digitCount = offsets[digit];
+      offsets[digit] = offset;
+      offset += digitCount;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+      dest[offsets[(getKey(source[i]) >> shift) & 0xFF]++] = source[i];
+
+    Plasma::Swap(source, dest);
+  }
+
+  // Odd number of passes run, the result is in the scratch buffer
+  if (source != data)
+  {
+    for (size_t i = 0; i < count; ++i)
+      data[i] = source[i];
+  }
+}
+
 template <typename iterator>
 void Reverse(iterator start, iterator end)
 {
@@ -196,7 +196,12 @@ namespace Math
 
 // Currently the SIMD extensions are not technically platform agnostic and need
 // to be revisited. It may be acceptable to include the intrinsic headers on
-// multiple platforms, but it's unknown.
+// multiple platforms, but it's unknown. They're used whenever the compiler
+// targets at least SSE2 (every x64 target does).
+#if !defined(USESSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define USESSE
+#endif
+
 #if defined(USESSE)
 #  include /**/ "SimMath.hpp"
 #  include /**/ "SimVectors.hpp"
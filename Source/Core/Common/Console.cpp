@@ -31,6 +31,8 @@ void StdOutListener::Print(FilterType filterType, cstr message)
 }
 
 Array<ConsoleListener*> ConsoleListeners;
+// Listeners are only given one message at a time (work on job threads prints)
+ThreadLock ConsolePrintLock;
 
 void Console::PrintVa(Filter::Enum filter, cstr format, va_list args)
 {
@@ -57,8 +59,10 @@ void Console::Print(Filter::Enum filter, cstr format, ...)
 
 void Console::PrintRaw(Filter::Enum filter, cstr messageBuffer)
 {
+  ConsolePrintLock.Lock();
   forRange (ConsoleListener* listener, ConsoleListeners.All())
     listener->Print(filter, messageBuffer);
+  ConsolePrintLock.Unlock();
 }
 
 void Console::FlushAll()
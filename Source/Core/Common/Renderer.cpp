@@ -11,6 +11,7 @@ StringParam GetCoreVertexFragmentName(CoreVertexType::Enum type)
   static String cMesh("MeshVertex");
   static String cSkinnedMesh("SkinnedMeshVertex");
   static String cStreamed("StreamedVertex");
+  static String cInstancedMesh("InstancedMeshVertex");
 
   switch (type)
   {
@@ -20,6 +21,8 @@ StringParam GetCoreVertexFragmentName(CoreVertexType::Enum type)
     return cSkinnedMesh;
   case CoreVertexType::Streamed:
     return cStreamed;
+  case CoreVertexType::InstancedMesh:
+    return cInstancedMesh;
   case CoreVertexType::Count:
     break;
   }
@@ -32,6 +35,7 @@ GraphicsDriverSupport::GraphicsDriverSupport() :
     mTextureCompression(false),
     mMultiTargetBlend(false),
     mSamplerObjects(false),
+    mInstancing(false),
     mIntel(false)
 {
 }
@@ -1364,10 +1368,93 @@ void RenderQueues::Clear()
 
   mSkinningBuffer.Clear();
   mIndexRemapBuffer.Clear();
+  mInstanceTransforms.Clear();
 
   mBlendSettingsOverrides.Clear();
 }
 
+// Only plain static meshes can be drawn as instances, anything with per object
+// shader inputs, blend overrides, or skinning needs its own draw. Materials whose
+// fragments read per object built-ins (ObjectWorldPosition, LocalToView, etc.)
+// would only see the first object's values, so they are drawn on their own too.
+static bool CanInstance(FrameNode& frameNode)
+{
+  return frameNode.mRenderingType == RenderingType::Static && frameNode.mCoreVertexType == CoreVertexType::Mesh &&
+         frameNode.mMeshRenderData != nullptr && frameNode.mMaterialRenderData != nullptr &&
+         frameNode.mMaterialRenderData->mReadsPerObjectInputs == false && frameNode.mShaderInputRange.Count() == 0 &&
+         frameNode.mBlendSettingsOverride == false;
+}
+
+static bool CanInstanceTogether(ViewNode& viewNodeA, FrameNode& frameNodeA, ViewNode& viewNodeB, FrameNode& frameNodeB)
+{
+  return viewNodeA.mRenderGroupId == viewNodeB.mRenderGroupId &&
+         frameNodeA.mMeshRenderData == frameNodeB.mMeshRenderData &&
+         frameNodeA.mMaterialRenderData == frameNodeB.mMaterialRenderData &&
+         frameNodeA.mTextureRenderData == frameNodeB.mTextureRenderData && CanInstance(frameNodeB);
+}
+
+uint RenderQueues::BuildInstanceBatches(ViewBlock& viewBlock, FrameBlock& frameBlock)
+{
+  Array<ViewNode>& viewNodes = viewBlock.mViewNodes;
+  Array<FrameNode>& frameNodes = frameBlock.mFrameNodes;
+
+  // Nodes are compacted in place, every RenderGroup range is shifted down by the
+  // nodes removed before it. Runs never cross a range so tasks still see their objects.
+  uint writeIndex = 0;
+  for (uint groupIndex = 0; groupIndex < viewBlock.mRenderGroupRanges.Size(); ++groupIndex)
+  {
+    IndexRange& range = viewBlock.mRenderGroupRanges[groupIndex];
+    uint readIndex = range.start;
+    range.start = writeIndex;
+
+    // The RenderPass is part of the shader too, not only the Material
+    bool canInstanceGroup = groupIndex >= viewBlock.mRenderGroupReadsPerObjectInputs.Size() ||
+                            viewBlock.mRenderGroupReadsPerObjectInputs[groupIndex] == false;
+
+    while (readIndex < range.end)
+    {
+      ViewNode& first = viewNodes[readIndex];
+      FrameNode& firstFrameNode = frameNodes[first.mFrameNodeIndex];
+
+      uint runEnd = readIndex + 1;
+      if (canInstanceGroup && CanInstance(firstFrameNode))
+      {
+        while (runEnd < range.end && runEnd - readIndex < cMaxInstancesPerBatch)
+        {
+          ViewNode& next = viewNodes[runEnd];
+          if (!CanInstanceTogether(first, firstFrameNode, next, frameNodes[next.mFrameNodeIndex]))
+            break;
+          ++runEnd;
+        }
+      }
+
+      // A single object is cheaper to draw the normal way.
+      if (runEnd - readIndex > 1)
+      {
+        first.mInstanceRange.start = mInstanceTransforms.Size();
+        for (uint i = readIndex; i < runEnd; ++i)
+        {
+          ViewNode& instance = viewNodes[i];
+          mInstanceTransforms.PushBack(instance.mLocalToView);
+          mInstanceTransforms.PushBack(Math::BuildTransform(Vec3::cZero, instance.mLocalToViewNormal, Vec3(1.0f)));
+        }
+        first.mInstanceRange.end = mInstanceTransforms.Size();
+      }
+
+      if (writeIndex != readIndex)
+        viewNodes[writeIndex] = first;
+      ++writeIndex;
+      readIndex = runEnd;
+    }
+
+    range.end = writeIndex;
+  }
+
+  uint removedCount = viewNodes.Size() - writeIndex;
+  viewNodes.Resize(writeIndex);
+  return removedCount;
+}
+
 void RenderQueues::AddStreamedLineRect(
     ViewNode& viewNode, Vec3 pos0, Vec3 pos1, Vec2 uv0, Vec2 uv1, Vec4 color, Vec2 uvAux0, Vec2 uvAux1)
 {
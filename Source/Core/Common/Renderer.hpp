@@ -8,6 +8,8 @@ namespace Plasma
     // destroy it)
     class Renderer;
     Renderer* CreateRendererOpenGL(OsHandle windowHandle, String& error);
+    // Headless renderer that only records statistics, see NullRenderer.
+    Renderer* CreateRendererNull(OsHandle windowHandle, String& error);
 
     extern const String cPostVertex;
     StringParam GetCoreVertexFragmentName(CoreVertexType::Enum type);
@@ -18,6 +20,8 @@ namespace Plasma
     public:
         String mCompositeName;
         u64 mResourceId;
+        // Reads built-ins that are set per object, cannot be instanced
+        bool mReadsPerObjectInputs;
     };
 
     class MeshRenderData
@@ -46,6 +50,9 @@ namespace Plasma
         /// If texture sampler settings can be uniquely specified per sampler shader
         /// input.
         bool mSamplerObjects;
+        /// If consecutive draws of the same mesh and material can be submitted as one
+        /// instanced draw (see RenderQueues::BuildInstanceBatches).
+        bool mInstancing;
 
         // For detecting Intel drivers to handle driver bugs.
         bool mIntel;
@@ -373,6 +380,7 @@ namespace Plasma
         MaterialRenderData* mRenderData;
         String mCompositeName;
         u64 mMaterialId;
+        bool mReadsPerObjectInputs;
     };
 
     class AddMeshInfo
@@ -737,6 +745,10 @@ namespace Plasma
         PrimitiveType::Enum mStreamedVertexType;
         uint mStreamedVertexStart;
         uint mStreamedVertexCount;
+
+        // Range in RenderQueues::mInstanceTransforms when this node draws an instance batch,
+        // empty otherwise. Every instance has cInstanceTransformStride matrices.
+        IndexRange mInstanceRange = IndexRange(0, 0);
     };
 
     class FrameBlock
@@ -755,6 +767,9 @@ namespace Plasma
     public:
         Array<ViewNode> mViewNodes;
         Array<IndexRange> mRenderGroupRanges;
+        // Parallel to mRenderGroupRanges, set for RenderGroups drawn by a RenderPass
+        // that reads per object built-ins. Those are never instanced.
+        Array<bool> mRenderGroupReadsPerObjectInputs;
 
         // View transforms
         Mat4 mWorldToView;
@@ -778,11 +793,23 @@ namespace Plasma
         u64 mCameraId;
     };
 
+    // Matrices per instance in RenderQueues::mInstanceTransforms (LocalToView and LocalToViewNormal).
+    const uint cInstanceTransformStride = 2;
+    // Limited by the size of the InstanceTransforms array in the InstancedMeshVertex fragment.
+    const uint cMaxInstancesPerBatch = 40;
+
     class RenderQueues
     {
     public:
         void Clear();
 
+        /// Collapses runs of consecutive ViewNodes that draw the same mesh, material, and
+        /// texture without per object shader inputs into a single node that draws every
+        /// object as an instance. Compacts the ViewBlock's nodes and RenderGroup ranges,
+        /// so it must be called after all view data has been extracted. Per instance
+        /// transforms are packed into mInstanceTransforms. Returns the number of removed nodes.
+        uint BuildInstanceBatches(ViewBlock& viewBlock, FrameBlock& frameBlock);
+
         void AddStreamedLineRect(ViewNode& viewNode,
                                  Vec3 pos0,
                                  Vec3 pos1,
@@ -828,6 +855,7 @@ namespace Plasma
         uint mSkinningBufferVersion;
         Array<Mat4> mSkinningBuffer;
         Array<uint> mIndexRemapBuffer;
+        Array<Mat4> mInstanceTransforms;
 
         // temporary, needed for viewport blending
         Array<BlendSettings> mBlendSettingsOverrides;
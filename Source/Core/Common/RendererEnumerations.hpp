@@ -48,12 +48,12 @@ DeclareEnum11(BlendFactor,
 /// use separate equations.</param>
 DeclareEnum3(BlendMode, Disabled, Enabled, Separate);
 
-DeclareEnum4(CoreVertexType, Mesh, SkinnedMesh, Streamed, Count);
+DeclareEnum5(CoreVertexType, Mesh, SkinnedMesh, Streamed, InstancedMesh, Count);
 
 // Used to control the active renderer used by the engine. Must be changed prior to renderer creation
 // <param name="OpenGL"> The OpenGL 3 Renderer </param>
 // <param name="Vulkan"> The Vulkan Renderer </param>
-DeclareEnum2(RenderAPI, OpenGL, Vulkan);
+DeclareEnum3(RenderAPI, OpenGL, Vulkan, Null);
 
 /// How triangles should be culled (not rendered) depending on which way they
 /// face. <param name="Disabled">Triangles are always rendered.</param> <param
@@ -0,0 +1,32 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+#if defined(USESSE)
+
+namespace Math
+{
+
+namespace Simd
+{
+
+const SimVec gSimOne = Set(1.0f);
+const SimVec gSimOneVec3 = Set4(1.0f, 1.0f, 1.0f, 0.0f);
+const SimVec gSimPlasma = ZeroOutVec();
+const SimVec gSimNegativeOne = Set(-1.0f);
+const SimVec gSimOneHalf = Set(0.5f);
+const SimVec gSimVec3Mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+const SimVec gSimFullMask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+const SimVec gSimBasisX = Set4(1.0f, 0.0f, 0.0f, 0.0f);
+const SimVec gSimBasisY = Set4(0.0f, 1.0f, 0.0f, 0.0f);
+const SimVec gSimBasisZ = Set4(0.0f, 0.0f, 1.0f, 0.0f);
+const SimVec gSimBasisW = Set4(0.0f, 0.0f, 0.0f, 1.0f);
+const SimVec gSimMaskX = _mm_castsi128_ps(_mm_set_epi32(0, 0, 0, -1));
+const SimVec gSimMaskY = _mm_castsi128_ps(_mm_set_epi32(0, 0, -1, 0));
+const SimVec gSimMaskZ = _mm_castsi128_ps(_mm_set_epi32(0, -1, 0, 0));
+const SimVec gSimMaskW = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+} // namespace Simd
+
+} // namespace Math
+
+#endif
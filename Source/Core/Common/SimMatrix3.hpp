@@ -53,4 +53,4 @@ SimMat3 Equal(SimMat3Param mat1, SimMat3Param mat2);
 
 } // namespace Math
 
-#include "Math/SimMatrix3.inl"
+#include "SimMatrix3.inl"
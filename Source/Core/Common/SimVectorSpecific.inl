@@ -37,7 +37,7 @@ SimInline SimVec Set4(scalar x, scalar y, scalar z, scalar w)
 
 SimInline SimVec ZeroOutVec()
 {
-  return _mm_setplasma_ps();
+  return _mm_setzero_ps();
 }
 
 SimInline SimVec Add(SimVecParam lhs, SimVecParam rhs)
@@ -77,6 +77,9 @@ PlasmaShared unsigned int GetDoubleClickTimeMs();
 // Get the memory status of the Os.
 PlasmaShared void GetMemoryStatus(MemoryInfo& memoryInfo);
 
+// Get the number of logical processors available to this process (always at least 1).
+PlasmaShared uint GetProcessorCount();
+
 // Get an Environmental variable
 PlasmaShared String GetEnvironmentalVariable(StringParam variable);
 
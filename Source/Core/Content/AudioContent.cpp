@@ -76,16 +76,16 @@ void SoundBuilder::BuildContent(BuildOptions& options)
   // Create the AudioFile object and open the source file
   AudioFileData audioFile = AudioFileEncoder::OpenFile(status, sourceFile);
 
+  // Encode the file and write it out to disk
   if (status.Succeeded())
-  {
-    // Encode the file and write it out to disk
     AudioFileEncoder::WriteFile(status, destFile, audioFile, mNormalize, mMaxVolume);
 
-    if (status.Failed())
-      DoNotifyWarning("Error Processing Audio File", status.Message);
+  // Reported through the build options as sounds are built on worker threads
+  if (status.Failed())
+  {
+    options.Failure = true;
+    options.Message = String::Format("Error processing audio file '%s': %s", sourceFile.c_str(), status.Message.c_str());
   }
-  else
-    DoNotifyWarning("Error Processing Audio File", status.Message);
 }
 
 bool SoundBuilder::NeedsBuilding(BuildOptions& options)
@@ -35,6 +35,10 @@ public:
   bool NeedsBuilding(BuildOptions& options) override;
   void BuildListing(ResourceListing& listing) override;
   void Generate(ContentInitializer& initializer) override;
+  bool IsBuildThreadSafe() override
+  {
+    return true;
+  }
 
   String GetResourceOwner() override
   {
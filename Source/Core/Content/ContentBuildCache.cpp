@@ -0,0 +1,182 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+// Must be incremented whenever the key or stored layout changes
+static const uint cContentBuildCacheVersion = 1;
+// Lists the outputs of an entry (entries without it are deleted)
+static const String cManifestFileName("Outputs.txt");
+// The least recently used entries are deleted when the directory grows past this
+static const u64 cMaxCacheSize = (u64)2 * 1024 * 1024 * 1024;
+
+String ContentBuildCache::sDirectory;
+
+// Appends the contents of the file to the hash, returns false if it can't be read
+static bool AppendFile(Sha1Builder& builder, StringParam fileName)
+{
+  File file;
+  if (!file.Open(fileName, FileMode::Read, FileAccessPattern::Sequential))
+    return false;
+
+  // Hash the size first so the bytes of one file can't shift into the next
+  builder.Append(String::Format("%llu\n", (unsigned long long)file.Size()));
+  return builder.Append(file);
+}
+
+void ContentBuildCache::SetDirectory(StringParam directory)
+{
+  sDirectory = directory;
+  if (!sDirectory.Empty())
+    DiskCache::TrimDirectory(sDirectory, cMaxCacheSize);
+}
+
+String ContentBuildCache::GetDirectory()
+{
+  return sDirectory;
+}
+
+ContentBuildCacheResult::Enum ContentBuildCache::Build(ContentItem* item, BuildOptions& options)
+{
+  // Items that build through engine state may depend on more than their files
+  ContentComposition* composition = Type::DynamicCast<ContentComposition*>(item);
+  if (sDirectory.Empty() || composition == nullptr || !composition->IsBuildThreadSafe() ||
+      !composition->AnyNeedsBuilding(options))
+  {
+    item->BuildContentItem(options);
+    return ContentBuildCacheResult::NotCached;
+  }
+
+  ZoneScoped;
+
+  String key = GetKey(composition, options);
+  if (key.Empty())
+  {
+    item->BuildContentItem(options);
+    return ContentBuildCacheResult::NotCached;
+  }
+
+  if (Restore(key, options))
+    return ContentBuildCacheResult::Hit;
+
+  item->BuildContentItem(options);
+
+  // Importers may rewrite the meta file while building (which changes the
+  // outputs the item lists), so only store outputs built from the hashed files
+  if (!options.Failure && GetKey(composition, options) == key)
+    Store(key, composition, options);
+
+  return ContentBuildCacheResult::Miss;
+}
+
+String ContentBuildCache::GetKey(ContentComposition* item, BuildOptions& options)
+{
+  Sha1Builder builder;
+
+  // Outputs change with the code that builds them
+  builder.Append(String::Format("%u %s\n", cContentBuildCacheVersion, LightningVirtualTypeId(item)->Name.c_str()));
+  forRange (BuilderComponent* bc, item->Builders.All())
+    builder.Append(String::Format("%s %u\n", LightningVirtualTypeId(bc)->Name.c_str(), bc->GetBuildVersion()));
+
+  // The meta file holds the options of every builder
+  String sourceFile = FilePath::Combine(options.SourcePath, item->Filename);
+  String metaFile = BuildString(sourceFile, ".meta");
+  if (!AppendFile(builder, metaFile) || !AppendFile(builder, sourceFile))
+    return String();
+
+  return builder.OutputHashString();
+}
+
+bool ContentBuildCache::Restore(StringParam key, BuildOptions& options)
+{
+  String entryPath = GetEntryPath(key);
+  if (!DirectoryExists(entryPath))
+    return false;
+
+  // Entries are moved into place with their manifest, so one without it was
+  // left behind by an older version or damaged after it was stored
+  String manifestFile = FilePath::Combine(entryPath, cManifestFileName);
+  if (!FileExists(manifestFile))
+  {
+    DiskCache::Delete(entryPath);
+    return false;
+  }
+
+  String manifest = ReadFileIntoString(manifestFile);
+  for (StringSplitRange outputs = manifest.Split("\n"); !outputs.Empty(); outputs.PopFront())
+  {
+    StringRange outputFile = outputs.Front();
+    if (outputFile.Empty())
+      continue;
+
+    String cachedFile = FilePath::Combine(entryPath, outputFile);
+    String destFile = FilePath::Combine(options.OutputPath, outputFile);
+    if (!CopyFile(destFile, cachedFile))
+    {
+      CreateDirectoryAndParents(FilePath::GetDirectoryPath(destFile));
+      if (!CopyFile(destFile, cachedFile))
+      {
+        // Delete the entry so it is stored again once the item is built
+        DiskCache::Delete(entryPath);
+        return false;
+      }
+    }
+
+    // Restored outputs must be newer than the files they were built from, or
+    // they would be built again next time
+    SetFileToCurrentTime(destFile);
+  }
+
+  // Keep recently used entries when the directory is trimmed
+  SetFileToCurrentTime(manifestFile);
+  return true;
+}
+
+void ContentBuildCache::Store(StringParam key, ContentComposition* item, BuildOptions& options)
+{
+  ResourceListing listing;
+  item->BuildListing(listing);
+  if (listing.Empty())
+    return;
+
+  // Store the outputs beside the entry and move them into place, so another
+  // build never restores an entry before all of its outputs are stored
+  String entryPath = GetEntryPath(key);
+  String tempPath = DiskCache::GetTempPath(entryPath);
+  StringBuilder manifest;
+  forRange (ResourceEntry& entry, listing.All())
+  {
+    String builtFile = FilePath::Combine(options.OutputPath, entry.Location);
+    String cachedFile = FilePath::Combine(tempPath, entry.Location);
+    CreateDirectoryAndParents(FilePath::GetDirectoryPath(cachedFile));
+
+    // Don't store an entry that is missing any output
+    if (!CopyFile(cachedFile, builtFile))
+    {
+      DiskCache::Delete(tempPath);
+      return;
+    }
+
+    manifest.Append(entry.Location);
+    manifest.Append("\n");
+  }
+
+  String manifestFile = FilePath::Combine(tempPath, cManifestFileName);
+  String manifestText = manifest.ToString();
+  size_t size = manifestText.SizeInBytes();
+  if (WriteToFile(manifestFile.c_str(), (byte*)manifestText.Data(), size) != size)
+  {
+    DiskCache::Delete(tempPath);
+    return;
+  }
+
+  DiskCache::MoveIntoPlace(entryPath, tempPath);
+}
+
+String ContentBuildCache::GetEntryPath(StringParam key)
+{
+  return FilePath::Combine(sDirectory, key);
+}
+
+} // namespace Plasma
@@ -0,0 +1,47 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Plasma
+{
+
+DeclareEnum3(ContentBuildCacheResult, NotCached, Hit, Miss);
+
+/// Keeps the outputs of content builds in a content addressed store on disk, so
+/// content that was already built from the same files (by any project, branch,
+/// or checkout) is copied instead of rebuilt. Outputs are keyed by a hash of
+/// the content item's source and meta files and its builders' versions, as
+/// file times change whenever files are checked out.
+class ContentBuildCache
+{
+public:
+  /// Sets the directory outputs are stored in. Caching is disabled while the
+  /// directory is empty. The directory should be unique to the engine version,
+  /// as builders may change their outputs between versions. The least recently
+  /// used outputs in the directory are deleted if it has grown past its size limit.
+  static void SetDirectory(StringParam directory);
+  static String GetDirectory();
+
+  /// Builds the content item, or restores its outputs when the same files were
+  /// already built. Only items built purely from their own files (thread safe
+  /// items) that need building are cached.
+  static ContentBuildCacheResult::Enum Build(ContentItem* item, BuildOptions& options);
+
+private:
+  /// Returns the key of the outputs built from the content item's files, or an
+  /// empty string if they can't be read.
+  static String GetKey(ContentComposition* item, BuildOptions& options);
+
+  /// Copies the outputs stored under the key into the output directory.
+  /// Returns false if the key has not been stored.
+  static bool Restore(StringParam key, BuildOptions& options);
+
+  /// Stores the outputs listed by the content item under the key.
+  static void Store(StringParam key, ContentComposition* item, BuildOptions& options);
+
+  /// Returns the path the outputs of the key are stored at.
+  static String GetEntryPath(StringParam key);
+
+  static String sDirectory;
+};
+
+} // namespace Plasma
@@ -15,7 +15,7 @@ LightningDefineType(BuilderComponent, builder, type)
   type->AddAttribute(ObjectAttributes::cCore);
 }
 
-DefineSafeIdHandle(ContentComposition);
+DefineThreadSafeIdHandle(ContentComposition);
 LightningDefineType(ContentComposition, builder, type)
 {
   PlasmaBindHandle();
@@ -89,13 +89,13 @@ void ContentMetaComposition::RemoveComponent(HandleParam owner, HandleParam comp
 
 ContentComposition::ContentComposition()
 {
-  ConstructSafeIdHandle();
+  ConstructThreadSafeIdHandle();
 }
 
 ContentComposition::~ContentComposition()
 {
   ClearComponents();
-  DestructSafeIdHandle();
+  DestructThreadSafeIdHandle();
 }
 
 void ContentComposition::ClearComponents()
@@ -178,6 +178,16 @@ void ContentComposition::BuildContentItem(BuildOptions& options)
     PlasmaPrint("Built %s\n", Filename.c_str());
 }
 
+bool ContentComposition::IsBuildThreadSafe()
+{
+  forRange (BuilderComponent* bc, Builders.All())
+  {
+    if (!bc->IsBuildThreadSafe())
+      return false;
+  }
+  return true;
+}
+
 void ContentComposition::Serialize(Serializer& stream)
 {
   SerializeComponents(stream, this);
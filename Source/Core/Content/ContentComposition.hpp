@@ -59,7 +59,7 @@ class ContentComposition : public ContentItem
 {
 public:
   LightningDeclareType(ContentComposition, TypeCopyMode::ReferenceType);
-  DeclareSafeIdHandle(u64);
+  DeclareThreadSafeIdHandle(u64);
 
   ContentComposition();
   ~ContentComposition();
@@ -72,6 +72,7 @@ public:
   // Content Item Interface
   void AddComponent(ContentComponent* cc) override;
   void BuildContentItem(BuildOptions& options) override;
+  bool IsBuildThreadSafe() override;
   void Serialize(Serializer& stream) override;
   void BuildListing(ResourceListing& listing) override;
   void OnInitialize() override;
@@ -114,6 +115,20 @@ public:
   {
   }
 
+  // Can this builder build on a worker thread? Builders that only read their
+  // own settings and write their own output files are thread safe.
+  virtual bool IsBuildThreadSafe()
+  {
+    return false;
+  }
+
+  // Version of this builder's outputs. Increment it when the outputs change so
+  // outputs in the content build cache are built again.
+  virtual uint GetBuildVersion()
+  {
+    return 1;
+  }
+
   // Add built resources to listing.
   virtual void BuildListing(ResourceListing& listing);
 
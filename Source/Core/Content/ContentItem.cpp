@@ -34,17 +34,23 @@ ContentItem::ContentItem()
   mResourceIsContentItem = false;
   mIgnoreMultipleResourcesWarning = false;
 
+  PL::gContentSystem->mLoadedItemsLock.Lock();
+
   // Generate an Id for this Content Item
   ++PL::gContentSystem->mIdCount;
   Id = PL::gContentSystem->mIdCount;
 
   // Store the handle
   PL::gContentSystem->LoadedItems[Id] = this;
+
+  PL::gContentSystem->mLoadedItemsLock.Unlock();
 }
 
 ContentItem::~ContentItem()
 {
+  PL::gContentSystem->mLoadedItemsLock.Lock();
   PL::gContentSystem->LoadedItems.Erase(Id);
+  PL::gContentSystem->mLoadedItemsLock.Unlock();
 }
 
 String ContentItem::GetName()
@@ -198,12 +204,13 @@ Object* ContentItem::GetEditingObject(Resource* resource)
   }
 }
 
-void ContentItem::BuildContentItem(bool useJob)
+bool ContentItem::IsBuildThreadSafe()
+{
+  return false;
+}
+
+void ContentItem::FinishBuild(BuildOptions& buildOptions)
 {
-  ZoneScoped;
-  ProfileScopeFunctionArgs(Filename);
-  BuildOptions options(mLibrary);
-  BuildContentItem(options);
 }
 
 void ContentItem::BuildListing(ResourceListing& listing)
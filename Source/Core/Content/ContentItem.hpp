@@ -92,9 +92,16 @@ public:
   // (may be the content item or the runtime resource)
   virtual Object* GetEditingObject(Resource* resource);
 
-  // Helper that builds the content item using build options from the content
-  // libarary.
-  void BuildContentItem(bool useJob);
+  // Build the content item
+  virtual void BuildContentItem(BuildOptions& buildOptions) = 0;
+
+  // Can this content item be built on a worker thread alongside other content
+  // items? Items that touch engine state while building must return false.
+  virtual bool IsBuildThreadSafe();
+
+  // Called on the main thread after the content item is built, in build order.
+  // Work that isn't thread safe (such as reloading the meta file) goes here.
+  virtual void FinishBuild(BuildOptions& buildOptions);
 
   // Build the resource listing that this content item makes
   virtual void BuildListing(ResourceListing& listing);
@@ -117,10 +124,6 @@ public:
 
   // Called when content item is initialized for derived classes.
   virtual void OnInitialize();
-
-protected:
-  // Build the content item
-  virtual void BuildContentItem(BuildOptions& buildOptions) = 0;
 };
 
 // Resource Meta Operations
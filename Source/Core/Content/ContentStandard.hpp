@@ -35,6 +35,7 @@ public:
 #include "ContentSystem.hpp"
 #include "ContentUtility.hpp"
 #include "ContentComposition.hpp"
+#include "ContentBuildCache.hpp"
 #include "DataContent.hpp"
 #include "TagsContent.hpp"
 #include "BaseBuilders.hpp"
@@ -232,7 +232,7 @@ HandleOf<ResourcePackage> ContentSystem::BuildLibrary(Status& status, ContentLib
   Array<ContentItem*> items;
   items.Reserve(library->ContentItems.Size());
   items.Append(library->ContentItems.Values());
-  HandleOf<ResourcePackage> package = PL::gContentSystem->BuildContentItems(status, items, library, false);
+  HandleOf<ResourcePackage> package = PL::gContentSystem->BuildContentItems(status, items, library, true);
 
   String libraryPackageFile = FilePath::CombineWithExtension(outputPath, library->Name, ".pack");
   package->Save(libraryPackageFile);
@@ -747,6 +747,73 @@ ContentItem* ContentSystem::CreateFromName(StringRange name)
   return nullptr;
 }
 
+// Builds content items, either across the job system or on the calling thread
+struct BuildContentItemTask
+{
+  void operator()(uint index)
+  {
+    Build((*mItemIndices)[index]);
+  }
+
+  void Build(uint itemIndex)
+  {
+    ContentItem* contentItem = (*mToBuild)[itemIndex];
+    ContentBuildCacheResult::Enum cacheResult = ContentBuildCache::Build(contentItem, *(*mItemOptions)[itemIndex]);
+    if (cacheResult == ContentBuildCacheResult::Hit)
+      ++mCacheHits;
+    else if (cacheResult == ContentBuildCacheResult::Miss)
+      ++mCacheMisses;
+    mLastBuiltIndex = (s32)itemIndex;
+    s32 builtCount = mBuiltCount.FetchAdd(1) + 1;
+
+    // Progress can only be reported from the main thread, items finished by
+    // the workers are reported by the main thread while it waits on them
+    if (Thread::IsMainThread())
+      ReportProgress(builtCount);
+  }
+
+  void ReportProgress(s32 builtCount)
+  {
+    static const String cProcessing("Processing");
+    ContentItem* contentItem = (*mToBuild)[mLastBuiltIndex];
+    PL::gEngine->LoadingUpdate(cProcessing,
+                               mLibrary->Name,
+                               contentItem->Filename,
+                               ProgressType::Normal,
+                               (float)builtCount / mToBuild->Size());
+  }
+
+  ContentItemArray* mToBuild;
+  Array<BuildOptions*>* mItemOptions;
+  Array<uint>* mItemIndices;
+  ContentLibrary* mLibrary;
+  Atomic<s32> mBuiltCount;
+  Atomic<s32> mLastBuiltIndex;
+  Atomic<s32> mCacheHits;
+  Atomic<s32> mCacheMisses;
+};
+
+// Builds the thread safe items on the workers so the main thread is free to
+// build the items that have to be built on it, and to report progress
+class BuildContentItemsJob : public Job
+{
+public:
+  BuildContentItemsJob(BuildContentItemTask* task) : mTask(task), mDone(false)
+  {
+  }
+
+  void Execute() override
+  {
+    BuildContentItemTask* task = mTask;
+    PL::gJobs->ParallelFor(task->mItemIndices->Size(), *task);
+    // Must be the last access to the task
+    mDone = true;
+  }
+
+  BuildContentItemTask* mTask;
+  Atomic<bool> mDone;
+};
+
 HandleOf<ResourcePackage>
 ContentSystem::BuildContentItems(Status& status, ContentItemArray& toBuild, ContentLibrary* library, bool useJobs)
 {
@@ -760,25 +827,78 @@ ContentSystem::BuildContentItems(Status& status, ContentItemArray& toBuild, Cont
   package->Location = library->GetOutputPath();
   CreateDirectoryAndParents(package->Location);
 
-  BuildOptions buildOptions(library);
+  // Each item gets its own options as items are built at the same time
+  Array<BuildOptions*> itemOptions;
+  itemOptions.Reserve(toBuild.Size());
+  for (uint i = 0; i < toBuild.Size(); ++i)
+    itemOptions.PushBack(new BuildOptions(library));
+
+  // Items that build through engine state have to be built on this thread
+  Array<uint> threadSafeItems;
+  Array<uint> mainThreadItems;
+  for (uint i = 0; i < toBuild.Size(); ++i)
+  {
+    if (useJobs && toBuild[i]->IsBuildThreadSafe())
+      threadSafeItems.PushBack(i);
+    else
+      mainThreadItems.PushBack(i);
+  }
+
+  BuildContentItemTask buildTask;
+  buildTask.mToBuild = &toBuild;
+  buildTask.mItemOptions = &itemOptions;
+  buildTask.mItemIndices = &threadSafeItems;
+  buildTask.mLibrary = library;
+  buildTask.mBuiltCount = 0;
+  buildTask.mLastBuiltIndex = 0;
+  buildTask.mCacheHits = 0;
+  buildTask.mCacheMisses = 0;
+
+  if (threadSafeItems.Empty() || PL::gJobs->GetWorkerCount() == 0)
+  {
+    PL::gJobs->ParallelFor(threadSafeItems.Size(), buildTask);
+    for (uint i = 0; i < mainThreadItems.Size(); ++i)
+      buildTask.Build(mainThreadItems[i]);
+  }
+  else
+  {
+    BuildContentItemsJob* job = new BuildContentItemsJob(&buildTask);
+    job->AddReference();
+    PL::gJobs->AddJob(job);
+
+    for (uint i = 0; i < mainThreadItems.Size(); ++i)
+      buildTask.Build(mainThreadItems[i]);
+
+    // Report the items the workers finish until they've built all of them
+    const uint cProgressPollMs = 10;
+    s32 reportedCount = buildTask.mBuiltCount;
+    while (!job->mDone)
+    {
+      s32 builtCount = buildTask.mBuiltCount;
+      if (builtCount != reportedCount)
+      {
+        buildTask.ReportProgress(builtCount);
+        reportedCount = builtCount;
+      }
+      Os::Sleep(cProgressPollMs);
+    }
+    job->Release();
+  }
 
   bool allBuilt = true;
 
+  // Finish in the original order so the listing and editor processing don't
+  // depend on which items finished building first
   for (uint i = 0; i < toBuild.Size(); ++i)
   {
-    // Process from this contentItem down.
     ContentItem* contentItem = toBuild[i];
-    static const String cProcessing("Processing");
-    PL::gEngine->LoadingUpdate(
-            cProcessing, library->Name, contentItem->Filename, ProgressType::Normal, (float)(i + 1) / toBuild.Size());
+    BuildOptions& buildOptions = *itemOptions[i];
 
-    contentItem->BuildContentItem(useJobs);
+    contentItem->FinishBuild(buildOptions);
 
     if (buildOptions.Failure)
     {
       PlasmaPrint("Content Build Failed, %s\n", buildOptions.Message.c_str());
-      buildOptions.Failure = false;
-      buildOptions.Message = String();
       allBuilt = false;
     }
 
@@ -787,10 +907,23 @@ ContentSystem::BuildContentItems(Status& status, ContentItemArray& toBuild, Cont
     // Don't do this in the thread (do it after).
     if (contentItem->mNeedsEditorProcessing)
       package->EditorProcessing.PushBack(contentItem);
+
+    delete itemOptions[i];
   }
 
   Sort(package->Resources.All(), SortByLoadOrder());
 
+  s32 cacheHits = buildTask.mCacheHits;
+  s32 cacheLookups = cacheHits + buildTask.mCacheMisses;
+  if (cacheLookups != 0)
+  {
+    PlasmaPrint("Content build cache '%s': %d of %d items restored (%d%%)\n",
+                library->Name.c_str(),
+                cacheHits,
+                cacheLookups,
+                cacheHits * 100 / cacheLookups);
+  }
+
   if (!allBuilt)
     status.SetFailed(String::Format("Failed to build content library '%s'", library->Name.c_str()));
 
@@ -136,7 +136,8 @@ public:
   /// Build the Content Library into a Resource Package.
   HandleOf<ResourcePackage> BuildLibrary(Status& status, ContentLibrary* library, bool sendEvent);
 
-  /// Build ContentItems into Resource Package.
+  /// Build ContentItems into Resource Package. When using jobs, items that are
+  /// thread safe to build are built across the job system.
   HandleOf<ResourcePackage>
   BuildContentItems(Status& status, ContentItemArray& toBuild, ContentLibrary* library, bool useJobs);
 
@@ -192,6 +193,8 @@ public:
   typedef HashMap<ContentItemId, ContentItem*> ContentItemMap;
   ContentItemMap LoadedItems;
   ContentItemId mIdCount;
+  // Content items are created on build threads (importers load meta files)
+  ThreadLock mLoadedItemsLock;
 
   /// Where to move deleted content to.
   String HistoryPath;
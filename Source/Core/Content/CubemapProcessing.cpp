@@ -790,38 +790,33 @@ Vec3 FilterEnvMap(Array<MipHeader>& mipHeaders,
   return filteredColor;
 }
 
-class FilterJob : public Job
+// Filters a face of a mip level from the source mip level
+struct FilterFaceTask
 {
-public:
-  void Execute() override
+  void operator()(uint faceIndex)
   {
     ZoneScoped;
-    uint width = (*mMipHeaders)[mTargetIndex].mWidth;
+    uint targetIndex = mTargetIndex + faceIndex;
+    uint width = (*mMipHeaders)[targetIndex].mWidth;
     float alpha = mRoughness * mRoughness;
 
-    // mFaceIndex assumed to be 0 when doing all 6 faces
-    for (uint i = 0; i < mFaceCount; ++i)
+    for (uint y = 0; y < width; ++y)
     {
-      for (uint y = 0; y < width; ++y)
+      for (uint x = 0; x < width; ++x)
       {
-        for (uint x = 0; x < width; ++x)
-        {
-          Vec2 uv = Vec2(x + 0.5f, y + 0.5f) / (float)width;
-          Vec3 worldDir;
-          FaceToWorldDir(FaceIndexToEnum(mFaceIndex + i), uv, worldDir);
+        Vec2 uv = Vec2(x + 0.5f, y + 0.5f) / (float)width;
+        Vec3 worldDir;
+        FaceToWorldDir(FaceIndexToEnum(faceIndex), uv, worldDir);
 
-          Vec3 filteredSample =
-              FilterEnvMap(*mMipHeaders, *mImageData, mPixelSize, mSourceIndex, worldDir, alpha, Random(uv));
+        Vec3 filteredSample =
+            FilterEnvMap(*mMipHeaders, *mImageData, mPixelSize, mSourceIndex, worldDir, alpha, Random(uv));
 
-          float* pixel = (float*)((*mImageData)[mTargetIndex + i] + (x + y * width) * mPixelSize);
-          pixel[0] = filteredSample.x;
-          pixel[1] = filteredSample.y;
-          pixel[2] = filteredSample.z;
-        }
+        float* pixel = (float*)((*mImageData)[targetIndex] + (x + y * width) * mPixelSize);
+        pixel[0] = filteredSample.x;
+        pixel[1] = filteredSample.y;
+        pixel[2] = filteredSample.z;
       }
     }
-
-    mCountdownEvent->DecrementCount();
   }
 
   Array<MipHeader>* mMipHeaders;
@@ -829,10 +824,7 @@ public:
   uint mPixelSize;
   uint mSourceIndex;
   uint mTargetIndex;
-  uint mFaceIndex;
-  uint mFaceCount;
   float mRoughness;
-  CountdownEvent* mCountdownEvent;
 };
 
 void MipmapCubemap(Array<MipHeader>& mipHeaders, Array<byte*>& imageData, TextureFormat::Enum format, bool compressed)
@@ -937,65 +929,40 @@ void MipmapCubemap(Array<MipHeader>& mipHeaders, Array<byte*>& imageData, Textur
   }
 
   // Timer timer;
-  CountdownEvent countdownEvent;
-
   uint maxMip = (uint)Math::Floor(Math::Log2((real)mipHeaders[0].mWidth));
   currentMip = 1;
 
   uint sourceIndex = 0;
   uint targetIndex = 6;
 
+  FilterFaceTask filterTask;
+  filterTask.mMipHeaders = &mipHeaders;
+  filterTask.mImageData = &imageData;
+  filterTask.mPixelSize = pixelSize;
+
+  // Filtering with ParallelFor instead of waiting on queued jobs, so textures
+  // can be imported from inside of a job without blocking on busy workers
   for (uint mipWidth = firstMipWidth; mipWidth >= 1; mipWidth /= 2)
   {
-    float roughness = currentMip / (float)maxMip;
+    filterTask.mRoughness = currentMip / (float)maxMip;
+    filterTask.mSourceIndex = sourceIndex;
+    filterTask.mTargetIndex = targetIndex;
     ++currentMip;
 
+    // The faces of small mips aren't worth splitting up
     if (mipWidth <= 8)
     {
-      countdownEvent.IncrementCount();
-
-      FilterJob* job = new FilterJob();
-      job->mMipHeaders = &mipHeaders;
-      job->mImageData = &imageData;
-      job->mPixelSize = pixelSize;
-      job->mSourceIndex = sourceIndex;
-      job->mTargetIndex = targetIndex;
-      job->mFaceIndex = 0;
-      job->mFaceCount = 6;
-      job->mRoughness = roughness;
-      job->mCountdownEvent = &countdownEvent;
-      job->mRunImmediateWhenThreadingDisabled = true;
-      PL::gJobs->AddJob(job);
+      PL::gJobs->ParallelFor(6, filterTask, 6);
     }
     else
     {
-      for (uint i = 0; i < 6; ++i)
-      {
-        countdownEvent.IncrementCount();
-
-        FilterJob* job = new FilterJob();
-        job->mMipHeaders = &mipHeaders;
-        job->mImageData = &imageData;
-        job->mPixelSize = pixelSize;
-        job->mSourceIndex = sourceIndex;
-        job->mTargetIndex = targetIndex + i;
-        job->mFaceIndex = i;
-        job->mFaceCount = 1;
-        job->mRoughness = roughness;
-        job->mCountdownEvent = &countdownEvent;
-        job->mRunImmediateWhenThreadingDisabled = true;
-        PL::gJobs->AddJob(job);
-      }
-
-      countdownEvent.Wait();
-
+      PL::gJobs->ParallelFor(6, filterTask);
       sourceIndex += 6;
     }
 
     targetIndex += 6;
   }
 
-  countdownEvent.Wait();
   // timer.Update();
   // double time = timer.Time();
   // PlasmaPrint("Time: %f\n", time);
@@ -39,6 +39,10 @@ public:
   bool NeedsBuilding(BuildOptions& options) override;
   void BuildContent(BuildOptions& buildOptions) override;
   void BuildListing(ResourceListing& listing) override;
+  bool IsBuildThreadSafe() override
+  {
+    return true;
+  }
 };
 
 } // namespace Plasma
@@ -263,11 +263,13 @@ LightningDefineType(GeometryContent, builder, type)
 GeometryContent::GeometryContent()
 {
   EditMode = ContentEditMode::ContentItem;
+  mReload = false;
 }
 
 GeometryContent::GeometryContent(StringParam inputFilename)
 {
   EditMode = ContentEditMode::ContentItem;
+  mReload = false;
   Filename = FilePath::GetFileName(inputFilename);
 }
 
@@ -581,17 +583,24 @@ void GeometryContent::BuildContentItem(BuildOptions& options)
       break;
     }
 
-    if (needsLoading)
-    {
-      // we need to do more work
-      // Re serialize
-      ClearComponents();
-      LoadFromDataFile(*this, GetMetaFilePath());
-      this->OnInitialize();
-
-      // Queue for editor processing
-      mNeedsEditorProcessing = true;
-    }
+    // The meta file is reloaded when the build is finished
+    mReload = needsLoading;
+  }
+}
+
+void GeometryContent::FinishBuild(BuildOptions& options)
+{
+  if (mReload)
+  {
+    // we need to do more work
+    // Re serialize
+    ClearComponents();
+    LoadFromDataFile(*this, GetMetaFilePath());
+    this->OnInitialize();
+
+    // Queue for editor processing
+    mNeedsEditorProcessing = true;
+    mReload = false;
   }
 }
 
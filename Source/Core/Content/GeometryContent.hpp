@@ -66,6 +66,11 @@ public:
   void Generate(ContentInitializer& initializer) override;
   void Serialize(Serializer& stream) override;
   void BuildListing(ResourceListing& listing) override;
+  // Physics meshes are built by the geometry importer
+  bool IsBuildThreadSafe() override
+  {
+    return true;
+  }
   String GetOutputFile(uint index);
 };
 
@@ -140,7 +145,11 @@ public:
   String GetName();
   // Content Item Interface
   void BuildContentItem(BuildOptions& options) override;
+  void FinishBuild(BuildOptions& options) override;
   GeometryContent(ContentInitializer& initializer);
+
+  // Set when the importer changed the meta file
+  bool mReload;
 };
 
 void AddGeometryFileFilters(ResourceManager* manager);
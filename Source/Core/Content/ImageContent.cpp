@@ -21,7 +21,10 @@ void ImageContent::BuildContentItem(BuildOptions& options)
     if (bc->NeedsBuilding(options))
       bc->BuildContent(options);
   }
+}
 
+void ImageContent::FinishBuild(BuildOptions& options)
+{
   if (mReload)
   {
     ClearComponents();
@@ -13,6 +13,7 @@ public:
   ImageContent();
 
   void BuildContentItem(BuildOptions& options) override;
+  void FinishBuild(BuildOptions& options) override;
 
   bool mReload;
 };
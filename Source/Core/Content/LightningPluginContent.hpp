@@ -27,6 +27,11 @@ public:
   void Generate(ContentInitializer& initializer) override;
   void BuildContent(BuildOptions& buildOptions) override;
   void BuildListing(ResourceListing& listing) override;
+  // Builds through the loaded plugin resources
+  bool IsBuildThreadSafe() override
+  {
+    return false;
+  }
 };
 
 void CreateLightningPluginContent(ContentSystem* system);
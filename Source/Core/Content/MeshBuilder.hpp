@@ -59,6 +59,11 @@ public:
   void Generate(ContentInitializer& initializer) override;
   void Serialize(Serializer& stream) override;
   void BuildListing(ResourceListing& listing) override;
+  // Meshes are built by the geometry importer
+  bool IsBuildThreadSafe() override
+  {
+    return true;
+  }
 };
 
 } // namespace Plasma
@@ -405,6 +405,11 @@ public:
   void Initialize(ContentComposition* item) override;
   void Serialize(Serializer& stream) override;
   void BuildContent(BuildOptions& buildOptions) override;
+  // Builds through the runtime animation resources
+  bool IsBuildThreadSafe() override
+  {
+    return false;
+  }
 
   Archetype* GetPreviewArchetype();
   void SetPreviewArchetype(Archetype* archetype);
@@ -83,6 +83,10 @@ public:
   void BuildListing(ResourceListing& listing) override;
   void BuildContent(BuildOptions& buildOptions) override;
   void Rename(StringParam newName) override;
+  bool IsBuildThreadSafe() override
+  {
+    return true;
+  }
 
   bool AlbedoString(String name);
   bool NormalString(String name);
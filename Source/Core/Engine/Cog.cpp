@@ -1037,6 +1037,10 @@ bool Cog::AttachToPreserveLocal(Cog* parent)
   if (GetParent() != parent)
     DetachPreserveLocal();
 
+  // Changes our new parents haven't sent yet were made before we were attached
+  if (Transform* parentTransform = parent->has(Transform))
+    parentTransform->SendPendingUpdates();
+
   if (mHierarchyParent == nullptr)
   {
     Hierarchy* hierarchy = HasOrAdd<Hierarchy>(parent);
@@ -164,6 +164,7 @@ void Engine::Update()
 
     PL::gJobs->RunJobsTimeSliced();
     PL::gDispatch->DispatchEvents();
+    Profile::ProfileSystem::Instance->FlushTracing();
 
     LoadPendingLevels();
 
@@ -4,11 +4,14 @@
 namespace Plasma
 {
 
+// The index of the worker running on this thread (-1 for threads that aren't workers).
+static PlasmaThreadLocal int gWorkerIndex = -1;
+
 LightningDefineType(Job, builder, type)
 {
 }
 
-Job::Job() : mRunCount(0)
+Job::Job() : mRunCount(0), mUnresolvedCount(1), mCompleted(false)
 {
 }
 
@@ -32,16 +35,91 @@ void Job::ExecuteAsyncEnd()
   PL::gJobs->JobComplete(this);
 }
 
+void Job::AddDependency(Job* prerequisite)
+{
+  prerequisite->mCompletionLock.Lock();
+  if (!prerequisite->mCompleted)
+  {
+    // The prerequisite holds a reference to us until it resolves our count.
+    ++mUnresolvedCount;
+    AddReference();
+    prerequisite->mDependents.PushBack(this);
+  }
+  prerequisite->mCompletionLock.Unlock();
+}
+
+JobDeque::JobDeque() : mTop(0), mBottom(0)
+{
+  for (s64 i = 0; i < cCapacity; ++i)
+    mJobs[i] = nullptr;
+}
+
+bool JobDeque::Push(Job* job)
+{
+  s64 bottom = AtomicLoad(&mBottom);
+  s64 top = AtomicLoad(&mTop);
+  if (bottom - top >= cCapacity)
+    return false;
+
+  AtomicStore((void* volatile*)&mJobs[bottom & (cCapacity - 1)], job);
+  AtomicStore(&mBottom, bottom + 1);
+  return true;
+}
+
+Job* JobDeque::Pop()
+{
+  s64 bottom = AtomicLoad(&mBottom) - 1;
+  AtomicStore(&mBottom, bottom);
+  s64 top = AtomicLoad(&mTop);
+
+  // Empty, restore the bottom
+  if (top > bottom)
+  {
+    AtomicStore(&mBottom, bottom + 1);
+    return nullptr;
+  }
+
+  Job* job = (Job*)AtomicLoad((void* volatile*)&mJobs[bottom & (cCapacity - 1)]);
+  if (top != bottom)
+    return job;
+
+  // This was the last job, race any thieves for it
+  if (!AtomicCompareExchange(&mTop, top + 1, top))
+    job = nullptr;
+  AtomicStore(&mBottom, bottom + 1);
+  return job;
+}
+
+Job* JobDeque::Steal()
+{
+  s64 top = AtomicLoad(&mTop);
+  s64 bottom = AtomicLoad(&mBottom);
+  if (top >= bottom)
+    return nullptr;
+
+  Job* job = (Job*)AtomicLoad((void* volatile*)&mJobs[top & (cCapacity - 1)]);
+  if (!AtomicCompareExchange(&mTop, top + 1, top))
+    return nullptr;
+  return job;
+}
+
 namespace PL
 {
 JobSystem* gJobs = nullptr;
 }
 
-JobSystem::JobSystem()
+JobSystem::JobSystem() : mSharedQueueHead(0), mShuttingDown(false), mOutstandingJobs(0)
 {
   if (ThreadingEnabled)
   {
-    mWorkers.Resize(10);
+    // Leave a core for the main thread, but keep a couple of workers around
+    // since some jobs block on IO for long periods of time.
+    uint workerCount = Math::Max(Os::GetProcessorCount() - 1, 2u);
+    mWorkers.Resize(workerCount);
+    mDeques.Resize(workerCount);
+
+    for (uint i = 0; i < mDeques.Size(); ++i)
+      mDeques[i] = new JobDeque();
 
     for (uint i = 0; i < mWorkers.Size(); ++i)
     {
@@ -59,14 +137,11 @@ JobSystem::~JobSystem()
   // Active job range is safe because of the lock.
   forRange (Job& job, mActiveJobs.All())
     job.Cancel();
-
-  // Release all active and pending job references that we own (this may delete
-  // the jobs).
-  mPendingJobs.Clear();
   mLock.Unlock();
 
   // Increment the counter but push no jobs
   // allowing each background thread to unblock.
+  mShuttingDown = true;
   for (uint i = 0; i < mWorkers.Size(); ++i)
     mJobCounter.Increment();
 
@@ -77,35 +152,69 @@ JobSystem::~JobSystem()
     thread.WaitForCompletion();
   }
 
-  // Clear all active jobs now that all threads have stopped (may release the
-  // memory for jobs). There should be no more threads running, but we lock just
-  // to be safe.
+  // Release all references we hold on jobs that never completed (may delete the jobs).
+  // There should be no more threads running, but we lock just to be safe.
   mLock.Lock();
-  mActiveJobs.Clear();
+  Array<Job*> releaseJobs;
+  while (!mActiveJobs.Empty())
+  {
+    Job* job = &mActiveJobs.Front();
+    mActiveJobs.PopFront();
+    releaseJobs.PushBack(job);
+    releaseJobs.Append(job->mDependents.All());
+    job->mDependents.Clear();
+  }
+  mSharedQueue.Clear();
   mLock.Unlock();
 
+  forRange (Job* job, releaseJobs.All())
+    job->Release();
+
   // Delete all threads.
   DeleteObjectsInContainer(mWorkers);
+  DeleteObjectsInContainer(mDeques);
 }
 
 Job* JobSystem::GetNextJob()
 {
-  Job* job = nullptr;
+  // Our own deque first (most recently pushed, likely still in cache)
+  int workerIndex = gWorkerIndex;
+  if (workerIndex >= 0)
+  {
+    Job* job = mDeques[workerIndex]->Pop();
+    if (job != nullptr)
+      return job;
+  }
 
-  // Locked pop front
-  mLock.Lock();
-  if (!mPendingJobs.Empty())
+  // Then anything added from outside of the workers
+  Job* job = nullptr;
+  mSharedQueueLock.Lock();
+  if (mSharedQueueHead < mSharedQueue.Size())
+  {
+    job = mSharedQueue[mSharedQueueHead];
+    ++mSharedQueueHead;
+    if (mSharedQueueHead == mSharedQueue.Size())
+    {
+      mSharedQueue.Clear();
+      mSharedQueueHead = 0;
+    }
+  }
+  mSharedQueueLock.Unlock();
+  if (job != nullptr)
+    return job;
+
+  // Finally try to steal from the other workers, starting after ourself so
+  // that thieves spread out over the victims
+  uint dequeCount = mDeques.Size();
+  uint start = (uint)(workerIndex + 1);
+  for (uint i = 0; i < dequeCount; ++i)
   {
-    HandleOf<Job> jobHandle = mPendingJobs.Back();
-    job = jobHandle;
-    mPendingJobs.PopBack();
-    mActiveJobs.PushBack(jobHandle);
+    job = mDeques[(start + i) % dequeCount]->Steal();
+    if (job != nullptr)
+      return job;
   }
-  mLock.Unlock();
 
-  // We don't need to return a handle because the job will
-  // be kept alive by being inside of mActiveJobs.
-  return job;
+  return nullptr;
 }
 
 void JobSystem::RunJobsTimeSliced(double seconds)
@@ -116,54 +225,109 @@ void JobSystem::RunJobsTimeSliced(double seconds)
   Timer timer;
   do
   {
-    if (!RunOneJob())
+    if (!TryRunOneJob())
       return;
   } while (timer.UpdateAndGetTime() < seconds);
 }
 
 bool JobSystem::AreAllJobsCompleted()
 {
-  mLock.Lock();
-  bool completed = mPendingJobs.Empty() && mActiveJobs.Empty();
-  mLock.Unlock();
-  return completed;
+  return mOutstandingJobs == 0;
+}
+
+uint JobSystem::GetWorkerCount()
+{
+  return mWorkers.Size();
 }
 
 OsInt JobSystem::WorkerThreadEntry()
 {
+  // Claim a deque for this worker
+  static Atomic<s32> sNextWorkerIndex;
+  gWorkerIndex = (int)(sNextWorkerIndex++ % (s32)mDeques.Size());
+  Profile::ProfileSystem::SetThreadName(String::Format("Background %d", gWorkerIndex));
+
   for (;;)
   {
     if (!RunOneJob())
-      return 0;
+      break;
   }
+
+  Profile::ProfileSystem::ReleaseThreadBuffer();
+  return 0;
 }
 
 void JobSystem::AddJob(Job* job)
 {
-  if (!ThreadingEnabled && job->mRunImmediateWhenThreadingDisabled)
-  {
-    ++job->mRunCount;
-    RunJob(job);
+  // A job that is already queued or running will just run again when it completes.
+  if (job->mRunCount++ != 0)
     return;
-  }
 
+  // We hold a reference until the last run completes.
+  job->AddReference();
+  ++mOutstandingJobs;
+
+  // Waits for the completion of the job's previous last run to finish
+  job->mCompletionLock.Lock();
+  job->mCompleted = false;
   mLock.Lock();
-  if (job->mRunCount == 0)
-    mPendingJobs.PushBack(job);
-  ++job->mRunCount;
+  mActiveJobs.PushBack(job);
   mLock.Unlock();
+  job->mCompletionLock.Unlock();
+
+  // Release the token held until the job was added. If none of its
+  // prerequisites are still outstanding then it's ready to run.
+  if (--job->mUnresolvedCount == 0)
+  {
+    if (!ThreadingEnabled && job->mRunImmediateWhenThreadingDisabled)
+      RunJob(job);
+    else
+      ScheduleJob(job);
+  }
+}
 
-  // Signal that a job has been added, which will unblock the waiting workers.
-  mJobCounter.Increment();
+void JobSystem::AddContinuation(Job* job, Job* continuation)
+{
+  continuation->AddDependency(job);
+  AddJob(continuation);
+}
+
+void JobSystem::ScheduleJob(Job* job)
+{
+  // Workers push onto their own deque without locking, everyone else
+  // (or a worker whose deque is full) goes through the shared queue.
+  int workerIndex = gWorkerIndex;
+  if (workerIndex < 0 || !mDeques[workerIndex]->Push(job))
+  {
+    mSharedQueueLock.Lock();
+    mSharedQueue.PushBack(job);
+    mSharedQueueLock.Unlock();
+  }
+
+  // Signal that a job has been added, which will unblock a waiting worker.
+  if (!mWorkers.Empty())
+    mJobCounter.Increment();
 }
 
 bool JobSystem::RunOneJob()
 {
-  mJobCounter.WaitAndDecrement();
-  Job* job = GetNextJob();
+  for (;;)
+  {
+    if (mShuttingDown)
+      return false;
+
+    if (TryRunOneJob())
+      return true;
+
+    // Nothing to do, sleep until a job is added. The counter may be ahead
+    // of the real job count (jobs run without waiting), which only costs a spurious wake.
+    mJobCounter.WaitAndDecrement();
+  }
+}
 
-  // No jobs and Semaphore release
-  // that means we are shutting down.
+bool JobSystem::TryRunOneJob()
+{
+  Job* job = GetNextJob();
   if (job == nullptr)
     return false;
 
@@ -181,18 +345,153 @@ void JobSystem::RunJob(Job* job)
 
 void JobSystem::JobComplete(Job* job)
 {
-  mLock.Lock();
-  --job->mRunCount;
-  bool completed = (job->mRunCount == 0);
-  if (completed)
+  Array<Job*> dependents;
+
+  for (;;)
+  {
+    // Added again while it ran, so run it again
+    s32 runCount = job->mRunCount;
+    if (runCount > 1)
+    {
+      if (job->mRunCount.CompareExchange(runCount - 1, runCount))
+      {
+        RunJob(job);
+        return;
+      }
+      continue;
+    }
+
+    // The job can be added again as soon as its run count is zero, which waits
+    // on the lock until the token is re-armed and the job is off the active list
+    job->mCompletionLock.Lock();
+    if (!job->mRunCount.CompareExchange(0, 1))
+    {
+      job->mCompletionLock.Unlock();
+      continue;
+    }
+
+    ++job->mUnresolvedCount;
+    job->mCompleted = true;
+    dependents.Swap(job->mDependents);
+    mLock.Lock();
+    mActiveJobs.Unlink(job);
+    mLock.Unlock();
+    job->mCompletionLock.Unlock();
+    break;
+  }
+
+  ResolveDependents(dependents);
+  --mOutstandingJobs;
+  job->Release();
+}
+
+void JobSystem::ResolveDependents(Array<Job*>& dependents)
+{
+  forRange (Job* dependent, dependents.All())
   {
-    HandleOf<Job> jobHandle = job;
-    mActiveJobs.EraseValue(jobHandle);
+    if (--dependent->mUnresolvedCount == 0)
+      ScheduleJob(dependent);
+    dependent->Release();
   }
-  mLock.Unlock();
+}
+
+// Shared between every helper of a ParallelFor call (lives on the caller's stack).
+struct ParallelForState
+{
+  JobSystem::ParallelForFunction mFunction;
+  void* mUserData;
+  s32 mCount;
+  s32 mGrainSize;
+  Atomic<s32> mNextIndex;
+  // Helpers that have started and not yet finished.
+  Atomic<s32> mRunningHelpers;
+};
+
+static void RunParallelForChunks(ParallelForState& state)
+{
+  for (;;)
+  {
+    s32 start = state.mNextIndex.FetchAdd(state.mGrainSize);
+    if (start >= state.mCount)
+      return;
+
+    s32 end = Math::Min(start + state.mGrainSize, state.mCount);
+    for (s32 i = start; i < end; ++i)
+      state.mFunction(state.mUserData, (uint)i);
+  }
+}
+
+class ParallelForJob : public Job
+{
+public:
+  ParallelForJob(ParallelForState* state) : mState(state), mClaimed(0)
+  {
+  }
+
+  void Execute() override
+  {
+    // If the caller already reclaimed us the state may no longer exist.
+    if (mClaimed.Exchange(1) != 0)
+      return;
+
+    ParallelForState* state = mState;
+    RunParallelForChunks(*state);
+    // Must be the last access to the state.
+    --state->mRunningHelpers;
+  }
+
+  ParallelForState* mState;
+  Atomic<s32> mClaimed;
+};
+
+void JobSystem::ParallelFor(uint count, ParallelForFunction function, void* userData, uint grainSize)
+{
+  if (count == 0)
+    return;
+
+  grainSize = Math::Max(grainSize, 1u);
+  uint chunkCount = (count + grainSize - 1) / grainSize;
+  uint helperCount = Math::Min(chunkCount - 1, (uint)mWorkers.Size());
+  if (helperCount == 0)
+  {
+    for (uint i = 0; i < count; ++i)
+      function(userData, i);
+    return;
+  }
+
+  ParallelForState state;
+  state.mFunction = function;
+  state.mUserData = userData;
+  state.mCount = (s32)count;
+  state.mGrainSize = (s32)grainSize;
+  state.mNextIndex = 0;
+  state.mRunningHelpers = (s32)helperCount;
+
+  Array<ParallelForJob*> helpers;
+  helpers.Reserve(helperCount);
+  for (uint i = 0; i < helperCount; ++i)
+  {
+    ParallelForJob* helper = new ParallelForJob(&state);
+    helper->AddReference();
+    helpers.PushBack(helper);
+    AddJob(helper);
+  }
+
+  RunParallelForChunks(state);
+
+  // Every index has been claimed. Reclaim helpers that never started so we don't
+  // wait on them, then wait for the started ones to finish their last chunk.
+  forRange (ParallelForJob* helper, helpers.All())
+  {
+    if (helper->mClaimed.Exchange(1) == 0)
+      --state.mRunningHelpers;
+  }
+
+  while (state.mRunningHelpers != 0)
+    Os::Sleep(0);
 
-  if (!completed)
-    RunJob(job);
+  forRange (ParallelForJob* helper, helpers.All())
+    helper->Release();
 }
 
 } // namespace Plasma
@@ -26,6 +26,10 @@ public:
     return 0;
   };
 
+  // This job will not start until the prerequisite has completed. Must be called before
+  // this job is added. If the prerequisite has already completed this does nothing.
+  void AddDependency(Job* prerequisite);
+
 protected:
   // The default behavior is that a job completes everything synchronously on the
   // worker thread, however some jobs may have their own threads and run asynchronously.
@@ -39,11 +43,41 @@ public:
   // When threading is disabled, should we run this task immediately when AddJob is called?
   bool mRunImmediateWhenThreadingDisabled = false;
 
+  IntrusiveLink(Job, ActiveLink);
+
 private:
   // This value is incremented by the job system every time we add the job.
   // If the value is greater than 1, the thread will run it multiple times.
-  // Must be locked by the JobSystem.
-  size_t mRunCount;
+  Atomic<s32> mRunCount;
+
+  // Prerequisites that have not completed yet, plus one token that is held until
+  // the job is added. Whoever brings this to zero schedules the job.
+  Atomic<s32> mUnresolvedCount;
+
+  // Guards whether the last run has finished and the jobs waiting on this one,
+  // and is held while the run count goes to or from zero.
+  SpinLock mCompletionLock;
+  bool mCompleted;
+  Array<Job*> mDependents;
+};
+
+// A fixed size Chase-Lev work stealing deque. Only the owning thread may Push and Pop
+// (from the bottom), any thread may Steal (from the top). Push fails when full.
+class JobDeque
+{
+public:
+  JobDeque();
+
+  bool Push(Job* job);
+  Job* Pop();
+  Job* Steal();
+
+  static const s64 cCapacity = 4096;
+
+private:
+  volatile s64 mTop;
+  volatile s64 mBottom;
+  Job* volatile mJobs[cCapacity];
 };
 
 class JobSystem : public EventObject
@@ -56,7 +90,54 @@ public:
 
   // Add's a job to be worked on (can be called from any thread).
   // Note that a job can be queued up again after it completes.
+  // If the job has dependencies it will not start until they have all completed.
   void AddJob(Job* job);
+
+  // Adds a job that will start once the given job completes.
+  void AddContinuation(Job* job, Job* continuation);
+
+  // Calls functor(index) for every index in [0, count) across all workers and the calling
+  // thread, returning when every index has run. Indices are claimed in chunks of grainSize.
+  // Safe to call from inside of a job: the caller runs indices itself and never waits on
+  // helpers that haven't started, so it can't deadlock on busy workers.
+  template <typename FunctorType>
+  void ParallelFor(uint count, FunctorType& functor, uint grainSize = 1)
+  {
+    ParallelFor(count, &JobSystem::ParallelForTask<FunctorType>, &functor, grainSize);
+  }
+
+  typedef void (*ParallelForFunction)(void* userData, uint index);
+  void ParallelFor(uint count, ParallelForFunction function, void* userData, uint grainSize = 1);
+
+  // Merge sort where runs of runSize are sorted in parallel and then merged pairwise in
+  // parallel (ping-ponging with the scratch array). The runs don't depend on the worker
+  // count, so the result is the same for any number of threads. Not stable: the runs use
+  // Sort, so equal elements can be reordered (deterministically) within a run.
+  template <typename T, typename Comparer>
+  void ParallelSort(Array<T>& values, Array<T>& scratch, Comparer comparer, uint runSize = 1024)
+  {
+    uint count = values.Size();
+    runSize = Math::Max(runSize, 1u);
+    ParallelSortRunsTask<T, Comparer> sortTask = {&values, comparer, runSize};
+    ParallelFor((count + runSize - 1) / runSize, sortTask);
+
+    if (count <= runSize)
+      return;
+
+    scratch.Resize(count);
+    ParallelMergeTask<T, Comparer> mergeTask = {values.Data(), scratch.Data(), comparer, count, runSize};
+    for (; mergeTask.mWidth < count; mergeTask.mWidth *= 2)
+    {
+      uint mergeSize = mergeTask.mWidth * 2;
+      ParallelFor((count + mergeSize - 1) / mergeSize, mergeTask);
+      Plasma::Swap(mergeTask.mSource, mergeTask.mDest);
+    }
+
+    // The last merge wrote into the scratch array
+    if (mergeTask.mSource != values.Data())
+      values.Swap(scratch);
+  }
+
   OsInt WorkerThreadEntry();
 
   // Runs until a slice of time is taken (only when ThreadingEnabled is false).
@@ -66,22 +147,98 @@ public:
 
   bool AreAllJobsCompleted();
 
+  // The number of background worker threads (sized from the hardware thread count).
+  uint GetWorkerCount();
+
 private:
-  // Takes a job from the job queue and runs it.
+  template <typename FunctorType>
+  static void ParallelForTask(void* userData, uint index)
+  {
+    (*(FunctorType*)userData)(index);
+  }
+
+  template <typename T, typename Comparer>
+  struct ParallelSortRunsTask
+  {
+    void operator()(uint index)
+    {
+      uint start = index * mRunSize;
+      uint length = Math::Min(mRunSize, (uint)mValues->Size() - start);
+      Sort(mValues->SubRange(start, length), mComparer);
+    }
+
+    Array<T>* mValues;
+    Comparer mComparer;
+    uint mRunSize;
+  };
+
+  // Merges the two sorted runs of mWidth at the index from mSource into mDest.
+  template <typename T, typename Comparer>
+  struct ParallelMergeTask
+  {
+    void operator()(uint index)
+    {
+      uint start = index * mWidth * 2;
+      uint middle = Math::Min(start + mWidth, mCount);
+      uint end = Math::Min(middle + mWidth, mCount);
+
+      uint left = start;
+      uint right = middle;
+      uint dest = start;
+      // Take from the left run on ties so the merge keeps the order the runs left
+      while (left < middle && right < end)
+      {
+        if (mComparer(mSource[right], mSource[left]))
+          mDest[dest++] = mSource[right++];
+        else
+          mDest[dest++] = mSource[left++];
+      }
+      while (left < middle)
+        mDest[dest++] = mSource[left++];
+      while (right < end)
+        mDest[dest++] = mSource[right++];
+    }
+
+    T* mSource;
+    T* mDest;
+    Comparer mComparer;
+    uint mCount;
+    uint mWidth;
+  };
+
+  // Takes a job from the job queues and runs it.
   // If no jobs are available, this will return false.
   bool RunOneJob();
+  // Runs a job if one can be found without blocking.
+  bool TryRunOneJob();
 
   void RunJob(Job* job);
 
+  // Puts a job whose dependencies are resolved onto a queue.
+  void ScheduleJob(Job* job);
   void JobComplete(Job* job);
+  void ResolveDependents(Array<Job*>& dependents);
 
-  ThreadLock mLock;
-  Array<HandleOf<Job>> mPendingJobs;
-  Array<HandleOf<Job>> mActiveJobs;
+  Job* GetNextJob();
+
+  // Jobs added from threads that aren't workers (the main thread) go here since
+  // only a deque's owner is allowed to push onto it.
+  ThreadLock mSharedQueueLock;
+  Array<Job*> mSharedQueue;
+  size_t mSharedQueueHead;
+
+  // One per worker.
+  Array<JobDeque*> mDeques;
   Array<Thread*> mWorkers;
   Semaphore mJobCounter;
-  Job* GetNextJob();
-  friend class Job;
+  Atomic<bool> mShuttingDown;
+
+  // Guards the active list, which is only walked on shutdown. Only taken when a job
+  // is first added and when its last run completes.
+  ThreadLock mLock;
+  // Every job that has been added and not completed (so we can cancel them on shutdown).
+  InList<Job, &Job::ActiveLink> mActiveJobs;
+  Atomic<s32> mOutstandingJobs;
 };
 
 namespace PL
@@ -62,6 +62,7 @@ Space::Space()
   mIsLoadingLevel = false;
   mInvalidObjectPositionOccurred = false;
   mMaxObjectPosition = real(1e+10);
+  mDeferTransformUpdates = false;
 }
 
 Space::~Space()
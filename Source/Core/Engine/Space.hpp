@@ -199,6 +199,11 @@ public:
   HierarchyList mRoots;
   uint mRootCount;
 
+  // Set from TimeSpace::DeferTransformUpdates, the TimeSpace sends the updates
+  bool mDeferTransformUpdates;
+  // Transforms with an update deferred until Transform::SendDeferredUpdates
+  Array<Transform*> mDeferredTransforms;
+
   // If valid a load is pending for next update
   HandleOf<Level> mPendingLevel;
   // Allows CameraViewports to attach viewport to a space specific GameWidget
@@ -75,6 +75,7 @@ LightningDefineType(TimeSpace, builder, type)
   LightningBindFieldProperty(mMinDt);
   LightningBindFieldProperty(mMaxDt);
   LightningBindGetterSetterProperty(TimeScale);
+  LightningBindGetterSetterProperty(DeferTransformUpdates);
   LightningBindFieldProperty(mPaused);
   LightningBindFieldGetterAs(mScaledClampedDt, "Dt");
   LightningBindFieldGetter(mRealDt);
@@ -91,6 +92,7 @@ TimeSpace::TimeSpace()
 
   mPaused = false;
   mFrame = 0;
+  mDeferTransformUpdates = false;
 
   mRealTimePassed = 0.0;
   mScaledClampedTimePassed = 0.0;
@@ -111,12 +113,14 @@ void TimeSpace::Serialize(Serializer& stream)
   SerializeNameDefault(mTimeScale, 1.0f);
   SerializeEnumNameDefault(TimeMode, mTimeMode, TimeMode::FixedFrametime);
   SerializeNameDefault(mStepCount, (uint)1);
+  SerializeNameDefault(mDeferTransformUpdates, false);
 }
 
 void TimeSpace::Initialize(CogInitializer& initializer)
 {
   mTimeSystem = PL::gEngine->has(TimeSystem);
   mTimeSystem->List.PushBack(this);
+  GetSpace()->mDeferTransformUpdates = mDeferTransformUpdates;
 }
 
 float TimeSpace::GetDtOrZero()
@@ -142,6 +146,24 @@ void TimeSpace::SetTimeScale(float timeScale)
 {
   mTimeScale = Math::Max(timeScale, 0.0f);
 }
+
+bool TimeSpace::GetDeferTransformUpdates()
+{
+  return mDeferTransformUpdates;
+}
+
+void TimeSpace::SetDeferTransformUpdates(bool state)
+{
+  mDeferTransformUpdates = state;
+
+  // Nothing deferred is left behind once updates are sent immediately again
+  if (Space* space = GetSpace())
+  {
+    space->mDeferTransformUpdates = state;
+    if (!state)
+      Transform::SendDeferredUpdates(space);
+  }
+}
 #pragma optimize(off)
 void TimeSpace::Update(float dt)
 {
@@ -232,6 +254,9 @@ void TimeSpace::Update(float dt)
       dispatcher->Dispatch(Events::PreviewUpdate, &updateEvent);
     }
 
+    // Frame updates have to reach physics before it steps
+    Transform::SendDeferredUpdates(space);
+
     if (!GetGloballyPaused())
       Step();
 
@@ -240,6 +265,9 @@ void TimeSpace::Update(float dt)
       ProfileScopeTree("GraphicsFrameUpdate", "TimeSystem", Color::SkyBlue);
       dispatcher->Dispatch(Events::GraphicsFrameUpdate, &updateEvent);
     }
+
+    // Everything changed this frame has to reach graphics before it renders
+    Transform::SendDeferredUpdates(space);
   }
 }
 #pragma optimize(on)
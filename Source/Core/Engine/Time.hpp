@@ -103,6 +103,16 @@ public:
   float GetTimeScale();
   void SetTimeScale(float timeScale);
 
+  /// Every change to a Transform sends a TransformUpdate through its whole
+  /// hierarchy, so moving an object with many children several times a frame
+  /// repeats that work for every change. When set, changes only mark the
+  /// Transform dirty and one update per changed Transform is sent with the
+  /// changes of the whole frame, before the space steps and before it renders.
+  /// Values read back from a Transform are always current. Transforms with
+  /// in-world children are always updated immediately.
+  bool GetDeferTransformUpdates();
+  void SetDeferTransformUpdates(bool state);
+
   /// The maximum amount of time we send when running in 'ActualFrametime' mode
   /// If this value is set too high and the user does anything to pause their
   /// system or the game (example grabbing the window) then a large frame time
@@ -167,6 +177,8 @@ public:
   /// Causes the engine to update multiple times before rendering a frame.
   uint mStepCount;
 
+  bool mDeferTransformUpdates;
+
   // Internals
   Link<TimeSpace> link;
   TimeSystem* mTimeSystem;
@@ -99,6 +99,19 @@ Memory::Pool* Transform::sCachedWorldMatrixPool =
 
 bool Transform::sCacheWorldMatrices = true;
 
+// Set by UncachedWorldMatrixScope on threads that can't use the shared pool
+static PlasmaThreadLocal bool sThreadWorldMatricesUncached = false;
+
+Transform::UncachedWorldMatrixScope::UncachedWorldMatrixScope() : mWasUncached(sThreadWorldMatricesUncached)
+{
+  sThreadWorldMatricesUncached = true;
+}
+
+Transform::UncachedWorldMatrixScope::~UncachedWorldMatrixScope()
+{
+  sThreadWorldMatricesUncached = mWasUncached;
+}
+
 LightningDefineType(Transform, builder, type)
 {
   type->Add(new TransformMetaTransform());
@@ -151,6 +164,10 @@ Transform::Transform()
   TransformParent = NULL;
   InWorld = false;
   mCachedWorldMatrix = nullptr;
+  mDeferredWorldMatrix = nullptr;
+  mDeferredFlags = 0;
+  mDeferredIndex = 0;
+  mInWorldChildCount = 0;
 }
 
 Transform::~Transform()
@@ -159,6 +176,7 @@ Transform::~Transform()
   // world matrix after OnDestroy which would cause us to leak memory. Cleanup
   // the cached matrix if we have one here no matter what.
   FreeCachedMatrix();
+  FreeDeferredMatrix();
 }
 
 void Transform::Serialize(Serializer& stream)
@@ -185,6 +203,11 @@ void Transform::Initialize(CogInitializer& initializer)
 {
   if (initializer.mParent)
     TransformParent = initializer.mParent->has(Transform);
+  AddInWorldToParents(GetInWorldCount());
+
+  // Changes our parents made before we existed must not move us
+  if (InWorld && TransformParent)
+    TransformParent->SendPendingUpdates();
 }
 
 void Transform::AttachTo(AttachmentInfo& info)
@@ -198,6 +221,7 @@ void Transform::AttachTo(AttachmentInfo& info)
   {
     ErrorIf(parent->has(Transform) == NULL, "Parent does not have a Transform.");
     TransformParent = parent->has(Transform);
+    AddInWorldToParents(GetInWorldCount());
   }
 
   SetDirty();
@@ -209,7 +233,10 @@ void Transform::Detached(AttachmentInfo& info)
     return;
 
   if (TransformParent != NULL)
+  {
+    AddInWorldToParents(-(int)GetInWorldCount());
     TransformParent = NULL;
+  }
   SetDirty();
 }
 
@@ -231,6 +258,11 @@ void Transform::TransformUpdate(TransformUpdateInfo& info)
     newTransform.Decompose(&Scale, &rotation, &Translation);
     Rotation = Math::ToQuaternion(rotation).Normalized();
   }
+
+  // A parent moving us is part of our world matrix before our own deferred
+  // change, otherwise our deferred update would apply it to our children again
+  if (info.mTransform != this && mDeferredWorldMatrix != nullptr)
+    *mDeferredWorldMatrix = Math::Multiply(info.mDelta, *mDeferredWorldMatrix);
 }
 
 void Transform::Update(uint flags)
@@ -334,7 +366,7 @@ Mat4 Transform::GetWorldMatrix()
   }
 
   // Cache it if we should
-  if (sCacheWorldMatrices)
+  if (sCacheWorldMatrices && !sThreadWorldMatricesUncached)
   {
     mCachedWorldMatrix = (Mat4*)sCachedWorldMatrixPool->Allocate(sizeof(Mat4));
     *mCachedWorldMatrix = worldMatrix;
@@ -404,6 +436,12 @@ void Transform::SetLocalScale(Vec3Param localScale)
   if (localScale == Scale)
     return;
 
+  if (DeferUpdate(TransformUpdateFlags::Scale))
+  {
+    SetLocalScaleInternal(localScale);
+    return;
+  }
+
   Mat4 oldMat;
   if (IsInitialized())
     oldMat = GetWorldMatrix();
@@ -465,6 +503,12 @@ void Transform::SetLocalRotation(QuatParam localRotation)
   if (localRotation == Rotation)
     return;
 
+  if (DeferUpdate(TransformUpdateFlags::Rotation))
+  {
+    SetLocalRotationInternal(localRotation.Normalized());
+    return;
+  }
+
   Mat4 oldMat;
   if (IsInitialized())
     oldMat = GetWorldMatrix();
@@ -517,6 +561,12 @@ void Transform::SetLocalTranslation(Vec3Param localTranslation)
   if (localTranslation == Translation)
     return;
 
+  if (DeferUpdate(TransformUpdateFlags::Translation))
+  {
+    SetLocalTranslationInternal(localTranslation);
+    return;
+  }
+
   Mat4 oldMat;
   if (IsInitialized())
     oldMat = GetWorldMatrix();
@@ -577,6 +627,12 @@ Vec3 Transform::GetWorldScale()
 
 void Transform::SetWorldScale(Vec3Param worldScale)
 {
+  if (DeferUpdate(TransformUpdateFlags::Scale))
+  {
+    SetWorldScaleInternal(worldScale);
+    return;
+  }
+
   Mat4 oldMat;
   if (IsInitialized())
     oldMat = GetWorldMatrix();
@@ -638,6 +694,12 @@ Quat Transform::GetWorldRotation()
 
 void Transform::SetWorldRotation(QuatParam worldRotation)
 {
+  if (DeferUpdate(TransformUpdateFlags::Rotation))
+  {
+    SetWorldRotationInternal(worldRotation);
+    return;
+  }
+
   Mat4 oldMat;
   if (IsInitialized())
     oldMat = GetWorldMatrix();
@@ -687,6 +749,12 @@ Vec3 Transform::GetWorldTranslation()
 
 void Transform::SetWorldTranslation(Vec3Param worldTranslation)
 {
+  if (DeferUpdate(TransformUpdateFlags::Translation))
+  {
+    SetWorldTranslationInternal(worldTranslation);
+    return;
+  }
+
   Mat4 oldMat;
   if (IsInitialized())
     oldMat = GetWorldMatrix();
@@ -729,8 +797,13 @@ void Transform::SetInWorld(bool state)
   if (state == InWorld)
     return;
 
+  // Pending parent deltas were made with the old state
+  if (TransformParent)
+    TransformParent->SendPendingUpdates();
+
   Mat4 worldTransform = GetWorldMatrix();
   InWorld = state;
+  AddInWorldToParents(state ? 1 : -1);
 
   if (state)
   {
@@ -769,6 +842,123 @@ bool Transform::GetInWorld()
   return InWorld;
 }
 
+// A transform with a deferred update and how many parents it has
+struct DeferredTransformEntry
+{
+  bool operator<(const DeferredTransformEntry& rhs) const
+  {
+    return mDepth < rhs.mDepth;
+  }
+
+  Transform* mTransform;
+  uint mDepth;
+};
+
+void Transform::SendDeferredUpdates(Space* space)
+{
+  Array<Transform*>& transforms = space->mDeferredTransforms;
+  if (transforms.Empty())
+    return;
+
+  ZoneScoped;
+  ProfileScopeFunction();
+
+  // Send parents before their children, so the delta a parent applies to a
+  // child is folded into the child's own deferred update
+  Array<DeferredTransformEntry> entries;
+  entries.Reserve(transforms.Size());
+  forRange (Transform* transform, transforms.All())
+  {
+    // Destroyed while its update was deferred
+    if (transform == nullptr)
+      continue;
+
+    DeferredTransformEntry entry;
+    entry.mTransform = transform;
+    entry.mDepth = 0;
+    for (Transform* parent = transform->TransformParent; parent != nullptr; parent = parent->TransformParent)
+      ++entry.mDepth;
+    entries.PushBack(entry);
+  }
+  Sort(entries.All());
+
+  transforms.Clear();
+  forRange (DeferredTransformEntry& entry, entries.All())
+  {
+    entry.mTransform->mDeferredIndex = transforms.Size();
+    transforms.PushBack(entry.mTransform);
+  }
+
+  // Updates can change (or destroy) transforms, so entries are read from the
+  // space every time and only the entries that were deferred before are sent
+  uint count = transforms.Size();
+  for (uint i = 0; i < count; ++i)
+  {
+    Transform* transform = transforms[i];
+    if (transform == nullptr)
+      continue;
+
+    Mat4 oldMat = *transform->mDeferredWorldMatrix;
+    uint flags = transform->mDeferredFlags;
+    transforms[i] = nullptr;
+    transform->FreeDeferredMatrix();
+    transform->Update(flags, oldMat);
+  }
+
+  // Updates deferred while sending are kept for the next call
+  transforms.Erase(transforms.SubRange(0, count));
+  for (uint i = 0; i < transforms.Size(); ++i)
+  {
+    if (transforms[i] != nullptr)
+      transforms[i]->mDeferredIndex = i;
+  }
+}
+
+void Transform::SendPendingUpdates()
+{
+  if (TransformParent)
+    TransformParent->SendPendingUpdates();
+
+  if (mDeferredWorldMatrix == nullptr)
+    return;
+
+  Mat4 oldMat = *mDeferredWorldMatrix;
+  uint flags = mDeferredFlags;
+  CancelDeferredUpdate();
+  Update(flags, oldMat);
+}
+
+bool Transform::DeferUpdate(uint flags)
+{
+  if (!IsInitialized())
+    return false;
+
+  Space* space = GetSpace();
+  if (space == nullptr || !space->mDeferTransformUpdates)
+    return false;
+
+  // Only the world matrix before the first change is kept, so the update
+  // carries the delta of every change since the last update
+  if (mDeferredWorldMatrix == nullptr)
+  {
+    // In-world children apply our delta to their own world values, which would
+    // undo anything set on them before the update is sent, so they have to see
+    // every change as it happens
+    if (mInWorldChildCount != 0)
+      return false;
+
+    Mat4 worldMatrix = GetWorldMatrix();
+    mDeferredWorldMatrix = (Mat4*)sCachedWorldMatrixPool->Allocate(sizeof(Mat4));
+    *mDeferredWorldMatrix = worldMatrix;
+    mDeferredFlags = 0;
+    mDeferredIndex = space->mDeferredTransforms.Size();
+    space->mDeferredTransforms.PushBack(this);
+  }
+
+  mDeferredFlags |= flags;
+  return true;
+}
+
 void Transform::SetDirty()
 {
   // Don't need to do anything if we're already dirty
@@ -827,6 +1017,11 @@ void Transform::OnDestroy(uint flags /*= 0*/)
       transform->TransformParent = nullptr;
   }
 
+  // Our parents no longer have the in-world transforms below us
+  AddInWorldToParents(-(int)GetInWorldCount());
+
+  // Don't send the deferred update of a destroyed transform
+  CancelDeferredUpdate();
   FreeCachedMatrix();
 }
 
@@ -956,4 +1151,41 @@ void Transform::FreeCachedMatrix()
   }
 }
 
+void Transform::CancelDeferredUpdate()
+{
+  if (mDeferredWorldMatrix == nullptr)
+    return;
+
+  // Leave the entry so other indices don't change, sending skips it
+  if (Space* space = GetSpace())
+  {
+    Array<Transform*>& transforms = space->mDeferredTransforms;
+    if (mDeferredIndex < transforms.Size() && transforms[mDeferredIndex] == this)
+      transforms[mDeferredIndex] = nullptr;
+  }
+
+  FreeDeferredMatrix();
+}
+
+void Transform::AddInWorldToParents(int count)
+{
+  for (Transform* parent = TransformParent; parent != nullptr; parent = parent->TransformParent)
+    parent->mInWorldChildCount += count;
+}
+
+uint Transform::GetInWorldCount()
+{
+  return mInWorldChildCount + (InWorld ? 1 : 0);
+}
+
+void Transform::FreeDeferredMatrix()
+{
+  if (mDeferredWorldMatrix != nullptr)
+  {
+    sCachedWorldMatrixPool->Deallocate(mDeferredWorldMatrix, sizeof(Mat4));
+    mDeferredWorldMatrix = nullptr;
+  }
+  mDeferredFlags = 0;
+}
+
 } // namespace Plasma
@@ -36,6 +36,28 @@ public:
   static bool sCacheWorldMatrices;
   static Memory::Pool* sCachedWorldMatrixPool;
 
+  /// Keeps world matrices from being cached on the calling thread while in
+  /// scope. The cache pool isn't thread safe, so jobs that get world matrices in
+  /// parallel use this (everything is still correct without the cache).
+  class UncachedWorldMatrixScope
+  {
+  public:
+    UncachedWorldMatrixScope();
+    ~UncachedWorldMatrixScope();
+
+  private:
+    bool mWasUncached;
+  };
+
+  /// Sends the deferred updates of the transforms changed in the space (see
+  /// TimeSpace::DeferTransformUpdates). Transforms changed while sending are
+  /// sent on the next call.
+  static void SendDeferredUpdates(Space* space);
+  /// Sends the deferred updates of this transform and its parents now, parents
+  /// first. Has to be called before an in-world transform is added below them,
+  /// otherwise their pending deltas would be applied to it.
+  void SendPendingUpdates();
+
   /// Constructor / Destructor.
   Transform();
   ~Transform();
@@ -165,9 +187,28 @@ public:
 private:
   void OnDestroy(uint flags = 0) override;
   void FreeCachedMatrix();
+  /// Defers the update of a change with the given flags. Returns false if
+  /// updates aren't deferred, in which case the caller sends the update.
+  bool DeferUpdate(uint flags);
+  /// Removes this transform's deferred update without sending it.
+  void CancelDeferredUpdate();
+  void FreeDeferredMatrix();
+  /// Adds to the count of in-world transforms below each of our parents.
+  void AddInWorldToParents(int count);
+  /// How many in-world transforms this one adds to its parents' counts.
+  uint GetInWorldCount();
 
   /// If null, the matrix is dirty.
   Mat4* mCachedWorldMatrix;
+  /// The world matrix before the first deferred change (allocated from the
+  /// cached world matrix pool). If null, no update is deferred.
+  Mat4* mDeferredWorldMatrix;
+  uint mDeferredFlags;
+  /// Where this transform is in the space's deferred transforms.
+  uint mDeferredIndex;
+  /// How many transforms below this one are in world (their deltas depend on
+  /// every change to this transform, so its updates can't be deferred).
+  uint mInWorldChildCount;
   Vec3 Translation;
   Vec3 Scale;
   Quat Rotation;
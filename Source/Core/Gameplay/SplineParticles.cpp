@@ -176,8 +176,6 @@ int SplineParticleEmitter::EmitParticles(
       newParticle->Rotation = 0;
 
     newParticle->RotationalVelocity = gRandom.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
-
-    particleList->AddParticle(newParticle);
   }
 
   return particlesToEmit;
@@ -243,7 +241,23 @@ void SplineParticleAnimator::Initialize(CogInitializer& initializer)
   mEmitter = GetOwner()->has(SplineParticleEmitter);
 }
 
-void SplineParticleAnimator::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
+void SplineParticleAnimator::BeginAnimate(float dt, Mat4Ref transform)
+{
+  if (!mAutoCalculateLifetime)
+    return;
+
+  Spline* spline = mEmitter->GetSpline();
+  if (spline == nullptr)
+    return;
+
+  // Update the base lifetime to the time required for each particle to travel
+  // the entire spline
+  float curveLength = spline->GetTotalDistance();
+  if (curveLength >= 0.0001f)
+    mEmitter->mLifetime = curveLength / mSpeed;
+}
+
+void SplineParticleAnimator::Animate(ParticleListRange particles, float dt, Mat4Ref transform)
 {
   // Spring constants
   const float f = 1.0f + 2.0f * dt * mSpringDampingRatio * mSpringFrequencyHz;
@@ -262,13 +276,6 @@ void SplineParticleAnimator::Animate(ParticleList* particleList, float dt, Mat4R
   if (curveLength < 0.0001f)
     return;
 
-  /// The time required for each particle to travel the entire spline
-  float timeToFinish = curveLength / mSpeed;
-
-  // Update the base lifetime if specified
-  if (mAutoCalculateLifetime)
-    mEmitter->mLifetime = timeToFinish;
-
   // Sampling the curve is always in world space, so we need to bring it back
   // into local space before using it
   Transform* trans = GetOwner()->has(Transform);
@@ -285,7 +292,7 @@ void SplineParticleAnimator::Animate(ParticleList* particleList, float dt, Mat4R
   Vec3 crossA, previousNormal;
   GenerateOrthonormalBasis(startTangent, &crossA, &previousNormal);
 
-  forRange (Particle* p, particleList->All())
+  forRange (Particle* p, particles)
   {
     // How far (in meters) the particle has traveled
     float distanceTraveled = p->Time * mSpeed;
@@ -50,7 +50,8 @@ public:
   void Initialize(CogInitializer& initializer) override;
 
   /// ParticleAnimator Interface.
-  void Animate(ParticleList* particleList, float dt, Mat4Ref transform) override;
+  void BeginAnimate(float dt, Mat4Ref transform) override;
+  void Animate(ParticleListRange particles, float dt, Mat4Ref transform) override;
 
   /// Speed setter / getter.
   void SetSpeed(float speed);
@@ -64,15 +64,20 @@ bool DataTreeLoader::OpenFile(Status& status, StringParam fileName)
     return false;
   }
 
-  return OpenBuffer(status, fileRange, fileName);
+  return Open(status, fileRange, fileName, true);
 }
 
 bool DataTreeLoader::OpenBuffer(Status& status, StringRange data, StringRange source)
+{
+  return Open(status, data, source, false);
+}
+
+bool DataTreeLoader::Open(Status& status, StringRange data, StringRange source, bool cacheTree)
 {
   Close();
 
   mFileRoot = new DataNode(DataNodeType::Object, nullptr);
-  if (ReadDataSet(status, data, source, this, &mLoadedFileVersion, mFileRoot))
+  if (ReadDataSet(status, data, source, this, &mLoadedFileVersion, mFileRoot, cacheTree))
   {
     // "Open" the file root and make the first child the next node to be read
     Reset();
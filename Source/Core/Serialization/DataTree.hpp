@@ -17,7 +17,8 @@ public:
   /// Serializer Interface.
   SerializerClass::Enum GetClass() override;
 
-  /// Load a data tree from a file
+  /// Load a data tree from a file. The parsed tree is kept in the
+  /// DataTreeCache, so the file only has to be parsed again once it changes.
   bool OpenFile(Status& status, StringParam file);
 
   /// Load a data tree from a StringRange. The 'source' parameter is used
@@ -90,6 +91,10 @@ public:
   bool mIgnoreDataInheritance;
 
 protected:
+  /// Loads a data tree from a StringRange, using the DataTreeCache if
+  /// 'cacheTree' is set.
+  bool Open(Status& status, StringRange data, StringRange source, bool cacheTree);
+
   Array<DataNode*> mNodeStack;
   String mFileName;
   DataNode* mFileRoot;
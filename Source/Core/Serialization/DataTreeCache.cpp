@@ -0,0 +1,231 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+// Identifies a cached data tree file
+static const u32 cDataTreeCacheSignature = 0x45455254;
+// Must be incremented whenever the cached tree layout changes
+static const u32 cDataTreeCacheVersion = 1;
+// Smaller files are parsed faster than their cached tree can be found
+static const size_t cMinCachedTextSize = 4096;
+// The oldest cached trees are deleted when the directory grows past this
+static const u64 cMaxCacheSize = 256 * 1024 * 1024;
+// Data trees are never close to this deep, a deeper cached tree is corrupt
+static const uint cMaxNodeDepth = 256;
+
+String DataTreeCache::sDirectory;
+
+static void SaveString(BinaryBufferSaver& saver, StringRange string)
+{
+  u32 size = (u32)string.SizeInBytes();
+  saver.FundamentalType(size);
+  saver.Data((byte*)string.Data(), size);
+}
+
+// Smallest possible entries (all strings empty, no attributes or children)
+static const size_t cMinStringSize = sizeof(u32);
+static const size_t cMinAttributeSize = cMinStringSize * 2;
+static const size_t cMinRemovedNodeSize = cMinStringSize + sizeof(Guid);
+static const size_t cMinNodeSize = sizeof(u32) * 6 + cMinStringSize * 4 + sizeof(Guid);
+
+static void SaveNode(BinaryBufferSaver& saver, DataNode* node)
+{
+  u32 nodeType = (u32)node->mNodeType;
+  saver.FundamentalType(nodeType);
+  SaveString(saver, node->mPropertyName);
+  SaveString(saver, node->mTypeName);
+  SaveString(saver, node->mTextValue);
+
+  u32 attributeCount = node->mAttributes.Size();
+  saver.FundamentalType(attributeCount);
+  forRange (DataAttribute& attribute, node->mAttributes.All())
+  {
+    SaveString(saver, attribute.mName);
+    SaveString(saver, attribute.mValue);
+  }
+
+  u32 patchState = (u32)node->mPatchState;
+  saver.FundamentalType(patchState);
+  saver.FundamentalType(node->mFlags.U32Field);
+
+  u32 removedCount = node->mRemovedChildren.Size();
+  saver.FundamentalType(removedCount);
+  forRange (DataNode::RemovedNode& removedNode, node->mRemovedChildren.All())
+  {
+    SaveString(saver, removedNode.mTypeName);
+    saver.FundamentalType(removedNode.mUniqueNodeId);
+  }
+
+  SaveString(saver, node->mInheritedFromId);
+  saver.FundamentalType(node->mUniqueNodeId);
+
+  u32 childCount = node->mNumberOfChildren;
+  saver.FundamentalType(childCount);
+  forRange (DataNode& child, node->GetChildren())
+    SaveNode(saver, &child);
+}
+
+static bool LoadNode(DiskCacheReader& reader, DataNode* parent, uint depth)
+{
+  if (depth > cMaxNodeDepth)
+    return false;
+
+  u32 nodeType = 0;
+  if (!reader.Read(nodeType) || nodeType >= DataNodeType::Size)
+    return false;
+  DataNode* node = new DataNode((DataNodeType::Enum)nodeType, parent);
+  if (!reader.ReadString(node->mPropertyName) || !reader.ReadString(node->mTypeName) ||
+      !reader.ReadString(node->mTextValue))
+    return false;
+
+  u32 attributeCount = 0;
+  if (!reader.ReadCount(attributeCount, cMinAttributeSize))
+    return false;
+  node->mAttributes.Reserve(attributeCount);
+  for (u32 i = 0; i < attributeCount; ++i)
+  {
+    String name, value;
+    if (!reader.ReadString(name) || !reader.ReadString(value))
+      return false;
+    node->mAttributes.PushBack(DataAttribute(name, value));
+  }
+
+  u32 patchState = 0;
+  if (!reader.Read(patchState) || patchState >= PatchState::Size || !reader.Read(node->mFlags.U32Field))
+    return false;
+  node->mPatchState = (PatchState::Enum)patchState;
+
+  u32 removedCount = 0;
+  if (!reader.ReadCount(removedCount, cMinRemovedNodeSize))
+    return false;
+  node->mRemovedChildren.Resize(removedCount);
+  forRange (DataNode::RemovedNode& removedNode, node->mRemovedChildren.All())
+  {
+    if (!reader.ReadString(removedNode.mTypeName) || !reader.Read(removedNode.mUniqueNodeId))
+      return false;
+  }
+
+  if (!reader.ReadString(node->mInheritedFromId) || !reader.Read(node->mUniqueNodeId))
+    return false;
+
+  u32 childCount = 0;
+  if (!reader.ReadCount(childCount, cMinNodeSize))
+    return false;
+  for (u32 i = 0; i < childCount; ++i)
+  {
+    if (!LoadNode(reader, node, depth + 1))
+      return false;
+  }
+
+  return true;
+}
+
+void DataTreeCache::SetDirectory(StringParam directory)
+{
+  sDirectory = directory;
+  if (!sDirectory.Empty())
+    DiskCache::TrimDirectory(sDirectory, cMaxCacheSize);
+}
+
+String DataTreeCache::GetDirectory()
+{
+  return sDirectory;
+}
+
+bool DataTreeCache::Load(
+    StringRange data, uint* fileVersion, bool* patchRequired, DataAttributes& rootAttributes, DataNode* fileRoot)
+{
+  if (sDirectory.Empty() || data.SizeInBytes() < cMinCachedTextSize)
+    return false;
+
+  ZoneScoped;
+
+  // Trees cached by a different layout, or that were not fully written, are skipped
+  String cachePath = GetCachePath(data);
+  DiskCacheReader reader;
+  if (!DiskCache::Load(cachePath, cDataTreeCacheSignature, cDataTreeCacheVersion, reader))
+    return false;
+
+  u32 version = 0;
+  bool patch = false;
+  u32 attributeCount = 0;
+  DataAttributes attributes;
+  bool loaded = reader.Read(version) && reader.Read(patch) && reader.ReadCount(attributeCount, cMinAttributeSize);
+  for (u32 i = 0; loaded && i < attributeCount; ++i)
+  {
+    String name, value;
+    loaded = reader.ReadString(name) && reader.ReadString(value);
+    attributes.PushBack(DataAttribute(name, value));
+  }
+
+  u32 rootCount = 0;
+  loaded = loaded && reader.ReadCount(rootCount, cMinNodeSize);
+  for (u32 i = 0; loaded && i < rootCount; ++i)
+    loaded = LoadNode(reader, fileRoot, 0);
+
+  u32 end = 0;
+  loaded = loaded && reader.Read(end) && end == BinaryEndSignature && reader.GetRemainingSize() == 0;
+
+  // Throw away a tree that didn't read back the way it was written, and the
+  // entry so it isn't read again
+  if (!loaded || fileRoot->mChildren.Empty())
+  {
+    while (DataNode* root = fileRoot->GetFirstChild())
+      root->Destroy();
+    DiskCache::Delete(cachePath);
+    return false;
+  }
+
+  *fileVersion = version;
+  *patchRequired = patch;
+  rootAttributes.Append(attributes.All());
+  return true;
+}
+
+void DataTreeCache::Save(
+    StringRange data, uint fileVersion, bool patchRequired, DataAttributes::range rootAttributes, DataNode* fileRoot)
+{
+  if (sDirectory.Empty() || data.SizeInBytes() < cMinCachedTextSize)
+    return;
+
+  ZoneScoped;
+
+  BinaryBufferSaver saver;
+  saver.Open();
+
+  u32 version = fileVersion;
+  saver.FundamentalType(version);
+  saver.FundamentalType(patchRequired);
+
+  u32 attributeCount = rootAttributes.Size();
+  saver.FundamentalType(attributeCount);
+  forRange (DataAttribute& attribute, rootAttributes)
+  {
+    SaveString(saver, attribute.mName);
+    SaveString(saver, attribute.mValue);
+  }
+
+  u32 rootCount = fileRoot->mNumberOfChildren;
+  saver.FundamentalType(rootCount);
+  forRange (DataNode& root, fileRoot->GetChildren())
+    SaveNode(saver, &root);
+
+  u32 end = BinaryEndSignature;
+  saver.FundamentalType(end);
+
+  uint size = saver.GetSize();
+  byte* buffer = (byte*)plAllocate(size);
+  saver.ExtractInto(buffer, size);
+  DiskCache::Save(GetCachePath(data), cDataTreeCacheSignature, cDataTreeCacheVersion, buffer, size);
+  plDeallocate(buffer);
+}
+
+String DataTreeCache::GetCachePath(StringRange data)
+{
+  String fileName = BuildString(Sha1Builder::GetHashString(data), ".bin");
+  return FilePath::Combine(sDirectory, fileName);
+}
+
+} // namespace Plasma
@@ -0,0 +1,46 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Plasma
+{
+
+class DataNode;
+
+/// Keeps the parsed data trees of data files (levels, archetypes, ...) on disk
+/// in binary, so loading an unchanged file skips tokenizing and parsing its text.
+/// Cached trees are keyed by a hash of the file's text, and are stored before
+/// data inheritance is patched in so changes to the inherited data still apply.
+class DataTreeCache
+{
+public:
+  /// Sets the directory cached trees are stored in. Caching is disabled while
+  /// the directory is empty. The directory should be unique to the engine
+  /// version, as trees cached by other versions are not detected. The oldest
+  /// trees in the directory are deleted if it has grown past its size limit.
+  static void SetDirectory(StringParam directory);
+  static String GetDirectory();
+
+  /// Loads the cached tree of the given text into the file root and appends
+  /// the cached root attributes. Returns false if the text has not been cached.
+  static bool Load(StringRange data,
+                   uint* fileVersion,
+                   bool* patchRequired,
+                   DataAttributes& rootAttributes,
+                   DataNode* fileRoot);
+
+  /// Caches the tree parsed from the given text. The file root must not have
+  /// been patched yet.
+  static void Save(StringRange data,
+                   uint fileVersion,
+                   bool patchRequired,
+                   DataAttributes::range rootAttributes,
+                   DataNode* fileRoot);
+
+private:
+  /// Returns the path the tree of the given text is cached at.
+  static String GetCachePath(StringRange data);
+
+  static String sDirectory;
+};
+
+} // namespace Plasma
@@ -868,8 +868,13 @@ void Compare(DataNode* lhs, DataNode* rhs)
   }
 }
 
-bool ReadDataSet(
-    Status& status, StringRange data, StringParam source, DataTreeLoader* loader, uint* fileVersion, DataNode* fileRoot)
+bool ReadDataSet(Status& status,
+                 StringRange data,
+                 StringParam source,
+                 DataTreeLoader* loader,
+                 uint* fileVersion,
+                 DataNode* fileRoot,
+                 bool cacheTree)
 {
   ZoneScoped;
   ProfileScopeFunctionArgs(source);
@@ -877,37 +882,55 @@ bool ReadDataSet(
   parseContext.Filename = source;
   parseContext.Loader = loader;
 
-  // Load the data tree with the correct parser
-  *fileVersion = GetFileVersion(data);
+  // Skip parsing if the tree has already been cached
+  bool cached = false;
+  if (cacheTree)
+    cached = DataTreeCache::Load(data, fileVersion, &parseContext.PatchRequired, loader->mRootAttributes, fileRoot);
 
-  if (*fileVersion == DataVersion::Legacy)
+  if (!cached)
   {
-    // Legacy format only supported a single root
-    DataNode* root = LegacyDataTreeParser::BuildTree(parseContext, data);
-    if (root == nullptr)
+    uint rootAttributeCount = loader->mRootAttributes.Size();
+
+    // Load the data tree with the correct parser
+    *fileVersion = GetFileVersion(data);
+
+    if (*fileVersion == DataVersion::Legacy)
     {
-      status.SetFailed("Failed to parse legacy file format");
+      // Legacy format only supported a single root
+      DataNode* root = LegacyDataTreeParser::BuildTree(parseContext, data);
+      if (root == nullptr)
+      {
+        status.SetFailed("Failed to parse legacy file format");
+        return false;
+      }
+      root->AttachTo(fileRoot);
+    }
+    else
+    {
+      DataTreeParser::BuildTree(parseContext, data, fileRoot);
+    }
+
+    // Failed to read file
+    if (fileRoot->mChildren.Empty())
+    {
+      status.SetFailed("Failed to parse root element.", ParseErrorCodes::ParsingError);
       return false;
     }
-    root->AttachTo(fileRoot);
-  }
-  else
-  {
-    DataTreeParser::BuildTree(parseContext, data, fileRoot);
-  }
 
-  // Failed to read file
-  if (fileRoot->mChildren.Empty())
-  {
-    status.SetFailed("Failed to parse root element.", ParseErrorCodes::ParsingError);
-    return false;
-  }
+    // Check for parse error
+    if (parseContext.Error)
+    {
+      status.SetFailed(parseContext.Message, ParseErrorCodes::ParsingError);
+      return false;
+    }
 
-  // Check for parse error
-  if (parseContext.Error)
-  {
-    status.SetFailed(parseContext.Message, ParseErrorCodes::ParsingError);
-    return false;
+    // Cache the tree before patching modifies it
+    if (cacheTree)
+    {
+      DataAttributes::range rootAttributes = loader->mRootAttributes.SubRange(
+          rootAttributeCount, loader->mRootAttributes.Size() - rootAttributeCount);
+      DataTreeCache::Save(data, *fileVersion, parseContext.PatchRequired, rootAttributes, fileRoot);
+    }
   }
 
   // Patch the tree if required
@@ -210,11 +210,15 @@ public:
   Guid mUniqueNodeId;
 };
 
+/// Parses the data into the file root and patches in inherited data. If
+/// 'cacheTree' is set, the parsed tree is loaded from and saved to the
+/// DataTreeCache.
 bool ReadDataSet(Status& status,
                  StringRange data,
                  StringParam source,
                  DataTreeLoader* loader,
                  uint* fileVersion,
-                 DataNode* fileRoot);
+                 DataNode* fileRoot,
+                 bool cacheTree = false);
 
 } // namespace Plasma
@@ -141,6 +141,15 @@ public:
   template <typename CallbackType>
   void QuerySelfTree(CallbackType* callback);
 
+  /// Splits QuerySelfTree into roughly the desired number of node pairs that
+  /// can be queried on different threads with QuerySelfTask.
+  void SplitSelfQuery(uint desiredTaskCount, NodePairArray& tasks);
+
+  /// Callback is expected to have a method called
+  /// QueryCallback(NodeType* node1, NodeType* node2) (world space trees)
+  template <typename CallbackType>
+  void QuerySelfTask(CallbackType* callback, NodePair task);
+
   /// Callback is expected to have a method called
   /// QueryCallback(NodeType* thisNode, NodeType* otherNode) (world space trees)
   template <typename CallbackType>
@@ -266,6 +266,19 @@ void BaseDynamicAabbTree<PolicyType>::QuerySelfTree(CallbackType* callback)
   TreeSelfQuery(callback, mRoot);
 }
 
+template <typename PolicyType>
+void BaseDynamicAabbTree<PolicyType>::SplitSelfQuery(uint desiredTaskCount, NodePairArray& tasks)
+{
+  SplitTreeSelfQuery(mRoot, desiredTaskCount, tasks);
+}
+
+template <typename PolicyType>
+template <typename CallbackType>
+void BaseDynamicAabbTree<PolicyType>::QuerySelfTask(CallbackType* callback, NodePair task)
+{
+  TreeSelfQueryTask(callback, task);
+}
+
 template <typename PolicyType>
 template <typename CallbackType>
 void BaseDynamicAabbTree<PolicyType>::QueryTree(CallbackType* callback, const BaseTreeType* tree)
@@ -34,6 +34,13 @@ public:
   virtual void SelfQuery(ClientPairArray& results);
   virtual void Query(BroadPhaseData& data, ClientPairArray& results);
   virtual void BatchQuery(BroadPhaseDataArray& data, ClientPairArray& results);
+  /// Queries only walk the tree with a stack allocated scratch buffer.
+  virtual bool SupportsParallelQueries()
+  {
+    return true;
+  }
+  virtual uint SplitSelfQuery(uint desiredTaskCount);
+  virtual void SelfQueryTask(uint taskIndex, ClientPairArray& results);
 
   virtual void Construct(){};
 
@@ -50,6 +57,15 @@ public:
 public:
   void QueryCallback(void* thisProxy, void* otherProxy);
 
+  /// Adds the pairs of a self query task straight to the results. Every pair
+  /// of leaves is only found once, so unlike QueryCallback no set is needed.
+  struct TaskCallback
+  {
+    void QueryCallback(NodeType* node1, NodeType* node2);
+
+    ClientPairArray* mResults;
+  };
+
 protected:
   void SingleObjectQuery();
   void PartialTreeQuery();
@@ -73,6 +89,9 @@ protected:
   typedef HashSet<NodePointerPair> PairSet;
   PairSet mPairs;
 
+  /// The tasks from the last SplitSelfQuery.
+  typename TreeType::NodePairArray mSelfQueryTasks;
+
   BaseDAabbTreeSelfQuery::Enum mSelfQueryPolicy;
 
   // remove later or something...
@@ -109,8 +109,9 @@ void BaseDynamicAabbTreeBroadPhase<TreeType>::UpdateProxies(BroadPhaseObjectArra
 template <typename TreeType>
 void BaseDynamicAabbTreeBroadPhase<TreeType>::SelfQuery(ClientPairArray& results)
 {
-  // should self query clear the pair results? means we can't do
-  // multiple queries and then there is no point to having register collisions
+  // The pairs are found here rather than in RegisterCollisions so that
+  // SplitSelfQuery can find them on multiple threads instead
+  FullTreeQuery();
   FillOutResults(results);
 }
 
@@ -129,6 +130,21 @@ void BaseDynamicAabbTreeBroadPhase<TreeType>::BatchQuery(BroadPhaseDataArray& da
     SelfType::Query(dataRange.Front(), results);
 }
 
+template <typename TreeType>
+uint BaseDynamicAabbTreeBroadPhase<TreeType>::SplitSelfQuery(uint desiredTaskCount)
+{
+  mTree.SplitSelfQuery(desiredTaskCount, mSelfQueryTasks);
+  return mSelfQueryTasks.Size();
+}
+
+template <typename TreeType>
+void BaseDynamicAabbTreeBroadPhase<TreeType>::SelfQueryTask(uint taskIndex, ClientPairArray& results)
+{
+  TaskCallback callback;
+  callback.mResults = &results;
+  mTree.QuerySelfTask(&callback, mSelfQueryTasks[taskIndex]);
+}
+
 template <typename TreeType>
 void BaseDynamicAabbTreeBroadPhase<TreeType>::CastRay(CastDataParam data, ProxyCastResults& results)
 {
@@ -172,10 +188,6 @@ void BaseDynamicAabbTreeBroadPhase<TreeType>::CastFrustum(CastDataParam data, Pr
 template <typename TreeType>
 void BaseDynamicAabbTreeBroadPhase<TreeType>::RegisterCollisions()
 {
-  mPairs.Clear();
-
-  FullTreeQuery();
-
   // Temporarily Disabled: Leaks in the editor because nothing cleans up
   // mNodesToQuery
 
@@ -195,6 +207,7 @@ void BaseDynamicAabbTreeBroadPhase<TreeType>::RegisterCollisions()
   //
   // mNodesToQuery.Clear();
 
+  // Improve the tree before the self query walks it
   mTree.Rebalance(4);
 }
 
@@ -211,6 +224,15 @@ void BaseDynamicAabbTreeBroadPhase<TreeType>::QueryCallback(void* thisProxy, voi
   mPairs.Insert(NodePointerPair(thisProxy, otherProxy));
 }
 
+template <typename TreeType>
+void BaseDynamicAabbTreeBroadPhase<TreeType>::TaskCallback::QueryCallback(NodeType* node1, NodeType* node2)
+{
+  // Same order as NodePointerPair so both queries report the same pairs
+  if (node2 < node1)
+    Swap(node1, node2);
+  mResults->PushBack(ClientPair(node1->mClientData, node2->mClientData));
+}
+
 template <typename TreeType>
 void BaseDynamicAabbTreeBroadPhase<TreeType>::SingleObjectQuery()
 {
@@ -57,6 +57,25 @@ public:
   /// Batch version of Query.
   virtual void BatchQuery(BroadPhaseDataArray& data, ClientPairArray& results);
 
+  /// Whether Query only reads the BroadPhase, so it can be called from
+  /// multiple threads at once.
+  virtual bool SupportsParallelQueries()
+  {
+    return false;
+  }
+  /// Splits the next SelfQuery into roughly the desired number of tasks that
+  /// can run on different threads. Returns the number of tasks, where 0 means
+  /// the BroadPhase can't split its self query (use SelfQuery instead).
+  virtual uint SplitSelfQuery(uint desiredTaskCount)
+  {
+    return 0;
+  }
+  /// Finds the pairs of one task from SplitSelfQuery. Together the tasks
+  /// report the same pairs as SelfQuery.
+  virtual void SelfQueryTask(uint taskIndex, ClientPairArray& results)
+  {
+  }
+
   /// Tells the structure that it has all of the data it will ever have. Used
   /// mainly for static BroadPhases.
   virtual void Construct();
@@ -0,0 +1,131 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+namespace
+{
+const uint cBenchmarkSeed = 1234;
+// Average space around each object, keeps the number of pairs per object about
+// the same no matter how many objects there are.
+const real cVolumePerObject = real(8.0);
+} // namespace
+
+BroadPhaseBenchmarkResults::BroadPhaseBenchmarkResults() :
+    mCreateMs(0.0),
+    mUpdateMs(0.0),
+    mSelfQueryMs(0.0),
+    mQueryMs(0.0),
+    mPairCount(0)
+{
+}
+
+// Moves the object and bounces it off the edges of the world.
+static void StepBenchmarkObject(BroadPhaseData& data, Vec3& velocity, real worldHalfSize)
+{
+  Vec3 center = data.mAabb.GetCenter() + velocity;
+  Vec3 halfExtents = data.mAabb.GetHalfExtents();
+  for (uint axis = 0; axis < 3; ++axis)
+  {
+    if (Math::Abs(center[axis]) > worldHalfSize)
+    {
+      center[axis] = Math::Clamp(center[axis], -worldHalfSize, worldHalfSize);
+      velocity[axis] = -velocity[axis];
+    }
+  }
+
+  data.mAabb = Aabb(center, halfExtents);
+  data.mBoundingSphere = Sphere(center, Math::Length(halfExtents));
+}
+
+bool RunBroadPhaseBenchmark(StringParam broadPhaseName,
+                            uint objectCount,
+                            uint frameCount,
+                            BroadPhaseBenchmarkResults& results)
+{
+  IBroadPhase* broadPhase = PL::gBroadPhaseLibrary->CreateBroadPhase(broadPhaseName);
+  if (broadPhase == nullptr)
+    return false;
+
+  real worldHalfSize = real(0.5) * Math::Pow(cVolumePerObject * real(objectCount), real(1.0 / 3.0));
+
+  Math::Random random(cBenchmarkSeed);
+  Array<BroadPhaseProxy> proxies;
+  Array<Vec3> velocities;
+  BroadPhaseObjectArray objects;
+  BroadPhaseDataArray queryData;
+  proxies.Resize(objectCount);
+  velocities.Resize(objectCount);
+  objects.Resize(objectCount);
+  queryData.Resize(objectCount);
+
+  for (uint i = 0; i < objectCount; ++i)
+  {
+    Vec3 center;
+    Vec3 halfExtents;
+    for (uint axis = 0; axis < 3; ++axis)
+    {
+      center[axis] = random.FloatRange(-worldHalfSize, worldHalfSize);
+      halfExtents[axis] = random.FloatRange(real(0.25), real(1.0));
+      velocities[i][axis] = random.FloatRange(real(-0.1), real(0.1));
+    }
+
+    BroadPhaseObject& object = objects[i];
+    object.mProxy = &proxies[i];
+    object.mData.mAabb = Aabb(center, halfExtents);
+    object.mData.mBoundingSphere = Sphere(center, Math::Length(halfExtents));
+    // Only used to identify the object in the pairs, never dereferenced
+    object.mData.mClientData = (void*)(size_t)(i + 1);
+  }
+
+  Timer timer;
+  const double cMillisecondsPerSecond = 1000.0;
+
+  timer.Reset();
+  broadPhase->CreateProxies(objects);
+  results.mCreateMs = timer.UpdateAndGetTime() * cMillisecondsPerSecond;
+
+  double updateTime = 0.0;
+  double selfQueryTime = 0.0;
+  double queryTime = 0.0;
+  ClientPairArray pairs;
+  for (uint frame = 0; frame < frameCount; ++frame)
+  {
+    for (uint i = 0; i < objectCount; ++i)
+    {
+      StepBenchmarkObject(objects[i].mData, velocities[i], worldHalfSize);
+      queryData[i] = objects[i].mData;
+    }
+
+    timer.Reset();
+    broadPhase->UpdateProxies(objects);
+    broadPhase->RegisterCollisions();
+    updateTime += timer.UpdateAndGetTime();
+
+    pairs.Clear();
+    timer.Reset();
+    broadPhase->SelfQuery(pairs);
+    selfQueryTime += timer.UpdateAndGetTime();
+    results.mPairCount = pairs.Size();
+
+    pairs.Clear();
+    timer.Reset();
+    broadPhase->BatchQuery(queryData, pairs);
+    queryTime += timer.UpdateAndGetTime();
+
+    broadPhase->Cleanup();
+  }
+
+  if (frameCount != 0)
+  {
+    results.mUpdateMs = updateTime * cMillisecondsPerSecond / frameCount;
+    results.mSelfQueryMs = selfQueryTime * cMillisecondsPerSecond / frameCount;
+    results.mQueryMs = queryTime * cMillisecondsPerSecond / frameCount;
+  }
+
+  delete broadPhase;
+  return true;
+}
+
+} // namespace Plasma
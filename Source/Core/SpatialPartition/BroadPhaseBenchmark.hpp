@@ -0,0 +1,36 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Plasma
+{
+
+/// Timings of one BroadPhase from RunBroadPhaseBenchmark. All times are in
+/// milliseconds, the per frame times are averaged over every frame.
+class BroadPhaseBenchmarkResults
+{
+public:
+  BroadPhaseBenchmarkResults();
+
+  /// Inserting every object with CreateProxies.
+  double mCreateMs;
+  /// Moving every object with UpdateProxies and RegisterCollisions.
+  double mUpdateMs;
+  /// Finding the overlapping pairs with SelfQuery.
+  double mSelfQueryMs;
+  /// Querying every object against the BroadPhase (as if it were static).
+  double mQueryMs;
+  /// Pairs found by the last SelfQuery. Every BroadPhase run on the same
+  /// scene should find the same number.
+  size_t mPairCount;
+};
+
+/// Runs a deterministic scene of moving Aabbs through the given BroadPhase the
+/// way PhysicsSpace drives its dynamic BroadPhase each frame. The scene only
+/// depends on the object and frame counts so the results of different
+/// BroadPhases can be compared. Returns false if the BroadPhase doesn't exist.
+bool RunBroadPhaseBenchmark(StringParam broadPhaseName,
+                            uint objectCount,
+                            uint frameCount,
+                            BroadPhaseBenchmarkResults& results);
+
+} // namespace Plasma
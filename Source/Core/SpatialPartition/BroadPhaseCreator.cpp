@@ -31,6 +31,7 @@ BroadPhaseLibrary::BroadPhaseLibrary()
   // RegisterBroadPhase(MultiSap, dynamicOnly);
   RegisterBroadPhase(DynamicAabbTreeBroadPhase, DynamicBit | StaticBit);
   RegisterBroadPhase(AvlDynamicAabbTreeBroadPhase, DynamicBit | StaticBit);
+  RegisterBroadPhase(SoaDynamicAabbTreeBroadPhase, DynamicBit | StaticBit);
 }
 
 BroadPhaseLibrary::~BroadPhaseLibrary()
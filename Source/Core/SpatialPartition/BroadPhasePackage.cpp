@@ -164,6 +164,21 @@ void BroadPhasePackage::QueryBoth(BroadPhaseData& data, ClientPairArray& results
   mBroadPhases[BroadPhase::Dynamic]->Query(data, results);
 }
 
+bool BroadPhasePackage::SupportsParallelQueries()
+{
+  return mBroadPhases[BroadPhase::Static]->SupportsParallelQueries();
+}
+
+uint BroadPhasePackage::SplitSelfQuery(uint desiredTaskCount)
+{
+  return mBroadPhases[BroadPhase::Dynamic]->SplitSelfQuery(desiredTaskCount);
+}
+
+void BroadPhasePackage::SelfQueryTask(uint taskIndex, ClientPairArray& results)
+{
+  mBroadPhases[BroadPhase::Dynamic]->SelfQueryTask(taskIndex, results);
+}
+
 void BroadPhasePackage::Construct()
 {
   mBroadPhases[BroadPhase::Static]->Construct();
@@ -70,6 +70,14 @@ public:
   /// Queries both the dynamic and static broadphase.
   virtual void QueryBoth(BroadPhaseData& data, ClientPairArray& results);
 
+  /// Whether Query can be called from multiple threads at once.
+  virtual bool SupportsParallelQueries();
+  /// Splits the dynamic broadphase's self query into tasks that can run on
+  /// different threads. Returns 0 if it can't be split.
+  virtual uint SplitSelfQuery(uint desiredTaskCount);
+  /// Finds the pairs of one task from SplitSelfQuery.
+  virtual void SelfQueryTask(uint taskIndex, ClientPairArray& results);
+
   /// Tells the structure that it has all of the data it will ever have. Used
   /// mainly for static BroadPhases.
   virtual void Construct();
@@ -118,6 +118,16 @@ public:
   /// Queries both the dynamic and static broadphase.
   void QueryBoth(BroadPhaseData& data, ClientPairArray& results) override;
 
+  /// Every tracked broad phase is queried in turn, so queries stay on one thread.
+  bool SupportsParallelQueries() override
+  {
+    return false;
+  }
+  uint SplitSelfQuery(uint desiredTaskCount) override
+  {
+    return 0;
+  }
+
   /// Tells the structure that it has all of the data it will ever have. Used
   /// mainly for static BroadPhases.
   virtual void Construct();
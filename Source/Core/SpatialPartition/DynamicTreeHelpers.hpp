@@ -65,6 +65,96 @@ void TreeSelfQuery(CallbackType* callback, NodeType* root)
   }
 }
 
+/// Expands one pair of a tree's self query into the overlapping pairs below it,
+/// where a pair of the same node stands for all pairs within that subtree.
+/// Returns true if the pair is two overlapping leaves that can't be expanded.
+template <typename NodeType>
+bool ExpandTreeSelfQueryPair(Pair<NodeType*, NodeType*> pair, Array<Pair<NodeType*, NodeType*>>& pairs)
+{
+  NodeType* nodeA = pair.first;
+  NodeType* nodeB = pair.second;
+  if (nodeA == nodeB)
+  {
+    if (nodeA->IsLeaf())
+      return false;
+
+    pairs.PushBack(MakePair(nodeA->mChild2, nodeA->mChild2));
+    pairs.PushBack(MakePair(nodeA->mChild1, nodeA->mChild1));
+    if (nodeA->mChild1->mAabb.Overlap(nodeA->mChild2->mAabb))
+      pairs.PushBack(MakePair(nodeA->mChild1, nodeA->mChild2));
+    return false;
+  }
+
+  if (nodeA->IsLeaf() && nodeB->IsLeaf())
+    return true;
+
+  // Split every internal side and keep the pairs of children that still overlap
+  NodeType* childrenA[2] = {nodeA, nullptr};
+  NodeType* childrenB[2] = {nodeB, nullptr};
+  if (!nodeA->IsLeaf())
+  {
+    childrenA[0] = nodeA->mChild1;
+    childrenA[1] = nodeA->mChild2;
+  }
+  if (!nodeB->IsLeaf())
+  {
+    childrenB[0] = nodeB->mChild1;
+    childrenB[1] = nodeB->mChild2;
+  }
+
+  for (uint i = 0; i < 2 && childrenA[i] != nullptr; ++i)
+  {
+    for (uint j = 0; j < 2 && childrenB[j] != nullptr; ++j)
+    {
+      if (childrenA[i]->mAabb.Overlap(childrenB[j]->mAabb))
+        pairs.PushBack(MakePair(childrenA[i], childrenB[j]));
+    }
+  }
+  return false;
+}
+
+/// Splits the self query of the tree into roughly the desired number of pairs
+/// that can be queried on different threads with TreeSelfQueryTask.
+template <typename NodeType>
+void SplitTreeSelfQuery(NodeType* root, uint desiredTaskCount, Array<Pair<NodeType*, NodeType*>>& tasks)
+{
+  tasks.Clear();
+  if (root == nullptr)
+    return;
+
+  // Expand breadth first so the tasks cover subtrees of about the same size. Pairs
+  // of leaves can't be split any further so they become tasks of their own.
+  Array<Pair<NodeType*, NodeType*>> queue;
+  queue.PushBack(MakePair(root, root));
+  uint head = 0;
+  while (head < queue.Size() && tasks.Size() + queue.Size() - head < desiredTaskCount)
+  {
+    Pair<NodeType*, NodeType*> task = queue[head++];
+    if (ExpandTreeSelfQueryPair(task, queue))
+      tasks.PushBack(task);
+  }
+
+  tasks.Append(queue.SubRange(head, queue.Size() - head));
+}
+
+/// Reports the overlapping leaves of one pair from SplitTreeSelfQuery. Unlike
+/// TreeSelfQuery this only uses its own stack, so tasks can run at the same time.
+template <typename CallbackType, typename NodeType>
+void TreeSelfQueryTask(CallbackType* callback, Pair<NodeType*, NodeType*> task)
+{
+  Array<Pair<NodeType*, NodeType*>> stack;
+  stack.PushBack(task);
+
+  while (!stack.Empty())
+  {
+    Pair<NodeType*, NodeType*> pair = stack.Back();
+    stack.PopBack();
+
+    if (ExpandTreeSelfQueryPair(pair, stack))
+      callback->QueryCallback(pair.first, pair.second);
+  }
+}
+
 template <typename CallbackType, typename NodeType>
 void QueryTreeVsTree(CallbackType* callback, NodeType* rootA, NodeType* rootB)
 {
@@ -0,0 +1,451 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+namespace SoaDynamicAabbTreeInternal
+{
+
+Aabb Fatten(const Aabb& aabb)
+{
+  // Same margin as the pointer based trees so the broad phases are interchangeable.
+  Vec3 halfExtents = aabb.GetHalfExtents();
+  halfExtents = Math::Min(halfExtents + BaseDynamicTreeInternal::cAabbFatFactor,
+                          halfExtents * BaseDynamicTreeInternal::cAabbFatScaleFactor);
+  Aabb fatAabb;
+  fatAabb.SetCenterAndHalfExtents(aabb.GetCenter(), halfExtents);
+  return fatAabb;
+}
+
+Aabb Validated(const Aabb& aabb)
+{
+  Aabb result = aabb;
+  if (!result.Valid())
+  {
+    Error("Invalid Aabb inserted");
+
+    // We got the assert (good) but we don't want to keep getting it every frame
+    result.AttemptToCorrectInvalid();
+  }
+  return result;
+}
+
+} // namespace SoaDynamicAabbTreeInternal
+
+SoaDynamicAabbTree::SoaDynamicAabbTree() :
+    mRoot(cInvalidIndex),
+    mFreeList(cInvalidIndex),
+    mProxyCount(0),
+    mRebuildCursor(0)
+{
+}
+
+u32 SoaDynamicAabbTree::CreateProxy(const Aabb& aabb, void* clientData)
+{
+  u32 leaf = AllocateNode();
+  mNodes[leaf].mClientData = clientData;
+  mAabbs[leaf] = SoaDynamicAabbTreeInternal::Fatten(SoaDynamicAabbTreeInternal::Validated(aabb));
+
+  InsertLeaf(leaf);
+  ++mProxyCount;
+  return leaf;
+}
+
+void SoaDynamicAabbTree::RemoveProxy(u32 leaf)
+{
+  ErrorIf(!mNodes[leaf].IsLeaf(), "Can only remove leaf nodes.");
+
+  RemoveLeaf(leaf);
+  FreeNode(leaf);
+  --mProxyCount;
+}
+
+bool SoaDynamicAabbTree::UpdateProxy(u32 leaf, const Aabb& aabb, void* clientData)
+{
+  // there could be an update where our client data changed
+  // so make sure to update it (ie. a remove->Insert)
+  mNodes[leaf].mClientData = clientData;
+
+  // our old Aabb contained our new one, so we don't have to do anything
+  Aabb newAabb = SoaDynamicAabbTreeInternal::Validated(aabb);
+  Aabb& fatAabb = mAabbs[leaf];
+  if (fatAabb.ContainsPoint(newAabb.mMin) && fatAabb.ContainsPoint(newAabb.mMax))
+    return false;
+
+  RemoveLeaf(leaf);
+  mAabbs[leaf] = SoaDynamicAabbTreeInternal::Fatten(newAabb);
+  InsertLeaf(leaf);
+  return true;
+}
+
+void* SoaDynamicAabbTree::GetClientData(u32 leaf) const
+{
+  return mNodes[leaf].mClientData;
+}
+
+const Aabb& SoaDynamicAabbTree::GetFatAabb(u32 leaf) const
+{
+  return mAabbs[leaf];
+}
+
+uint SoaDynamicAabbTree::GetTotalProxyCount() const
+{
+  return mProxyCount;
+}
+
+uint SoaDynamicAabbTree::GetHeight() const
+{
+  if (mRoot == cInvalidIndex)
+    return 0;
+  return static_cast<uint>(mNodes[mRoot].mHeight);
+}
+
+void SoaDynamicAabbTree::Rebuild(uint leafCount)
+{
+  if (mProxyCount < 2)
+    return;
+
+  // Leaves never change index so the cursor stays meaningful between calls. Internal
+  // nodes freed by the removal are reused by the insertion.
+  uint reinserted = 0;
+  for (uint visited = 0; visited < mNodes.Size() && reinserted < leafCount; ++visited)
+  {
+    if (mRebuildCursor >= mNodes.Size())
+      mRebuildCursor = 0;
+
+    u32 index = mRebuildCursor++;
+    if (!mNodes[index].IsLeaf())
+      continue;
+
+    RemoveLeaf(index);
+    InsertLeaf(index);
+    ++reinserted;
+  }
+}
+
+bool SoaDynamicAabbTree::SplitSelfQuery(uint desiredTaskCount, Array<SelfQueryTask>& tasks) const
+{
+  tasks.Clear();
+  if (mRoot == cInvalidIndex)
+    return false;
+
+  // Expand breadth first so the tasks cover subtrees of about the same size. Pairs
+  // of leaves can't be split any further so they become tasks of their own.
+  Array<SelfQueryTask> queue;
+  queue.PushBack(SelfQueryTask(mRoot, mRoot));
+  uint head = 0;
+  while (head < queue.Size() && tasks.Size() + queue.Size() - head < desiredTaskCount)
+  {
+    SelfQueryTask task = queue[head++];
+    if (ExpandSelfQueryTask(task, queue))
+      tasks.PushBack(task);
+  }
+
+  tasks.Append(queue.SubRange(head, queue.Size() - head));
+  return !tasks.Empty();
+}
+
+void SoaDynamicAabbTree::Clear()
+{
+  mNodes.Clear();
+  mAabbs.Clear();
+  mRoot = cInvalidIndex;
+  mFreeList = cInvalidIndex;
+  mProxyCount = 0;
+  mRebuildCursor = 0;
+}
+
+void SoaDynamicAabbTree::Draw(int level)
+{
+  if (mRoot == cInvalidIndex)
+    return;
+
+  Array<Pair<u32, int>> stack;
+  stack.PushBack(Pair<u32, int>(mRoot, 0));
+  while (!stack.Empty())
+  {
+    Pair<u32, int> entry = stack.Back();
+    stack.PopBack();
+
+    if (level == -1 || entry.second == level)
+      gDebugDraw->Add(Debug::Obb(mAabbs[entry.first]).Color(Color::MintCream));
+
+    SoaAabbTreeNode& node = mNodes[entry.first];
+    if (node.IsLeaf() || entry.second == level)
+      continue;
+
+    stack.PushBack(Pair<u32, int>(node.mChildren[0], entry.second + 1));
+    stack.PushBack(Pair<u32, int>(node.mChildren[1], entry.second + 1));
+  }
+}
+
+void SoaDynamicAabbTree::Validate()
+{
+  if (mRoot == cInvalidIndex)
+    return;
+
+  ErrorIf(mNodes[mRoot].mParent != cInvalidIndex, "Root should have an invalid parent.");
+
+  uint leafCount = 0;
+  Array<u32> stack;
+  stack.PushBack(mRoot);
+  while (!stack.Empty())
+  {
+    u32 index = stack.Back();
+    stack.PopBack();
+
+    SoaAabbTreeNode& node = mNodes[index];
+    if (node.IsLeaf())
+    {
+      ++leafCount;
+      continue;
+    }
+
+    ErrorIf(node.mHeight < 0, "Free node linked into the tree.");
+    for (uint i = 0; i < 2; ++i)
+    {
+      u32 child = node.mChildren[i];
+      ErrorIf(mNodes[child].mParent != index, "Child has the wrong parent.");
+
+      Aabb& parent = mAabbs[index];
+      Aabb& childAabb = mAabbs[child];
+      ErrorIf(!parent.ContainsPoint(childAabb.mMax) || !parent.ContainsPoint(childAabb.mMin),
+              "Parent Aabb does not contain a child.");
+
+      Aabb slotAabb = GetChildAabb(node, i);
+      ErrorIf(slotAabb.mMin != childAabb.mMin || slotAabb.mMax != childAabb.mMax,
+              "Child bounds stored in the parent are out of date.");
+      stack.PushBack(child);
+    }
+
+    s32 expectedHeight = 1 + Math::Max(mNodes[node.mChildren[0]].mHeight, mNodes[node.mChildren[1]].mHeight);
+    ErrorIf(node.mHeight != expectedHeight, "Node height is out of date.");
+  }
+
+  ErrorIf(leafCount != mProxyCount, "Tree does not contain every proxy.");
+}
+
+u32 SoaDynamicAabbTree::AllocateNode()
+{
+  u32 index = mFreeList;
+  if (index != cInvalidIndex)
+  {
+    mFreeList = mNodes[index].mParent;
+  }
+  else
+  {
+    index = mNodes.Size();
+    mNodes.PushBack();
+    mAabbs.PushBack();
+  }
+
+  SoaAabbTreeNode& node = mNodes[index];
+  node.mChildren[0] = node.mChildren[1] = cInvalidIndex;
+  node.mParent = cInvalidIndex;
+  node.mHeight = 0;
+  node.mClientData = nullptr;
+  return index;
+}
+
+void SoaDynamicAabbTree::FreeNode(u32 index)
+{
+  SoaAabbTreeNode& node = mNodes[index];
+  node.mHeight = -1;
+  node.mParent = mFreeList;
+  mFreeList = index;
+}
+
+void SoaDynamicAabbTree::InsertLeaf(u32 leaf)
+{
+  // if we have no root, then this node is the root
+  if (mRoot == cInvalidIndex)
+  {
+    mRoot = leaf;
+    mNodes[leaf].mParent = cInvalidIndex;
+    return;
+  }
+
+  // Walk down to the sibling with the lowest surface area cost. The inherited cost
+  // is the growth of every node above that has to be enlarged to hold the leaf.
+  Aabb leafAabb = mAabbs[leaf];
+  u32 index = mRoot;
+  while (!mNodes[index].IsLeaf())
+  {
+    real area = mAabbs[index].GetSurfaceArea();
+    real combinedArea = mAabbs[index].Combined(leafAabb).GetSurfaceArea();
+
+    // Cost of making a new parent for this node and the leaf.
+    real cost = real(2) * combinedArea;
+    real inheritedCost = real(2) * (combinedArea - area);
+
+    real childCosts[2];
+    for (uint i = 0; i < 2; ++i)
+    {
+      u32 child = mNodes[index].mChildren[i];
+      real mergedArea = mAabbs[child].Combined(leafAabb).GetSurfaceArea();
+      if (mNodes[child].IsLeaf())
+        childCosts[i] = mergedArea + inheritedCost;
+      else
+        childCosts[i] = mergedArea - mAabbs[child].GetSurfaceArea() + inheritedCost;
+    }
+
+    if (cost < childCosts[0] && cost < childCosts[1])
+      break;
+
+    index = mNodes[index].mChildren[childCosts[0] < childCosts[1] ? 0 : 1];
+  }
+
+  // all our objects must be on leaf nodes, so we have
+  // to make a new internal node to put the sibling and the new leaf
+  u32 sibling = index;
+  u32 oldParent = mNodes[sibling].mParent;
+  u32 newParent = AllocateNode();
+
+  SoaAabbTreeNode& parentNode = mNodes[newParent];
+  parentNode.mParent = oldParent;
+  parentNode.mChildren[0] = sibling;
+  parentNode.mChildren[1] = leaf;
+  mNodes[sibling].mParent = newParent;
+  mNodes[leaf].mParent = newParent;
+
+  if (oldParent == cInvalidIndex)
+    mRoot = newParent;
+  else
+    ReplaceChild(oldParent, sibling, newParent);
+
+  Refit(newParent);
+}
+
+void SoaDynamicAabbTree::RemoveLeaf(u32 leaf)
+{
+  // deal with removing the root
+  if (leaf == mRoot)
+  {
+    mRoot = cInvalidIndex;
+    return;
+  }
+
+  u32 parent = mNodes[leaf].mParent;
+  u32 grandParent = mNodes[parent].mParent;
+  SoaAabbTreeNode& parentNode = mNodes[parent];
+  u32 sibling = parentNode.mChildren[0] == leaf ? parentNode.mChildren[1] : parentNode.mChildren[0];
+
+  // if our parent is the root, then our sibling will have to
+  // become the new root
+  if (grandParent == cInvalidIndex)
+  {
+    mRoot = sibling;
+    mNodes[sibling].mParent = cInvalidIndex;
+    FreeNode(parent);
+    return;
+  }
+
+  // set our sibling to be where our old parent was, then shrink the nodes above
+  ReplaceChild(grandParent, parent, sibling);
+  mNodes[sibling].mParent = grandParent;
+  FreeNode(parent);
+  Refit(grandParent);
+}
+
+void SoaDynamicAabbTree::Refit(u32 index)
+{
+  while (index != cInvalidIndex)
+  {
+    Rotate(index);
+    UpdateFromChildren(index);
+    index = mNodes[index].mParent;
+  }
+}
+
+void SoaDynamicAabbTree::Rotate(u32 indexA)
+{
+  SoaAabbTreeNode& nodeA = mNodes[indexA];
+  if (nodeA.mHeight < 2)
+    return;
+
+  // Consider swapping each child of A with a child of its sibling. A's Aabb stays
+  // the same, so only the area of the sibling that received the node changes.
+  u32 indexB = nodeA.mChildren[0];
+  u32 indexC = nodeA.mChildren[1];
+
+  real bestCost = real(0);
+  u32 bestChild = cInvalidIndex;
+  u32 bestGrandChild = cInvalidIndex;
+  for (uint i = 0; i < 2; ++i)
+  {
+    u32 child = nodeA.mChildren[i];
+    u32 sibling = nodeA.mChildren[1 - i];
+    SoaAabbTreeNode& siblingNode = mNodes[sibling];
+    if (siblingNode.IsLeaf())
+      continue;
+
+    real area = mAabbs[sibling].GetSurfaceArea();
+    for (uint j = 0; j < 2; ++j)
+    {
+      // The child takes the grandchild's place next to the other grandchild.
+      u32 kept = siblingNode.mChildren[1 - j];
+      real cost = mAabbs[child].Combined(mAabbs[kept]).GetSurfaceArea() - area;
+      if (cost < bestCost)
+      {
+        bestCost = cost;
+        bestChild = child;
+        bestGrandChild = siblingNode.mChildren[j];
+      }
+    }
+  }
+
+  if (bestChild == cInvalidIndex)
+    return;
+
+  u32 sibling = bestChild == indexB ? indexC : indexB;
+  ReplaceChild(indexA, bestChild, bestGrandChild);
+  mNodes[bestGrandChild].mParent = indexA;
+  ReplaceChild(sibling, bestGrandChild, bestChild);
+  mNodes[bestChild].mParent = sibling;
+  UpdateFromChildren(sibling);
+}
+
+void SoaDynamicAabbTree::UpdateFromChildren(u32 index)
+{
+  SoaAabbTreeNode& node = mNodes[index];
+  u32 child0 = node.mChildren[0];
+  u32 child1 = node.mChildren[1];
+  const Aabb& a = mAabbs[child0];
+  const Aabb& b = mAabbs[child1];
+
+  mAabbs[index] = Aabb::Combine(a, b);
+  node.mHeight = 1 + Math::Max(mNodes[child0].mHeight, mNodes[child1].mHeight);
+
+  node.mChildMinXY[0] = a.mMin.x;
+  node.mChildMinXY[1] = b.mMin.x;
+  node.mChildMinXY[2] = a.mMin.y;
+  node.mChildMinXY[3] = b.mMin.y;
+  node.mChildMaxXY[0] = a.mMax.x;
+  node.mChildMaxXY[1] = b.mMax.x;
+  node.mChildMaxXY[2] = a.mMax.y;
+  node.mChildMaxXY[3] = b.mMax.y;
+  node.mChildMinZ[0] = node.mChildMinZ[2] = a.mMin.z;
+  node.mChildMinZ[1] = node.mChildMinZ[3] = b.mMin.z;
+  node.mChildMaxZ[0] = node.mChildMaxZ[2] = a.mMax.z;
+  node.mChildMaxZ[1] = node.mChildMaxZ[3] = b.mMax.z;
+}
+
+void SoaDynamicAabbTree::ReplaceChild(u32 parent, u32 oldChild, u32 newChild)
+{
+  SoaAabbTreeNode& node = mNodes[parent];
+  if (node.mChildren[0] == oldChild)
+    node.mChildren[0] = newChild;
+  else
+    node.mChildren[1] = newChild;
+}
+
+Aabb SoaDynamicAabbTree::GetChildAabb(const SoaAabbTreeNode& node, uint child) const
+{
+  Aabb aabb;
+  aabb.mMin = Vec3(node.mChildMinXY[child], node.mChildMinXY[child + 2], node.mChildMinZ[child]);
+  aabb.mMax = Vec3(node.mChildMaxXY[child], node.mChildMaxXY[child + 2], node.mChildMaxZ[child]);
+  return aabb;
+}
+
+} // namespace Plasma
@@ -0,0 +1,131 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Plasma
+{
+
+/// Node of the SoaDynamicAabbTree. Internal nodes store the Aabbs of both of
+/// their children interleaved ({child0, child1} per axis) so one simd compare
+/// tests a query against both children without touching the child nodes.
+struct SoaAabbTreeNode
+{
+  bool IsLeaf() const
+  {
+    return mHeight == 0;
+  }
+
+  // Lanes are {child0.x, child1.x, child0.y, child1.y}.
+  float mChildMinXY[4];
+  float mChildMaxXY[4];
+  // Lanes are {child0.z, child1.z, child0.z, child1.z}.
+  float mChildMinZ[4];
+  float mChildMaxZ[4];
+
+  u32 mChildren[2];
+  // The next free node while on the free list.
+  u32 mParent;
+  // Leaves have a height of 0, free nodes -1.
+  s32 mHeight;
+
+  void* mClientData;
+};
+
+/// A dynamic Aabb tree that keeps its nodes in one contiguous array and links
+/// them with 32 bit indices instead of pointers. Leaves store fat Aabbs (grown
+/// by a margin) so slowly moving objects don't have to be re-inserted every
+/// update. Inserts choose the sibling with the surface area heuristic and
+/// rotations that shrink the surface area keep the tree's quality up as objects
+/// move. Rebuild re-inserts a few leaves at a time to undo what rotations can't.
+class SoaDynamicAabbTree
+{
+public:
+  static const u32 cInvalidIndex = static_cast<u32>(-1);
+  /// A pair of nodes whose leaves still have to be checked against each other
+  /// (a node paired with itself checks all pairs within its subtree).
+  typedef Pair<u32, u32> SelfQueryTask;
+
+  SoaDynamicAabbTree();
+
+  /// Returns the index of the new leaf.
+  u32 CreateProxy(const Aabb& aabb, void* clientData);
+  void RemoveProxy(u32 leaf);
+  /// Returns false if the fat Aabb already contained the new Aabb.
+  bool UpdateProxy(u32 leaf, const Aabb& aabb, void* clientData);
+
+  void* GetClientData(u32 leaf) const;
+  const Aabb& GetFatAabb(u32 leaf) const;
+  uint GetTotalProxyCount() const;
+  uint GetHeight() const;
+
+  /// Re-inserts up to the given number of leaves, continuing where the last call
+  /// left off so that over time every leaf gets placed with the current tree.
+  void Rebuild(uint leafCount);
+  void Clear();
+
+  /// Calls callback(leafIndex) for every leaf whose fat Aabb overlaps the given Aabb.
+  template <typename CallbackType>
+  void QueryAabb(const Aabb& aabb, CallbackType& callback) const;
+  /// Calls callback(leafIndex) for every leaf whose fat Aabb overlaps the query
+  /// object according to policy.Overlap(queryObj, aabb).
+  template <typename QueryType, typename Policy, typename CallbackType>
+  void Query(QueryType& queryObj, Policy policy, CallbackType& callback) const;
+
+  /// Calls callback(leafA, leafB) once for every pair of overlapping leaves,
+  /// with leafA always being the lower index.
+  template <typename CallbackType>
+  void QuerySelf(CallbackType& callback) const;
+  /// Same as QuerySelf, but only for the pairs covered by the given task.
+  template <typename CallbackType>
+  void QuerySelf(SelfQueryTask task, CallbackType& callback) const;
+  /// Splits the self query into at least the desired number of independent tasks
+  /// (unless the tree is too small). Returns false if there's nothing to query.
+  bool SplitSelfQuery(uint desiredTaskCount, Array<SelfQueryTask>& tasks) const;
+
+  void Draw(int level);
+  void Validate();
+
+private:
+  u32 AllocateNode();
+  void FreeNode(u32 index);
+
+  void InsertLeaf(u32 leaf);
+  void RemoveLeaf(u32 leaf);
+  /// Walks up from the given node recomputing Aabbs and heights and rotating.
+  void Refit(u32 index);
+  /// Swaps a child with a grandchild when that reduces the surface area of the
+  /// subtree, which keeps the tree cheap to query as objects move around.
+  void Rotate(u32 index);
+  /// Recomputes a node's Aabb, height, and child bounds from its children.
+  void UpdateFromChildren(u32 index);
+  void ReplaceChild(u32 parent, u32 oldChild, u32 newChild);
+
+  /// Returns a bit per child (bit 0 for child 0) whose Aabb overlaps the query.
+  static uint OverlapChildren(const SoaAabbTreeNode& node, const float query[4][4]);
+  static void BuildQuery(const Aabb& aabb, float query[4][4]);
+  /// Walks the subtree under the given internal node for QueryAabb and Query.
+  /// A subtree too deep for one stack continues in a nested walk so no leaves
+  /// are ever skipped.
+  template <typename CallbackType>
+  void QueryAabbSubtree(u32 index, const float query[4][4], CallbackType& callback) const;
+  template <typename QueryType, typename Policy, typename CallbackType>
+  void QuerySubtree(u32 index, QueryType& queryObj, Policy policy, CallbackType& callback) const;
+  /// Pushes the tasks that cover the given one's pairs. Returns true if the task
+  /// is a pair of different leaves that needs to be reported instead.
+  bool ExpandSelfQueryTask(SelfQueryTask task, Array<SelfQueryTask>& tasks) const;
+  Aabb GetChildAabb(const SoaAabbTreeNode& node, uint child) const;
+
+  /// Hot data used by every traversal.
+  Array<SoaAabbTreeNode> mNodes;
+  /// Each node's own Aabb, only needed when the tree is modified.
+  Array<Aabb> mAabbs;
+
+  u32 mRoot;
+  u32 mFreeList;
+  uint mProxyCount;
+  /// Node index the next Rebuild starts searching for leaves at.
+  u32 mRebuildCursor;
+};
+
+} // namespace Plasma
+
+#include "SoaDynamicAabbTree.inl"
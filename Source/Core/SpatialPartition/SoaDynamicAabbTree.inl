@@ -0,0 +1,218 @@
+// MIT Licensed (see LICENSE.md).
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define PlasmaSoaAabbTreeSimd
+#endif
+
+namespace Plasma
+{
+
+namespace SoaDynamicAabbTreeInternal
+{
+
+// A query holds about as many nodes as the tree is tall, which the surface area
+// heuristic keeps far below this. Deeper subtrees are walked with another stack.
+const uint cMaxStackSize = 256;
+
+} // namespace SoaDynamicAabbTreeInternal
+
+inline void SoaDynamicAabbTree::BuildQuery(const Aabb& aabb, float query[4][4])
+{
+  // Laid out to match the child lanes of a node: min xy, max xy, min z, max z.
+  const Vec3& min = aabb.mMin;
+  const Vec3& max = aabb.mMax;
+  query[0][0] = query[0][1] = min.x;
+  query[0][2] = query[0][3] = min.y;
+  query[1][0] = query[1][1] = max.x;
+  query[1][2] = query[1][3] = max.y;
+  query[2][0] = query[2][1] = query[2][2] = query[2][3] = min.z;
+  query[3][0] = query[3][1] = query[3][2] = query[3][3] = max.z;
+}
+
+inline uint SoaDynamicAabbTree::OverlapChildren(const SoaAabbTreeNode& node, const float query[4][4])
+{
+#if defined(PlasmaSoaAabbTreeSimd)
+  // child.min <= query.max && query.min <= child.max on every axis, both children at once.
+  __m128 xy = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(node.mChildMinXY), _mm_loadu_ps(query[1])),
+                         _mm_cmple_ps(_mm_loadu_ps(query[0]), _mm_loadu_ps(node.mChildMaxXY)));
+  __m128 z = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(node.mChildMinZ), _mm_loadu_ps(query[3])),
+                        _mm_cmple_ps(_mm_loadu_ps(query[2]), _mm_loadu_ps(node.mChildMaxZ)));
+  uint mask = static_cast<uint>(_mm_movemask_ps(_mm_and_ps(xy, z)));
+#else
+  uint mask = 0;
+  for (uint i = 0; i < 4; ++i)
+  {
+    bool xy = node.mChildMinXY[i] <= query[1][i] && query[0][i] <= node.mChildMaxXY[i];
+    bool z = node.mChildMinZ[i] <= query[3][i] && query[2][i] <= node.mChildMaxZ[i];
+    if (xy && z)
+      mask |= 1 << i;
+  }
+#endif
+  // Lanes 0 and 1 hold x for each child, lanes 2 and 3 hold y.
+  return (mask & (mask >> 2)) & 0x3;
+}
+
+template <typename CallbackType>
+void SoaDynamicAabbTree::QueryAabb(const Aabb& aabb, CallbackType& callback) const
+{
+  if (mRoot == cInvalidIndex || !mAabbs[mRoot].Overlap(aabb))
+    return;
+
+  if (mNodes[mRoot].IsLeaf())
+  {
+    callback(mRoot);
+    return;
+  }
+
+  float query[4][4];
+  BuildQuery(aabb, query);
+  QueryAabbSubtree(mRoot, query, callback);
+}
+
+template <typename CallbackType>
+void SoaDynamicAabbTree::QueryAabbSubtree(u32 index, const float query[4][4], CallbackType& callback) const
+{
+  u32 stack[SoaDynamicAabbTreeInternal::cMaxStackSize];
+  uint stackSize = 0;
+  stack[stackSize++] = index;
+
+  const SoaAabbTreeNode* nodes = mNodes.Data();
+  while (stackSize != 0)
+  {
+    const SoaAabbTreeNode& node = nodes[stack[--stackSize]];
+    uint hits = OverlapChildren(node, query);
+    for (uint i = 0; i < 2; ++i)
+    {
+      if ((hits & (1 << i)) == 0)
+        continue;
+
+      u32 child = node.mChildren[i];
+      if (nodes[child].IsLeaf())
+        callback(child);
+      else if (stackSize < SoaDynamicAabbTreeInternal::cMaxStackSize)
+        stack[stackSize++] = child;
+      else
+        QueryAabbSubtree(child, query, callback);
+    }
+  }
+}
+
+template <typename QueryType, typename Policy, typename CallbackType>
+void SoaDynamicAabbTree::Query(QueryType& queryObj, Policy policy, CallbackType& callback) const
+{
+  if (mRoot == cInvalidIndex)
+    return;
+
+  Aabb rootAabb = mAabbs[mRoot];
+  if (!policy.Overlap(queryObj, rootAabb))
+    return;
+
+  if (mNodes[mRoot].IsLeaf())
+  {
+    callback(mRoot);
+    return;
+  }
+
+  QuerySubtree(mRoot, queryObj, policy, callback);
+}
+
+template <typename QueryType, typename Policy, typename CallbackType>
+void SoaDynamicAabbTree::QuerySubtree(u32 index, QueryType& queryObj, Policy policy, CallbackType& callback) const
+{
+  u32 stack[SoaDynamicAabbTreeInternal::cMaxStackSize];
+  uint stackSize = 0;
+  stack[stackSize++] = index;
+
+  while (stackSize != 0)
+  {
+    const SoaAabbTreeNode& node = mNodes[stack[--stackSize]];
+    for (uint i = 0; i < 2; ++i)
+    {
+      Aabb childAabb = GetChildAabb(node, i);
+      if (!policy.Overlap(queryObj, childAabb))
+        continue;
+
+      u32 child = node.mChildren[i];
+      if (mNodes[child].IsLeaf())
+        callback(child);
+      else if (stackSize < SoaDynamicAabbTreeInternal::cMaxStackSize)
+        stack[stackSize++] = child;
+      else
+        QuerySubtree(child, queryObj, policy, callback);
+    }
+  }
+}
+
+inline bool SoaDynamicAabbTree::ExpandSelfQueryTask(SelfQueryTask task, Array<SelfQueryTask>& tasks) const
+{
+  // A pair of the same node stands for all pairs within that subtree, otherwise it's
+  // two overlapping subtrees where the taller one is split until both sides are leaves.
+  u32 indexA = task.first;
+  u32 indexB = task.second;
+  const SoaAabbTreeNode* nodes = mNodes.Data();
+  const SoaAabbTreeNode& nodeA = nodes[indexA];
+  const SoaAabbTreeNode& nodeB = nodes[indexB];
+
+  float query[4][4];
+  if (indexA == indexB)
+  {
+    if (nodeA.IsLeaf())
+      return false;
+
+    u32 child0 = nodeA.mChildren[0];
+    u32 child1 = nodeA.mChildren[1];
+    tasks.PushBack(SelfQueryTask(child1, child1));
+    tasks.PushBack(SelfQueryTask(child0, child0));
+    BuildQuery(mAabbs[child0], query);
+    if (OverlapChildren(nodeA, query) & 0x2)
+      tasks.PushBack(SelfQueryTask(child0, child1));
+    return false;
+  }
+
+  if (nodeA.IsLeaf() && nodeB.IsLeaf())
+    return true;
+
+  // Split the taller side and keep the children that overlap the other side.
+  if (nodeA.mHeight > nodeB.mHeight)
+    Swap(indexA, indexB);
+  const SoaAabbTreeNode& splitNode = nodes[indexB];
+  BuildQuery(mAabbs[indexA], query);
+  uint hits = OverlapChildren(splitNode, query);
+  for (uint i = 0; i < 2; ++i)
+  {
+    if (hits & (1 << i))
+      tasks.PushBack(SelfQueryTask(indexA, splitNode.mChildren[i]));
+  }
+  return false;
+}
+
+template <typename CallbackType>
+void SoaDynamicAabbTree::QuerySelf(CallbackType& callback) const
+{
+  if (mRoot != cInvalidIndex)
+    QuerySelf(SelfQueryTask(mRoot, mRoot), callback);
+}
+
+template <typename CallbackType>
+void SoaDynamicAabbTree::QuerySelf(SelfQueryTask task, CallbackType& callback) const
+{
+  Array<SelfQueryTask> stack;
+  stack.PushBack(task);
+
+  while (!stack.Empty())
+  {
+    SelfQueryTask entry = stack.Back();
+    stack.PopBack();
+
+    if (ExpandSelfQueryTask(entry, stack))
+    {
+      if (entry.first < entry.second)
+        callback(entry.first, entry.second);
+      else
+        callback(entry.second, entry.first);
+    }
+  }
+}
+
+} // namespace Plasma
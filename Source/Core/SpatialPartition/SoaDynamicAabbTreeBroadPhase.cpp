@@ -0,0 +1,205 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+namespace SoaDynamicAabbTreeBroadPhaseInternal
+{
+
+struct PairCallback
+{
+  void operator()(u32 leafA, u32 leafB)
+  {
+    void* clientDataA = mTree->GetClientData(leafA);
+    void* clientDataB = mTree->GetClientData(leafB);
+    mResults->PushBack(ClientPair(clientDataA, clientDataB));
+  }
+
+  SoaDynamicAabbTree* mTree;
+  ClientPairArray* mResults;
+};
+
+struct QueryCallback
+{
+  void operator()(u32 leaf)
+  {
+    void* clientData = mTree->GetClientData(leaf);
+    mResults->PushBack(ClientPair(mClientData, clientData));
+  }
+
+  SoaDynamicAabbTree* mTree;
+  void* mClientData;
+  ClientPairArray* mResults;
+};
+
+template <typename RefineType>
+struct CastCallback
+{
+  CastCallback(SoaDynamicAabbTree* tree, RefineType& refine, CastDataParam castData) :
+      mTree(tree),
+      mRefine(refine),
+      mCastData(castData)
+  {
+  }
+
+  void operator()(u32 leaf)
+  {
+    mRefine.Refine(mTree->GetClientData(leaf), mCastData);
+  }
+
+  SoaDynamicAabbTree* mTree;
+  RefineType& mRefine;
+  CastDataParam mCastData;
+};
+
+// Roughly one full pass over a tree of 10k proxies every few seconds.
+const uint cDefaultRebuildCount = 32;
+
+} // namespace SoaDynamicAabbTreeBroadPhaseInternal
+
+LightningDefineType(SoaDynamicAabbTreeBroadPhase, builder, type)
+{
+}
+
+SoaDynamicAabbTreeBroadPhase::SoaDynamicAabbTreeBroadPhase()
+{
+  mRebuildCount = SoaDynamicAabbTreeBroadPhaseInternal::cDefaultRebuildCount;
+}
+
+SoaDynamicAabbTreeBroadPhase::~SoaDynamicAabbTreeBroadPhase()
+{
+}
+
+void SoaDynamicAabbTreeBroadPhase::Serialize(Serializer& stream)
+{
+  IBroadPhase::Serialize(stream);
+}
+
+void SoaDynamicAabbTreeBroadPhase::Draw(int level, uint debugDrawFlags)
+{
+  mTree.Draw(level);
+}
+
+void SoaDynamicAabbTreeBroadPhase::CreateProxy(BroadPhaseProxy& proxy, BroadPhaseData& data)
+{
+  proxy = BroadPhaseProxy(mTree.CreateProxy(data.mAabb, data.mClientData));
+}
+
+void SoaDynamicAabbTreeBroadPhase::CreateProxies(BroadPhaseObjectArray& objects)
+{
+  for (uint i = 0; i < objects.Size(); ++i)
+    CreateProxy(*objects[i].mProxy, objects[i].mData);
+}
+
+void SoaDynamicAabbTreeBroadPhase::RemoveProxy(BroadPhaseProxy& proxy)
+{
+  mTree.RemoveProxy(proxy.ToU32());
+}
+
+void SoaDynamicAabbTreeBroadPhase::RemoveProxies(ProxyHandleArray& proxies)
+{
+  for (uint i = 0; i < proxies.Size(); ++i)
+    RemoveProxy(*proxies[i]);
+}
+
+void SoaDynamicAabbTreeBroadPhase::UpdateProxy(BroadPhaseProxy& proxy, BroadPhaseData& data)
+{
+  mTree.UpdateProxy(proxy.ToU32(), data.mAabb, data.mClientData);
+}
+
+void SoaDynamicAabbTreeBroadPhase::UpdateProxies(BroadPhaseObjectArray& objects)
+{
+  for (uint i = 0; i < objects.Size(); ++i)
+    UpdateProxy(*objects[i].mProxy, objects[i].mData);
+}
+
+void SoaDynamicAabbTreeBroadPhase::SelfQuery(ClientPairArray& results)
+{
+  SoaDynamicAabbTreeBroadPhaseInternal::PairCallback callback;
+  callback.mTree = &mTree;
+  callback.mResults = &results;
+  mTree.QuerySelf(callback);
+}
+
+void SoaDynamicAabbTreeBroadPhase::Query(BroadPhaseData& data, ClientPairArray& results)
+{
+  SoaDynamicAabbTreeBroadPhaseInternal::QueryCallback callback;
+  callback.mTree = &mTree;
+  callback.mClientData = data.mClientData;
+  callback.mResults = &results;
+  mTree.QueryAabb(data.mAabb, callback);
+}
+
+void SoaDynamicAabbTreeBroadPhase::BatchQuery(BroadPhaseDataArray& data, ClientPairArray& results)
+{
+  for (uint i = 0; i < data.Size(); ++i)
+    Query(data[i], results);
+}
+
+uint SoaDynamicAabbTreeBroadPhase::SplitSelfQuery(uint desiredTaskCount)
+{
+  mTree.SplitSelfQuery(desiredTaskCount, mSelfQueryTasks);
+  return mSelfQueryTasks.Size();
+}
+
+void SoaDynamicAabbTreeBroadPhase::SelfQueryTask(uint taskIndex, ClientPairArray& results)
+{
+  SoaDynamicAabbTreeBroadPhaseInternal::PairCallback callback;
+  callback.mTree = &mTree;
+  callback.mResults = &results;
+  mTree.QuerySelf(mSelfQueryTasks[taskIndex], callback);
+}
+
+void SoaDynamicAabbTreeBroadPhase::CastRay(CastDataParam data, ProxyCastResults& results)
+{
+  SimpleRayCallback refine(mCastRayCallBack, &results);
+  SoaDynamicAabbTreeBroadPhaseInternal::CastCallback<SimpleRayCallback> callback(&mTree, refine, data);
+
+  Ray ray = data.GetRay();
+  mTree.Query(ray, BroadPhasePolicy<Ray, Aabb>(), callback);
+}
+
+void SoaDynamicAabbTreeBroadPhase::CastSegment(CastDataParam data, ProxyCastResults& results)
+{
+  SimpleSegmentCallback refine(mCastSegmentCallBack, &results);
+  SoaDynamicAabbTreeBroadPhaseInternal::CastCallback<SimpleSegmentCallback> callback(&mTree, refine, data);
+
+  Segment segment = data.GetSegment();
+  mTree.Query(segment, BroadPhasePolicy<Segment, Aabb>(), callback);
+}
+
+void SoaDynamicAabbTreeBroadPhase::CastAabb(CastDataParam data, ProxyCastResults& results)
+{
+  SimpleAabbCallback refine(mCastAabbCallBack, &results);
+  SoaDynamicAabbTreeBroadPhaseInternal::CastCallback<SimpleAabbCallback> callback(&mTree, refine, data);
+
+  mTree.QueryAabb(data.GetAabb(), callback);
+}
+
+void SoaDynamicAabbTreeBroadPhase::CastSphere(CastDataParam data, ProxyCastResults& results)
+{
+  SimpleSphereCallback refine(mCastSphereCallBack, &results);
+  SoaDynamicAabbTreeBroadPhaseInternal::CastCallback<SimpleSphereCallback> callback(&mTree, refine, data);
+
+  Sphere sphere = data.GetSphere();
+  mTree.Query(sphere, BroadPhasePolicy<Sphere, Aabb>(), callback);
+}
+
+void SoaDynamicAabbTreeBroadPhase::CastFrustum(CastDataParam data, ProxyCastResults& results)
+{
+  SimpleFrustumCallback refine(mCastFrustumCallBack, &results);
+  SoaDynamicAabbTreeBroadPhaseInternal::CastCallback<SimpleFrustumCallback> callback(&mTree, refine, data);
+
+  Frustum frustum = data.GetFrustum();
+  mTree.Query(frustum, BroadPhasePolicy<Frustum, Aabb>(), callback);
+}
+
+void SoaDynamicAabbTreeBroadPhase::RegisterCollisions()
+{
+  // Improve the tree before the self query walks it. The pairs themselves are
+  // found by SelfQuery (or the split tasks) so that they can run in parallel.
+  mTree.Rebuild(mRebuildCount);
+}
+
+} // namespace Plasma
@@ -0,0 +1,60 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Plasma
+{
+
+/// The BroadPhase interface for the SoaDynamicAabbTree. Proxies are node indices
+/// into the tree. RegisterCollisions re-inserts a few leaves to keep the tree's
+/// quality up and the self query can be split across threads.
+class SoaDynamicAabbTreeBroadPhase : public IBroadPhase
+{
+public:
+  LightningDeclareType(SoaDynamicAabbTreeBroadPhase, TypeCopyMode::ReferenceType);
+
+  SoaDynamicAabbTreeBroadPhase();
+  ~SoaDynamicAabbTreeBroadPhase();
+
+  void Serialize(Serializer& stream) override;
+
+  void Draw(int level, uint debugDrawFlags) override;
+
+  void CreateProxy(BroadPhaseProxy& proxy, BroadPhaseData& data) override;
+  void CreateProxies(BroadPhaseObjectArray& objects) override;
+  void RemoveProxy(BroadPhaseProxy& proxy) override;
+  void RemoveProxies(ProxyHandleArray& proxies) override;
+  void UpdateProxy(BroadPhaseProxy& proxy, BroadPhaseData& data) override;
+  void UpdateProxies(BroadPhaseObjectArray& objects) override;
+
+  void SelfQuery(ClientPairArray& results) override;
+  void Query(BroadPhaseData& data, ClientPairArray& results) override;
+  void BatchQuery(BroadPhaseDataArray& data, ClientPairArray& results) override;
+
+  bool SupportsParallelQueries() override
+  {
+    return true;
+  }
+  uint SplitSelfQuery(uint desiredTaskCount) override;
+  void SelfQueryTask(uint taskIndex, ClientPairArray& results) override;
+
+  void Construct() override{};
+
+  void CastRay(CastDataParam data, ProxyCastResults& results) override;
+  void CastSegment(CastDataParam data, ProxyCastResults& results) override;
+  void CastAabb(CastDataParam data, ProxyCastResults& results) override;
+  void CastSphere(CastDataParam data, ProxyCastResults& results) override;
+  void CastFrustum(CastDataParam data, ProxyCastResults& results) override;
+
+  void RegisterCollisions() override;
+
+  void Cleanup() override{};
+
+private:
+  SoaDynamicAabbTree mTree;
+  /// The tasks from the last SplitSelfQuery.
+  Array<SoaDynamicAabbTree::SelfQueryTask> mSelfQueryTasks;
+  /// How many leaves are re-inserted every RegisterCollisions.
+  uint mRebuildCount;
+};
+
+} // namespace Plasma
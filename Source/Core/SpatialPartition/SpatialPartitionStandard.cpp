@@ -16,6 +16,7 @@ LightningDefineStaticLibrary(SpatialPartitionLibrary)
   LightningInitializeType(SapBroadPhase);
   LightningInitializeType(DynamicAabbTreeBroadPhase);
   LightningInitializeType(AvlDynamicAabbTreeBroadPhase);
+  LightningInitializeType(SoaDynamicAabbTreeBroadPhase);
   LightningInitializeType(DynamicBroadphasePropertyExtension);
   LightningInitializeType(StaticBroadphasePropertyExtension);
 
@@ -33,6 +33,8 @@ public:
 #include "DynamicAabbTree.hpp"
 #include "DynamicAabbTreeBroadPhase.hpp"
 #include "AvlDynamicAabbTreeBroadPhase.hpp"
+#include "SoaDynamicAabbTree.hpp"
+#include "SoaDynamicAabbTreeBroadPhase.hpp"
 #include "BaseNSquared.hpp"
 #include "NSquared.hpp"
 #include "NSquaredBroadPhase.hpp"
@@ -50,3 +52,4 @@ public:
 #include "BroadPhasePackage.hpp"
 #include "BroadPhaseCreator.hpp"
 #include "BroadPhaseTracker.hpp"
+#include "BroadPhaseBenchmark.hpp"
@@ -25,6 +25,11 @@ public:
   virtual void SelfQuery(ClientPairArray& results);
   virtual void Query(BroadPhaseData& data, ClientPairArray& results);
   virtual void BatchQuery(BroadPhaseDataArray& data, ClientPairArray& results);
+  /// Queries only walk the tree with a stack allocated scratch buffer.
+  virtual bool SupportsParallelQueries()
+  {
+    return true;
+  }
 
   virtual void Construct();
 
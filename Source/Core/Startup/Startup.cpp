@@ -140,8 +140,16 @@ void PlasmaStartup::Initialize()
   ZoneScoped;
   ProfileScopeFunction();
 
+  // With a TraceFile the capture streams to disk as it runs (e.g. headless runs),
+  // otherwise it is kept in memory until the editor's EndTracing command.
   if (Environment::GetValue<bool>("BeginTracing", false))
-    Profile::ProfileSystem::Instance->BeginTracing();
+  {
+    String traceFile = Environment::GetValue<String>("TraceFile");
+    if (traceFile.Empty())
+      Profile::ProfileSystem::Instance->BeginTracing();
+    else
+      Profile::ProfileSystem::Instance->BeginTracing(traceFile);
+  }
 
   // Add stdout listener (requires engine initialization to get the Environment
   // object)
@@ -0,0 +1,217 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+// Written before the data of every cached file
+struct DiskCacheHeader
+{
+  u32 mSignature;
+  u32 mVersion;
+  u32 mDataSize;
+};
+
+// Entries being written, and those left behind by a process that didn't finish
+static const String cTempExtension("tmp");
+
+DiskCacheReader::DiskCacheReader() : mPosition(nullptr), mEnd(nullptr)
+{
+}
+
+DiskCacheReader::~DiskCacheReader()
+{
+  if (mBlock.Data != nullptr)
+    plDeallocate(mBlock.Data);
+}
+
+bool DiskCacheReader::ReadString(String& string)
+{
+  u32 size = 0;
+  if (!Read(size) || GetRemainingSize() < size)
+    return false;
+  string = StringRange((char*)mPosition, (char*)mPosition + size);
+  mPosition += size;
+  return true;
+}
+
+bool DiskCacheReader::ReadCount(u32& count, size_t minEntrySize)
+{
+  return Read(count) && count <= GetRemainingSize() / minEntrySize;
+}
+
+bool DiskCache::Load(StringParam path, u32 signature, u32 version, DiskCacheReader& reader)
+{
+  if (!FileExists(path))
+    return false;
+
+  // The whole file is read at once and read in place
+  DataBlock block = ReadFileIntoDataBlock(path.c_str());
+  if (block.Data == nullptr)
+    return false;
+
+  // Files are moved into place once fully written, so one that doesn't match
+  // was written by a different layout or is corrupt and won't load next time
+  DiskCacheHeader header;
+  if (block.Size < sizeof(header))
+  {
+    plDeallocate(block.Data);
+    Delete(path);
+    return false;
+  }
+  memcpy(&header, block.Data, sizeof(header));
+  if (header.mSignature != signature || header.mVersion != version || block.Size != sizeof(header) + header.mDataSize)
+  {
+    plDeallocate(block.Data);
+    Delete(path);
+    return false;
+  }
+
+  if (reader.mBlock.Data != nullptr)
+    plDeallocate(reader.mBlock.Data);
+  reader.mBlock = block;
+  reader.mPosition = block.Data + sizeof(header);
+  reader.mEnd = block.Data + block.Size;
+  return true;
+}
+
+bool DiskCache::Save(StringParam path, u32 signature, u32 version, const byte* data, size_t size)
+{
+  DiskCacheHeader header;
+  header.mSignature = signature;
+  header.mVersion = version;
+  header.mDataSize = (u32)size;
+
+  String directory = FilePath::GetDirectoryPath(path);
+  if (!DirectoryExists(directory))
+    CreateDirectoryAndParents(directory);
+
+  String tempPath = GetTempPath(path);
+  File file;
+  Status status;
+  if (!file.Open(tempPath, FileMode::Write, FileAccessPattern::Sequential, FileShare::Unspecified, &status))
+    return false;
+
+  bool written = file.Write((byte*)&header, sizeof(header)) == sizeof(header) &&
+                 file.Write((byte*)data, size) == size;
+  file.Close();
+
+  if (!written)
+  {
+    DeleteFile(tempPath);
+    return false;
+  }
+  return MoveIntoPlace(path, tempPath);
+}
+
+String DiskCache::GetTempPath(StringParam path)
+{
+  // Threads of this process and other processes may write the same entry
+  return String::Format("%s.%llx%llx.%s",
+                        path.c_str(),
+                        (unsigned long long)Thread::GetCurrentThreadId(),
+                        (unsigned long long)GenerateUniqueId64(),
+                        cTempExtension.c_str());
+}
+
+bool DiskCache::MoveIntoPlace(StringParam path, StringParam tempPath)
+{
+  // Files are replaced in one move, but a directory can't replace another
+  if (DirectoryExists(tempPath))
+  {
+    if (DirectoryExists(path) || !MoveFile(path, tempPath))
+    {
+      Delete(tempPath);
+      return false;
+    }
+    return true;
+  }
+
+  if (!MoveFile(path, tempPath))
+  {
+    DeleteFile(tempPath);
+    return false;
+  }
+  return true;
+}
+
+void DiskCache::Delete(StringParam path)
+{
+  if (DirectoryExists(path))
+  {
+    DeleteDirectoryContents(path);
+    DeleteDirectory(path);
+  }
+  else
+  {
+    DeleteFile(path);
+  }
+}
+
+typedef Pair<TimeType, FileEntry> CachedEntry;
+
+static bool CachedEntryOlder(const CachedEntry& left, const CachedEntry& right)
+{
+  return left.first < right.first;
+}
+
+// Adds up the size of the entry, and finds when any of its files was last written
+static void GetEntryInfo(StringParam path, u64& size, TimeType& time)
+{
+  for (FileRange files(path); !files.Empty(); files.PopFront())
+  {
+    FileEntry entry = files.FrontEntry();
+    String entryPath = entry.GetFullPath();
+    if (DirectoryExists(entryPath))
+    {
+      GetEntryInfo(entryPath, size, time);
+      continue;
+    }
+
+    size += entry.mSize;
+    time = Math::Max(time, GetFileModifiedTime(entryPath));
+  }
+}
+
+void DiskCache::TrimDirectory(StringParam directory, u64 maxSize)
+{
+  if (!DirectoryExists(directory))
+    return;
+
+  Array<CachedEntry> cachedEntries;
+  u64 totalSize = 0;
+  for (FileRange files(directory); !files.Empty(); files.PopFront())
+  {
+    FileEntry entry = files.FrontEntry();
+    String path = entry.GetFullPath();
+    if (FilePath::GetExtension(entry.mFileName) == cTempExtension)
+    {
+      Delete(path);
+      continue;
+    }
+
+    TimeType time = GetFileModifiedTime(path);
+    if (DirectoryExists(path))
+    {
+      entry.mSize = 0;
+      GetEntryInfo(path, entry.mSize, time);
+    }
+
+    cachedEntries.PushBack(CachedEntry(time, entry));
+    totalSize += entry.mSize;
+  }
+
+  if (totalSize <= maxSize)
+    return;
+
+  Sort(cachedEntries.All(), CachedEntryOlder);
+  forRange (CachedEntry& cachedEntry, cachedEntries.All())
+  {
+    if (totalSize <= maxSize)
+      break;
+    Delete(cachedEntry.second.GetFullPath());
+    totalSize -= cachedEntry.second.mSize;
+  }
+}
+
+} // namespace Plasma
@@ -0,0 +1,79 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Plasma
+{
+
+/// Reads the data of a cached file, checking every read against the bytes that
+/// are left so a truncated or corrupt file fails to load instead of reading
+/// past the buffer. Owns the file read by DiskCache::Load.
+class DiskCacheReader
+{
+public:
+  DiskCacheReader();
+  ~DiskCacheReader();
+
+  size_t GetRemainingSize()
+  {
+    return mEnd - mPosition;
+  }
+
+  template <typename T>
+  bool Read(T& value)
+  {
+    if (GetRemainingSize() < sizeof(T))
+      return false;
+    memcpy(&value, mPosition, sizeof(T));
+    mPosition += sizeof(T);
+    return true;
+  }
+
+  /// Reads a string saved as its size in bytes followed by its bytes.
+  bool ReadString(String& string);
+
+  /// Reads the number of entries that follow, each entry takes at least the
+  /// given number of bytes so a count that can't fit in the rest is rejected.
+  bool ReadCount(u32& count, size_t minEntrySize);
+
+private:
+  DiskCacheReader(const DiskCacheReader&);
+  void operator=(const DiskCacheReader&);
+  friend class DiskCache;
+
+  DataBlock mBlock;
+  byte* mPosition;
+  byte* mEnd;
+};
+
+/// Shared by the caches that keep built data on disk between runs (parsed data
+/// trees, translated shaders, and built content). Entries are written beside
+/// their final path and moved into place, so another process or thread never
+/// sees part of an entry, and entries that fail to load are deleted.
+class DiskCache
+{
+public:
+  /// Reads the file cached at the path into the reader if it was fully written
+  /// with the signature and version. A file that doesn't match is deleted.
+  static bool Load(StringParam path, u32 signature, u32 version, DiskCacheReader& reader);
+
+  /// Writes the data to the path under a header of the signature and version.
+  static bool Save(StringParam path, u32 signature, u32 version, const byte* data, size_t size);
+
+  /// Returns a path beside the given path that no other writer uses, for
+  /// entries (such as directories) built in place before MoveIntoPlace.
+  static String GetTempPath(StringParam path);
+
+  /// Moves the file or directory at the temporary path to the path. The
+  /// temporary path is deleted if another writer already stored the entry.
+  static bool MoveIntoPlace(StringParam path, StringParam tempPath);
+
+  /// Deletes the cached file or directory at the path.
+  static void Delete(StringParam path);
+
+  /// Deletes the least recently written entries until the directory is under
+  /// the size, along with temporary entries left behind by a process that
+  /// didn't finish writing them.
+  static void TrimDirectory(StringParam directory, u64 maxSize);
+};
+
+} // namespace Plasma
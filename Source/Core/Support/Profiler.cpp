@@ -12,15 +12,227 @@ namespace Profile
 
 uint Record::sSampleIndex = 0;
 
+// The trace buffer owned by the current thread (owned by the ProfileSystem).
+static PlasmaThreadLocal ThreadTraceBuffer* sThreadBuffer = nullptr;
+
+ThreadTraceBuffer::ThreadTraceBuffer(size_t threadId) :
+    mThreadId(threadId),
+    mDroppedCount(0),
+    mWriting(false),
+    mWrite(0),
+    mRead(0),
+    mSamples(nullptr)
+{
+}
+
+ThreadTraceBuffer::~ThreadTraceBuffer()
+{
+  Free();
+}
+
+void ThreadTraceBuffer::Push(Record* record, StringParam args, ProfileTime timestamp, ProfileTime duration)
+{
+  s64 write = AtomicLoad(&mWrite);
+  if (write - AtomicLoad(&mRead) >= cCapacity)
+  {
+    ++mDroppedCount;
+    return;
+  }
+
+  TraceSample& sample = mSamples[write & (cCapacity - 1)];
+  sample.mRecord = record;
+  sample.mArgs = args;
+  sample.mTimestamp = timestamp;
+  sample.mDuration = duration;
+
+  // Publish the sample to the collector
+  AtomicStore(&mWrite, write + 1);
+}
+
+void ThreadTraceBuffer::Drain(Array<TraceEvent>& output)
+{
+  if (mSamples == nullptr)
+    return;
+
+  s64 read = AtomicLoad(&mRead);
+  s64 write = AtomicLoad(&mWrite);
+  for (; read < write; ++read)
+  {
+    TraceSample& sample = mSamples[read & (cCapacity - 1)];
+    TraceEvent& event = output.PushBack();
+    if (sample.mRecord->mParent)
+      event.mCategory = sample.mRecord->mParent->mName;
+    event.mName = sample.mRecord->mName;
+    event.mArgs = sample.mArgs;
+    event.mThreadId = mThreadId;
+    event.mThreadName = mThreadName;
+    event.mTimestamp = sample.mTimestamp;
+    event.mDuration = sample.mDuration;
+    sample.mArgs = String();
+  }
+
+  // Hand the slots back to the writer
+  AtomicStore(&mRead, read);
+}
+
+void ThreadTraceBuffer::Allocate()
+{
+  if (mSamples == nullptr)
+    mSamples = new TraceSample[cCapacity];
+  AtomicStore(&mRead, 0);
+  AtomicStore(&mWrite, 0);
+}
+
+void ThreadTraceBuffer::Free()
+{
+  delete[] mSamples;
+  mSamples = nullptr;
+  AtomicStore(&mRead, 0);
+  AtomicStore(&mWrite, 0);
+}
+
+ChromeTraceWriter::ChromeTraceWriter() : mFirstEvent(true)
+{
+  mBuilder.Append("[");
+}
+
+ChromeTraceWriter::~ChromeTraceWriter()
+{
+  if (mFile.IsOpen())
+    Close();
+}
+
+bool ChromeTraceWriter::Open(StringParam filePath)
+{
+  return mFile.Open(filePath, FileMode::Write, FileAccessPattern::Sequential);
+}
+
+// Json string values (names can contain anything, e.g. a file path as an argument).
+static void AppendJsonString(StringBuilder& builder, StringParam value)
+{
+  builder.Append('"');
+  forRange (Rune rune, value)
+  {
+    switch (rune.value)
+    {
+    case '"':
+      builder.Append("\\\"");
+      break;
+    case '\\':
+      builder.Append("\\\\");
+      break;
+    case '\n':
+      builder.Append("\\n");
+      break;
+    case '\r':
+      builder.Append("\\r");
+      break;
+    case '\t':
+      builder.Append("\\t");
+      break;
+    default:
+      if (rune.value < 0x20)
+        builder.AppendFormat("\\u%04x", rune.value);
+      else
+        builder.Append(rune);
+    }
+  }
+  builder.Append('"');
+}
+
+void ChromeTraceWriter::BeginEvent()
+{
+  if (!mFirstEvent)
+    mBuilder.Append(",\n");
+  mFirstEvent = false;
+}
+
+void ChromeTraceWriter::WriteThreadName(size_t threadId, StringParam threadName)
+{
+  if (threadName.Empty() || mNamedThreads.Contains(threadId))
+    return;
+  mNamedThreads.Insert(threadId);
+
+  BeginEvent();
+  mBuilder.AppendFormat("{\"ph\":\"M\",\"pid\":0,\"tid\":%llu,\"name\":\"thread_name\",\"args\":{\"name\":",
+                        (unsigned long long)threadId);
+  AppendJsonString(mBuilder, threadName);
+  mBuilder.Append("}}");
+}
+
+void ChromeTraceWriter::Write(Array<TraceEvent>& events)
+{
+  // Chrome trace timestamps are in microseconds
+  ProfileSystem* system = ProfileSystem::Instance;
+  forRange (TraceEvent& event, events)
+  {
+    WriteThreadName(event.mThreadId, event.mThreadName);
+
+    double timestamp = system->GetTimeInMicroseconds(event.mTimestamp);
+    double duration = system->GetTimeInMicroseconds(event.mDuration);
+
+    BeginEvent();
+    mBuilder.AppendFormat("{\"ph\":\"X\",\"pid\":0,\"tid\":%llu,\"ts\":%.3f,\"dur\":%.3f,\"cat\":",
+                          (unsigned long long)event.mThreadId,
+                          timestamp,
+                          duration);
+    AppendJsonString(mBuilder, event.mCategory);
+    mBuilder.Append(",\"name\":");
+    AppendJsonString(mBuilder, event.mName);
+    if (!event.mArgs.Empty())
+    {
+      mBuilder.Append(",\"args\":{\"value\":");
+      AppendJsonString(mBuilder, event.mArgs);
+      mBuilder.Append("}");
+    }
+    mBuilder.Append("}");
+  }
+
+  // Don't let the text grow without bound when streaming
+  const size_t cFlushSize = 1024 * 1024;
+  if (mFile.IsOpen() && mBuilder.GetSize() >= cFlushSize)
+    Flush();
+}
+
+void ChromeTraceWriter::Flush()
+{
+  String text = mBuilder.ToString();
+  mFile.Write((byte*)text.Data(), text.SizeInBytes());
+  mBuilder.Deallocate();
+}
+
+String ChromeTraceWriter::Close()
+{
+  mBuilder.Append("]\n");
+  if (!mFile.IsOpen())
+    return mBuilder.ToString();
+
+  Flush();
+  mFile.Close();
+  return String();
+}
+
 ProfileSystem* ProfileSystem::Instance = nullptr;
 void ProfileSystem::Initialize()
 {
   Instance = new ProfileSystem();
   Instance->mIsRecording = false;
+  Instance->mStreamWriter = nullptr;
 }
 
 void ProfileSystem::Shutdown()
 {
+  if (Instance == nullptr)
+    return;
+
+  // Complete any trace that is still streaming to a file
+  if (Instance->mStreamWriter)
+  {
+    Array<TraceEvent> remaining;
+    Instance->EndTracing(remaining);
+  }
+
+  DeleteObjectsInContainer(Instance->mBuffers);
   SafeDelete(Instance);
 }
 
@@ -29,38 +241,127 @@ float ProfileSystem::GetTimeInSeconds(ProfileTime time)
   return (float)mTimer.TicksToSeconds(time);
 }
 
+double ProfileSystem::GetTimeInMicroseconds(ProfileTime time)
+{
+  return mTimer.TicksToSeconds(time) * 1000000.0;
+}
+
 void ProfileSystem::Add(Record* record)
 {
+  mRecordLock.Lock();
   mRecordList.PushBack(record);
+  mRecordsByName.InsertNoOverwrite(record->mName, record);
+  mRecordLock.Unlock();
 }
 
 void ProfileSystem::Add(StringParam parentName, Record* record)
 {
-  // if this object has a parent, then walk through the record list
-  // to find the parent
+  // Records are function statics, so they can be first hit on any thread
+  mRecordLock.Lock();
+
+  // if this object has a parent, attach it to the first record with that name
   if (!parentName.Empty())
   {
-    Array<Record*>::range r = mRecordList.All();
-    for (; !r.Empty(); r.PopFront())
-    {
-      if (r.Front()->mName == parentName)
-      {
-        r.Front()->AddChild(record);
-        break;
-      }
-    }
+    Record* parent = mRecordsByName.FindValue(parentName, nullptr);
+    if (parent)
+      parent->AddChild(record);
   }
 
   // always add this record to the record list
   mRecordList.PushBack(record);
+  mRecordsByName.InsertNoOverwrite(record->mName, record);
+  mRecordLock.Unlock();
 }
 
 ProfileTime ProfileSystem::GetTime()
 {
-  // TODO: Fix for multiple threads. (Thread local storage?)
+  // The timer only reads the monotonic performance counter, so this is thread safe.
   return mTimer.GetTickTime();
 }
 
+void ProfileSystem::SetThreadName(StringParam threadName)
+{
+  if (Instance == nullptr)
+    return;
+
+  ThreadTraceBuffer* buffer = Instance->GetThreadBuffer();
+  Instance->mBuffersLock.Lock();
+  buffer->mThreadName = threadName;
+  Instance->mBuffersLock.Unlock();
+}
+
+ThreadTraceBuffer* ProfileSystem::GetThreadBuffer()
+{
+  ThreadTraceBuffer* buffer = sThreadBuffer;
+  if (buffer)
+    return buffer;
+
+  buffer = new ThreadTraceBuffer(Thread::GetCurrentThreadId());
+  if (Thread::IsMainThread())
+    buffer->mThreadName = "Main";
+
+  mBuffersLock.Lock();
+  if (mIsRecording)
+    buffer->Allocate();
+  mBuffers.PushBack(buffer);
+  mBuffersLock.Unlock();
+
+  sThreadBuffer = buffer;
+  return buffer;
+}
+
+void ProfileSystem::ReleaseThreadBuffer()
+{
+  ThreadTraceBuffer* buffer = sThreadBuffer;
+  if (Instance == nullptr || buffer == nullptr)
+    return;
+  sThreadBuffer = nullptr;
+
+  Instance->mBuffersLock.Lock();
+  if (Instance->mIsRecording)
+  {
+    Array<TraceEvent> events;
+    buffer->Drain(events);
+    Instance->StoreEvents(events);
+  }
+  Instance->mBuffers.EraseValue(buffer);
+  Instance->mBuffersLock.Unlock();
+
+  delete buffer;
+}
+
+void ProfileSystem::RecordSample(Record* record, StringParam args, ProfileTime timestamp, ProfileTime duration)
+{
+  ThreadTraceBuffer* buffer = GetThreadBuffer();
+
+  // The collector clears mIsRecording before waiting on mWriting, so the ring
+  // can't be freed while we're writing to it.
+  buffer->mWriting = true;
+  if (mIsRecording && buffer->IsAllocated())
+    buffer->Push(record, args, timestamp, duration);
+  buffer->mWriting = false;
+}
+
+void ProfileSystem::DrainBuffers(Array<TraceEvent>& output)
+{
+  forRange (ThreadTraceBuffer* buffer, mBuffers.All())
+  {
+    buffer->Drain(output);
+
+    s32 dropped = buffer->mDroppedCount.Exchange(0);
+    if (dropped != 0)
+      PlasmaPrint("Trace dropped %d events on thread %s\n", dropped, buffer->mThreadName.c_str());
+  }
+}
+
+void ProfileSystem::StoreEvents(Array<TraceEvent>& events)
+{
+  if (mStreamWriter)
+    mStreamWriter->Write(events);
+  else
+    mCollectedEvents.Append(events.All());
+}
+
 void ProfileSystem::BeginTracing()
 {
   if (mIsRecording)
@@ -68,11 +369,51 @@ void ProfileSystem::BeginTracing()
     return;
   }
   PlasmaPrint("Tracing begun\n");
-  mTraceEventsLock.Lock();
-  mTraceEvents.Clear();
-  mTraceEvents.Reserve(10000);
-  mTraceEventsLock.Unlock();
+
+  // Rings are only allocated for the length of a capture
+  mBuffersLock.Lock();
+  forRange (ThreadTraceBuffer* buffer, mBuffers.All())
+    buffer->Allocate();
+  mCollectedEvents.Clear();
   mIsRecording = true;
+  mBuffersLock.Unlock();
+}
+
+void ProfileSystem::BeginTracing(StringParam filePath)
+{
+  if (mIsRecording)
+  {
+    return;
+  }
+
+  ChromeTraceWriter* writer = new ChromeTraceWriter();
+  if (!writer->Open(filePath))
+  {
+    PlasmaPrint("Failed to open trace file '%s'\n", filePath.c_str());
+    delete writer;
+    return;
+  }
+
+  mBuffersLock.Lock();
+  mStreamWriter = writer;
+  mBuffersLock.Unlock();
+
+  PlasmaPrint("Streaming trace to '%s'\n", filePath.c_str());
+  BeginTracing();
+}
+
+void ProfileSystem::FlushTracing()
+{
+  if (!mIsRecording)
+    return;
+
+  // Drained every frame even when capturing in memory, otherwise the rings fill
+  // up and start dropping samples after a few seconds.
+  Array<TraceEvent> events;
+  mBuffersLock.Lock();
+  DrainBuffers(events);
+  StoreEvents(events);
+  mBuffersLock.Unlock();
 }
 
 void ProfileSystem::EndTracing(Array<TraceEvent>& output)
@@ -82,11 +423,37 @@ void ProfileSystem::EndTracing(Array<TraceEvent>& output)
     PlasmaPrint("Cannot end tracing since it was never started\n");
     return;
   }
+
+  mBuffersLock.Lock();
   mIsRecording = false;
-  mTraceEventsLock.Lock();
-  output.Swap(mTraceEvents);
-  mTraceEvents.Clear();
-  mTraceEventsLock.Unlock();
+
+  // Wait for any thread still writing a sample before its ring is freed
+  forRange (ThreadTraceBuffer* buffer, mBuffers.All())
+  {
+    while (buffer->mWriting)
+      Os::Sleep(0);
+  }
+
+  Array<TraceEvent> events;
+  DrainBuffers(events);
+  StoreEvents(events);
+
+  forRange (ThreadTraceBuffer* buffer, mBuffers.All())
+    buffer->Free();
+
+  // When streaming, everything goes to the file instead of the output
+  if (mStreamWriter)
+  {
+    mStreamWriter->Close();
+    SafeDelete(mStreamWriter);
+  }
+  else
+  {
+    output.Append(mCollectedEvents.All());
+    mCollectedEvents.Deallocate();
+  }
+  mBuffersLock.Unlock();
+
   PlasmaPrint("Tracing ended\n");
 }
 
@@ -118,6 +485,7 @@ void Record::Initialize(StringParam name, StringParam parentName, u32 color)
 
 void Record::Clear()
 {
+  mHits = 0;
   mTotalTime = 0;
   mMaxTime = 0;
 
@@ -186,7 +554,8 @@ void Record::EnterRecord(ProfileTime time)
 {
   ++mHits;
   mTotalTime += time;
-  // update the max time that was ever spent in this record.
+  // update the max time that was ever spent in this record (racing threads may
+  // lose an update, which is fine for a statistic).
   if (time > mMaxTime)
   {
     mMaxTime = time;
@@ -196,11 +565,18 @@ void Record::EnterRecord(ProfileTime time)
   }
 }
 
-ScopeTimer::ScopeTimer(Record* data, String args)
+ScopeTimer::ScopeTimer(Record* data)
 {
   mData = data;
   mStartTime = ProfileSystem::Instance->GetTime();
-  mArgs = args;
+}
+
+ScopeTimer::ScopeTimer(Record* data, StringParam args)
+{
+  mData = data;
+  mStartTime = ProfileSystem::Instance->GetTime();
+  if (ProfileSystem::Instance->mIsRecording)
+    mArgs = args;
 }
 
 ScopeTimer::~ScopeTimer()
@@ -210,21 +586,9 @@ ScopeTimer::~ScopeTimer()
   ProfileTime duration = endTime - mStartTime;
   mData->EnterRecord(duration);
 
+  // Recording is lock free (each thread writes its own buffer)
   if (system->mIsRecording && duration != 0)
-  {
-    TraceEvent event;
-    if (mData->mParent)
-      event.mCategory = mData->mParent->mName;
-    event.mName = mData->mName;
-    event.mArgs = mArgs;
-    event.mThreadId = Thread::GetCurrentThreadId();
-    event.mTimestamp = mStartTime;
-    event.mDuration = duration;
-
-    system->mTraceEventsLock.Lock();
-    system->mTraceEvents.PushBack(event);
-    system->mTraceEventsLock.Unlock();
-  }
+    system->RecordSample(mData, mArgs, mStartTime, duration);
 }
 
 void PrintProfileGraph(Record* record, double total, int level)
@@ -5,6 +5,8 @@
 #include "Array.hpp"
 #include "InList.hpp"
 #include "Timer.hpp"
+#include "HashMap.hpp"
+#include "File.hpp"
 
 namespace Plasma
 {
@@ -28,6 +30,83 @@ public:
   ProfileTime mDuration;
 };
 
+/// A completed scope as it is stored by the thread that ran it. Converted into
+/// a TraceEvent only when the trace is collected.
+struct TraceSample
+{
+  Record* mRecord;
+  String mArgs;
+  ProfileTime mTimestamp;
+  ProfileTime mDuration;
+};
+
+/// A ring of samples recorded by a single thread. Only the owning thread writes
+/// and only the ProfileSystem (one collector at a time) reads, so recording a
+/// sample never takes a lock. Samples are dropped when the ring is full.
+/// The ring is only allocated while tracing.
+class ThreadTraceBuffer
+{
+public:
+  ThreadTraceBuffer(size_t threadId);
+  ~ThreadTraceBuffer();
+
+  /// Called only by the owning thread.
+  void Push(Record* record, StringParam args, ProfileTime timestamp, ProfileTime duration);
+  /// Moves every sample written so far into output (oldest first).
+  void Drain(Array<TraceEvent>& output);
+
+  /// Allocates an empty ring. Called by the collector when tracing begins.
+  void Allocate();
+  /// Frees the ring. The owning thread must not be writing.
+  void Free();
+  bool IsAllocated()
+  {
+    return mSamples != nullptr;
+  }
+
+  static const s64 cCapacity = 1 << 15;
+
+  size_t mThreadId;
+  String mThreadName;
+  /// Samples lost because the collector didn't keep up.
+  Atomic<s32> mDroppedCount;
+  /// Set by the owning thread while it records a sample so the collector
+  /// knows when it's safe to free the ring.
+  Atomic<bool> mWriting;
+
+private:
+  volatile s64 mWrite;
+  volatile s64 mRead;
+  TraceSample* mSamples;
+};
+
+/// Writes trace events as Chrome trace event JSON (also loaded by Perfetto).
+/// Events are appended as they are given, and when writing to a file the text is
+/// flushed as it grows so a long capture never has to be held in memory at once.
+class ChromeTraceWriter
+{
+public:
+  ChromeTraceWriter();
+  ~ChromeTraceWriter();
+
+  /// Streams to the given file instead of keeping the text in memory.
+  bool Open(StringParam filePath);
+  void Write(Array<TraceEvent>& events);
+  /// Names a thread in the viewer (written once per thread).
+  void WriteThreadName(size_t threadId, StringParam threadName);
+  /// Finishes the json. Returns the text when not writing to a file.
+  String Close();
+
+private:
+  void BeginEvent();
+  void Flush();
+
+  File mFile;
+  StringBuilder mBuilder;
+  bool mFirstEvent;
+  HashSet<size_t> mNamedThreads;
+};
+
 /// System to manage all of the profile records.
 class ProfileSystem
 {
@@ -39,19 +118,58 @@ public:
   void Add(Record* record);
   void Add(StringParam parentName, Record* record);
   float GetTimeInSeconds(ProfileTime time);
+  /// Full precision, as float seconds lose microseconds a few minutes in.
+  double GetTimeInMicroseconds(ProfileTime time);
+  /// Safe to call from any thread.
   ProfileTime GetTime();
+
+  /// Names the calling thread in captured traces.
+  static void SetThreadName(StringParam threadName);
+  /// Frees the calling thread's trace buffer. Threads call this before they exit;
+  /// anything they recorded is kept for the capture in progress.
+  static void ReleaseThreadBuffer();
+
   void BeginTracing();
+  /// Begins tracing and streams the capture to the given file as Chrome trace json.
+  /// The file is completed when tracing ends (or when the profile system shuts down).
+  void BeginTracing(StringParam filePath);
+  /// Collects everything recorded so far, writing it to the trace file when
+  /// streaming and otherwise keeping it until EndTracing. Cheap enough to be
+  /// called once per frame so the per thread rings never fill.
+  void FlushTracing();
   void EndTracing(Array<TraceEvent>& output);
+  bool IsTracing()
+  {
+    return mIsRecording;
+  }
+
   Array<Record*>::range GetRecords()
   {
     return mRecordList.All();
   }
 
 private:
+  /// Returns the calling thread's buffer, creating it on first use.
+  ThreadTraceBuffer* GetThreadBuffer();
+  /// Records a completed scope into the calling thread's buffer.
+  void RecordSample(Record* record, StringParam args, ProfileTime timestamp, ProfileTime duration);
+  /// Collects the samples of every thread. Must hold mBuffersLock.
+  void DrainBuffers(Array<TraceEvent>& output);
+  /// Hands collected events to the trace file, or keeps them until EndTracing
+  /// when not streaming. Must hold mBuffersLock.
+  void StoreEvents(Array<TraceEvent>& events);
+
   Atomic<bool> mIsRecording;
-  SpinLock mTraceEventsLock;
-  Array<TraceEvent> mTraceEvents;
+
+  ThreadLock mBuffersLock;
+  Array<ThreadTraceBuffer*> mBuffers;
+  ChromeTraceWriter* mStreamWriter;
+  /// Events collected during an in-memory capture.
+  Array<TraceEvent> mCollectedEvents;
+
+  ThreadLock mRecordLock;
   Array<Record*> mRecordList;
+  HashMap<String, Record*> mRecordsByName;
   Timer mTimer;
 };
 
@@ -62,6 +180,7 @@ class Record : public LinkBase
 public:
   friend class ProfileSystem;
   friend class ScopeTimer;
+  friend class ThreadTraceBuffer;
   Record();
   Record(StringParam name);
   Record(StringParam name, StringParam parentName, u32 color = 0);
@@ -123,9 +242,9 @@ private:
   u32 mColor;
   String mName;
 
-  // General measurement
-  u32 mHits;
-  ProfileTime mTotalTime;
+  // General measurement (records are entered from any thread)
+  Atomic<u32> mHits;
+  Atomic<ProfileTime> mTotalTime;
   ProfileTime mMaxTime;
 
   // Running Average
@@ -143,11 +262,13 @@ private:
 class ScopeTimer
 {
 public:
-  ScopeTimer(Record* data, String args = String());
+  ScopeTimer(Record* data);
+  ScopeTimer(Record* data, StringParam args);
   ~ScopeTimer();
 
   Record* mData;
   ProfileTime mStartTime;
+  // Only filled out while tracing so untraced scopes never touch the string.
   String mArgs;
 };
 
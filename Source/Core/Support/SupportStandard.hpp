@@ -6,6 +6,7 @@
 
 #include "Urls.hpp"
 #include "FileSupport.hpp"
+#include "DiskCache.hpp"
 #include "Profiler.hpp"
 #include "NameValidation.hpp"
 #include "ChunkReader.hpp"
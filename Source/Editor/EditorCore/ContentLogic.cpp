@@ -55,6 +55,16 @@ void LoadContentConfig()
 	contentSystem->PrebuiltContentPath =
 		FilePath::Combine(sourceDirectory, "Build", "PrebuiltContent", revisionChangesetName);
 	PlasmaPrint("Content output directory '%s'\n", contentSystem->ContentOutputPath.c_str());
+
+	// Parsed level and archetype trees are cached next to the built content
+	DataTreeCache::SetDirectory(FilePath::Combine(contentSystem->ContentOutputPath, "DataTreeCache"));
+
+	// Built content is cached outside of the content output, so it's shared by
+	// every project and branch built with this version
+	ContentBuildCache::SetDirectory(FilePath::Combine(contentOutputDirectory, "ContentBuildCache", revisionChangesetName));
+
+	// Translated shaders are keyed by their fragment sources, so they're shared the same way
+	TranslatedShaderCache::SetDirectory(FilePath::Combine(contentOutputDirectory, "ShaderCache", revisionChangesetName));
 }
 
 bool LoadContentLibrary(StringParam name)
@@ -145,7 +145,7 @@ void ImportContentPackageListing(ContentPackageListing& listing, ContentLibrary*
   ResourceLibrary* resourceLibrary = PL::gResources->GetResourceLibrary(library->Name);
 
   Status status;
-  HandleOf<ResourcePackage> package = PL::gContentSystem->BuildContentItems(status, newContent, library, false);
+  HandleOf<ResourcePackage> package = PL::gContentSystem->BuildContentItems(status, newContent, library, true);
   DoNotifyStatus(status);
 
   // Load all resource generated into the active resource library
@@ -202,52 +202,9 @@ void EndTracing(Editor* editor)
   Array<Profile::TraceEvent> traceEvents;
   Profile::ProfileSystem::Instance->EndTracing(traceEvents);
 
-  static const String cCategory("cat");
-  static const String cProcessId("pid");
-  static const String cThreadId("tid");
-  static const String cTimeStamp("ts");
-  static const String cDuration("dur");
-  static const String cName("name");
-  static const String cArgs("args");
-  static const String cPhase("ph");
-  static const String cComplete("X");
-  static const String cValue("value");
-
-  Lightning::JsonBuilder builder;
-  builder.IsCompactMode = true;
-  builder.Begin(Lightning::JsonType::ArraySingleLine);
-  forRange (Profile::TraceEvent& traceEvent, traceEvents)
-  {
-    builder.Begin(Lightning::JsonType::Object);
-    builder.Key(cPhase);
-    builder.Value(cComplete);
-
-    builder.Key(cCategory);
-    builder.Value(traceEvent.mCategory);
-    builder.Key(cProcessId);
-    builder.Value(0);
-    builder.Key(cThreadId);
-    builder.Value(traceEvent.mThreadId);
-    builder.Key(cTimeStamp);
-    builder.Value(traceEvent.mTimestamp);
-    builder.Key(cDuration);
-    builder.Value(traceEvent.mDuration);
-    builder.Key(cName);
-    builder.Value(traceEvent.mName);
-
-    if (!traceEvent.mArgs.Empty())
-    {
-      builder.Key(cArgs);
-      builder.Begin(Lightning::JsonType::Object);
-      builder.Key(cValue);
-      builder.Value(traceEvent.mArgs);
-      builder.End();
-    }
-    builder.End();
-  }
-  builder.End();
-
-  String json = builder.ToString();
+  Profile::ChromeTraceWriter writer;
+  writer.Write(traceEvents);
+  String json = writer.Close();
 
   Archive archive(ArchiveMode::Compressing, CompressionLevel::MaxCompression);
   archive.AddFileBlock("trace.json", DataBlock((byte*)json.Data(), json.SizeInBytes()));
@@ -261,6 +218,71 @@ void EndTracing(Editor* editor)
   new SimpleSaveFileDialog(compressedData, "Save a trace", "Trace Zip File", "*.zip", "zip", defaultFileName);
 }
 
+void BenchmarkScriptCalls(Editor* editor)
+{
+  const size_t cIterations = 1000000;
+  Lightning::CallBenchmarkResults results;
+  if (!Lightning::RunCallBenchmark(cIterations, results))
+  {
+    PlasmaPrint("Script call benchmark failed to run\n");
+    return;
+  }
+
+  PlasmaPrint("Script call benchmark (%d calls): native to script %.1fns, script to script %.1fns per call\n",
+              (int)results.Iterations,
+              results.NativeToScriptNs,
+              results.ScriptToScriptNs);
+}
+
+void BenchmarkBroadPhases(Editor* editor)
+{
+  // Swept up to large scenes since the BroadPhases scale differently
+  const uint cObjectCounts[] = {10000, 50000, 100000, 200000};
+  const uint cFrameCount = 30;
+  const char* cBroadPhases[] = {"SoaDynamicAabbTree", "DynamicAabbTree", "AvlDynamicAabbTree", "Sap"};
+
+  for (uint countIndex = 0; countIndex < sizeof(cObjectCounts) / sizeof(cObjectCounts[0]); ++countIndex)
+  {
+    uint objectCount = cObjectCounts[countIndex];
+    PlasmaPrint("BroadPhase benchmark (%u moving objects, %u frames, times in ms)\n", objectCount, cFrameCount);
+    for (uint i = 0; i < sizeof(cBroadPhases) / sizeof(cBroadPhases[0]); ++i)
+    {
+      BroadPhaseBenchmarkResults results;
+      if (!RunBroadPhaseBenchmark(cBroadPhases[i], objectCount, cFrameCount, results))
+      {
+        PlasmaPrint("  %s: not registered\n", cBroadPhases[i]);
+        continue;
+      }
+
+      PlasmaPrint("  %s: create %.2f, update %.3f, self query %.3f, query %.3f per frame, %u pairs\n",
+                  cBroadPhases[i],
+                  results.mCreateMs,
+                  results.mUpdateMs,
+                  results.mSelfQueryMs,
+                  results.mQueryMs,
+                  (uint)results.mPairCount);
+    }
+  }
+}
+
+void BenchmarkGraphicalSort(Editor* editor)
+{
+  const uint cEntryCounts[] = {10000, 100000, 1000000};
+  const uint cSortCount = 10;
+
+  PlasmaPrint("Graphical entry sort benchmark (%u sorts each, times in ms)\n", cSortCount);
+  for (uint i = 0; i < sizeof(cEntryCounts) / sizeof(cEntryCounts[0]); ++i)
+  {
+    GraphicalEntrySortBenchmarkResults results;
+    RunGraphicalEntrySortBenchmark(cEntryCounts[i], cSortCount, results);
+    PlasmaPrint("  %u entries: radix sort %.3f, comparison sort %.3f%s\n",
+                cEntryCounts[i],
+                results.mRadixSortMs,
+                results.mComparisonSortMs,
+                results.mSameOrder ? "" : " (orders differ)");
+  }
+}
+
 void SetupGraphCommands(Cog* configCog, CommandManager* commands)
 {
   commands->AddCommand("EnableDebugging", BindCommandFunction(EnableDebugging), true);
@@ -272,6 +294,9 @@ void SetupGraphCommands(Cog* configCog, CommandManager* commands)
   commands->AddCommand("Graph", BindCommandFunction(AddGraph), true);
   commands->AddCommand("BeginTracing", BindCommandFunction(BeginTracing), true);
   commands->AddCommand("EndTracing", BindCommandFunction(EndTracing), true);
+  commands->AddCommand("BenchmarkScriptCalls", BindCommandFunction(BenchmarkScriptCalls), true);
+  commands->AddCommand("BenchmarkBroadPhases", BindCommandFunction(BenchmarkBroadPhases), true);
+  commands->AddCommand("BenchmarkGraphicalSort", BindCommandFunction(BenchmarkGraphicalSort), true);
 }
 
 } // namespace Plasma
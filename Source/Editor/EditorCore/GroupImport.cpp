@@ -439,7 +439,8 @@ HandleOf<ResourcePackage> ImportJob::BuildContentItems(Status& status, ContentIt
     
     UpdateTaskProgress((float)(i + 1) / toBuild.Size(), "Processing : " + contentItem->Filename);
 
-    contentItem->BuildContentItem(false);
+    contentItem->BuildContentItem(buildOptions);
+    contentItem->FinishBuild(buildOptions);
 
     if (buildOptions.Failure)
     {
@@ -69,6 +69,7 @@ namespace Plasma
 		mViewportInterface = nullptr;
 		mVisibilityId = static_cast<uint>(-1);
 		mRenderQueuesDataNeeded = false;
+		mCullingSlice = nullptr;
 	}
 
 	void Camera::OnDestroy(uint flags)
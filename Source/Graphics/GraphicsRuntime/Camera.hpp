@@ -116,6 +116,8 @@ namespace Plasma
 		// Needed by GraphicsSpace to access graphical entries.
 		Array<uint> mRenderGroupCounts;
 		Array<IndexRange> mGraphicalIndexRanges;
+		// Set while this camera is being culled on a worker thread.
+		CameraCullingSlice* mCullingSlice;
 
 		Array<uint> mRenderTaskRangeIndices;
 		bool mRenderQueuesDataNeeded;
@@ -123,5 +125,8 @@ namespace Plasma
 		// Id's of all requested RenderGroups during this Camera's RenderTasksEvent.
 		// Reset every frame before the event.
 		HashSet<int> mUsedRenderGroupIds;
+		// RenderGroups drawn by a RenderPass fragment that reads per object built-ins,
+		// their objects can't be drawn as instances. Reset with mUsedRenderGroupIds.
+		HashSet<int> mPerObjectInputRenderGroupIds;
 	};
 } // namespace Plasma
@@ -13,6 +13,7 @@ class Atlas;
 class BlendSettings;
 class Bone;
 class Camera;
+class CameraCullingSlice;
 class CreateRendererJob;
 class DepthSettings;
 class DestroyRendererJob;
@@ -124,13 +124,14 @@ void Graphical::Detached(AttachmentInfo& info)
 
 void Graphical::MidPhaseQuery(Array<GraphicalEntry>& entries, Camera& camera, Frustum* frustum)
 {
-  mGraphicalEntryData.mGraphical = this;
-  mGraphicalEntryData.mFrameNodeIndex = -1;
-  mGraphicalEntryData.mPosition = mTransform->GetWorldTranslation();
-  mGraphicalEntryData.mUtility = 0;
+  GraphicalEntryData& entryData = GetQueryEntryData(camera, mGraphicalEntryData);
+  entryData.mGraphical = this;
+  entryData.mFrameNodeIndex = -1;
+  entryData.mPosition = mTransform->GetWorldTranslation();
+  entryData.mUtility = 0;
 
   GraphicalEntry entry;
-  entry.mData = &mGraphicalEntryData;
+  entry.mData = &entryData;
   entry.mSort = 0;
 
   entries.PushBack(entry);
@@ -168,6 +169,11 @@ String Graphical::GetDefaultMaterialName()
   return MaterialManager::GetInstance()->DefaultResourceName;
 }
 
+bool Graphical::IsExtractionThreadSafe()
+{
+  return false;
+}
+
 bool Graphical::GetVisible()
 {
   return mVisible;
@@ -298,6 +304,13 @@ void Graphical::UpdateBroadPhaseAabb()
   }
 }
 
+GraphicalEntryData& Graphical::GetQueryEntryData(Camera& camera, GraphicalEntryData& sharedData)
+{
+  if (camera.mCullingSlice == nullptr)
+    return sharedData;
+  return camera.mCullingSlice->StageEntryData(sharedData);
+}
+
 void Graphical::OnShaderInputsModified(ShaderInputsEvent* event)
 {
   // Valid pointer already checked by GraphicsEngine
@@ -65,6 +65,10 @@ public:
   virtual bool TestFrustum(const Frustum& frustum, CastInfo& castInfo);
   virtual void AddToSpace();
   virtual String GetDefaultMaterialName();
+  // If ExtractFrameData/ExtractViewData only write to the nodes they're given, which lets
+  // them run on worker threads. Anything appending to the shared RenderQueues buffers
+  // (streamed vertices, skinning data) must stay false and is extracted on the main thread.
+  virtual bool IsExtractionThreadSafe();
 
   // Properties
 
@@ -128,6 +132,10 @@ public:
   Aabb GetLocalAabbInternal();
 
   void UpdateBroadPhaseAabb();
+  // The entry data a MidPhaseQuery should fill out. sharedData is used by every camera,
+  // so while cameras are culled in parallel the data is staged in the camera's culling
+  // slice and copied to sharedData when the slice is merged.
+  GraphicalEntryData& GetQueryEntryData(Camera& camera, GraphicalEntryData& sharedData);
   void OnShaderInputsModified(ShaderInputsEvent* event);
   void OnMaterialModified(ResourceEvent* event);
   void ComponentAdded(BoundType* typeId, Component* component) override;
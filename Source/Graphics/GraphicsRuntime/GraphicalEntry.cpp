@@ -92,4 +92,98 @@ s32 GetGraphicalSortValue(
   return value;
 }
 
+// Below this the fixed cost of the radix sort's histograms loses to a comparison sort.
+static const size_t cGraphicalEntryRadixSortMin = 256;
+
+struct GraphicalEntrySortKey
+{
+  u64 operator()(const GraphicalEntry& entry) const
+  {
+    return entry.mSort;
+  }
+};
+
+void SortGraphicalEntries(GraphicalEntryRange entries, Array<GraphicalEntry>& scratch)
+{
+  size_t count = entries.Size();
+  if (count < cGraphicalEntryRadixSortMin)
+  {
+    Sort(entries);
+    return;
+  }
+
+  scratch.Resize(count);
+  RadixSort(entries.Begin(), scratch.Data(), count, GraphicalEntrySortKey());
+}
+
+GraphicalEntrySortBenchmarkResults::GraphicalEntrySortBenchmarkResults() :
+    mRadixSortMs(0.0),
+    mComparisonSortMs(0.0),
+    mSameOrder(true)
+{
+}
+
+void RunGraphicalEntrySortBenchmark(uint entryCount,
+                                    uint sortCount,
+                                    GraphicalEntrySortBenchmarkResults& results)
+{
+  const uint cSeed = 1234;
+  const int cRenderGroupCount = 8;
+  const float cMaxDepth = 1000.0f;
+
+  Math::Random random(cSeed);
+  Array<GraphicalEntry> entries;
+  entries.Resize(entryCount);
+  for (uint i = 0; i < entryCount; ++i)
+  {
+    s32 depth = 0;
+    *(float*)&depth = random.FloatRange(0.0f, cMaxDepth);
+
+    GraphicalEntry& entry = entries[i];
+    entry.mData = nullptr;
+    entry.mSort = 0;
+    entry.mRenderGroupId = random.IntRangeInEx(0, cRenderGroupCount);
+    entry.SetRenderGroupSortValue(entry.mRenderGroupId);
+    entry.SetGraphicalSortValue(depth);
+  }
+
+  Array<GraphicalEntry> radixSorted;
+  Array<GraphicalEntry> comparisonSorted;
+  Array<GraphicalEntry> scratch;
+  scratch.Resize(entryCount);
+
+  Timer timer;
+  double radixTime = 0.0;
+  double comparisonTime = 0.0;
+  for (uint i = 0; i < sortCount; ++i)
+  {
+    radixSorted.Assign(entries.All());
+    timer.Reset();
+    RadixSort(radixSorted.Data(), scratch.Data(), radixSorted.Size(), GraphicalEntrySortKey());
+    radixTime += timer.UpdateAndGetTime();
+
+    comparisonSorted.Assign(entries.All());
+    timer.Reset();
+    Sort(comparisonSorted.All());
+    comparisonTime += timer.UpdateAndGetTime();
+  }
+
+  results.mSameOrder = true;
+  for (uint i = 0; i < radixSorted.Size() && i < comparisonSorted.Size(); ++i)
+  {
+    if (radixSorted[i].mSort != comparisonSorted[i].mSort)
+    {
+      results.mSameOrder = false;
+      break;
+    }
+  }
+
+  if (sortCount != 0)
+  {
+    const double cMillisecondsPerSecond = 1000.0;
+    results.mRadixSortMs = radixTime * cMillisecondsPerSecond / sortCount;
+    results.mComparisonSortMs = comparisonTime * cMillisecondsPerSecond / sortCount;
+  }
+}
+
 } // namespace Plasma
@@ -83,4 +83,28 @@ public:
 s32 GetGraphicalSortValue(
     Graphical& graphical, GraphicalSortMethod::Enum sortMethod, Vec3 pos, Vec3 camPos, Vec3 camDir);
 
+// Sorts entries by their sort value. Large ranges are radix sorted using the scratch
+// array, which should be kept around so it doesn't have to be reallocated every frame.
+void SortGraphicalEntries(GraphicalEntryRange entries, Array<GraphicalEntry>& scratch);
+
+/// Timings of RunGraphicalEntrySortBenchmark in milliseconds, averaged over every sort.
+class GraphicalEntrySortBenchmarkResults
+{
+public:
+  GraphicalEntrySortBenchmarkResults();
+
+  /// Sorting with the radix sort SortGraphicalEntries uses for large ranges.
+  double mRadixSortMs;
+  /// Sorting the same entries with the comparison sort.
+  double mComparisonSortMs;
+  /// Whether both sorts put the entries in the same order.
+  bool mSameOrder;
+};
+
+/// Sorts the same entries with both sorts, where each entry gets a random depth
+/// in one of a few RenderGroups like the entries a camera sorts every frame.
+void RunGraphicalEntrySortBenchmark(uint entryCount,
+                                    uint sortCount,
+                                    GraphicalEntrySortBenchmarkResults& results);
+
 } // namespace Plasma
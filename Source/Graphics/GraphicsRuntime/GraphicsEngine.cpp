@@ -119,7 +119,6 @@ void GraphicsEngine::Initialize(SystemInitializer& initializer)
   ConnectThisTo(LightningManager::GetInstance(), Events::ScriptsCompiledPostPatch, OnScriptsCompiledPostPatch);
   ConnectThisTo(LightningManager::GetInstance(), Events::ScriptCompilationFailed, OnScriptCompilationFailed);
 
-  ParticleList::Memory = new Memory::Pool("Particles", Memory::GetRoot(), sizeof(Particle), 1024);
   gShaderPool = new Memory::Pool("Shaders", Memory::GetRoot(), sizeof(Shader), 1024);
 
   mFrameCounter = 0;
@@ -192,9 +191,14 @@ void CollectShadersRenderTaskRenderPass(RenderTaskRenderPass* task,
     if (materialData == nullptr)
       continue;
 
+    // Instance batches are drawn with their own vertex fragment.
+    CoreVertexType::Enum coreVertexType = frameNode.mCoreVertexType;
+    if (viewNode.mInstanceRange.Count() != 0)
+      coreVertexType = CoreVertexType::InstancedMesh;
+
     // Shader permutation lookup for vertex type and render pass
     String name = BuildString(
-        GetCoreVertexFragmentName(frameNode.mCoreVertexType), materialData->mCompositeName, subTask->mRenderPassName);
+        GetCoreVertexFragmentName(coreVertexType), materialData->mCompositeName, subTask->mRenderPassName);
     shadersOut.PushBack(name);
   }
 }
@@ -699,6 +703,9 @@ void GraphicsEngine::CreateRenderer(OsWindow* mainWindow)
 
   CreateRendererJob* rendererJob = new CreateRendererJob();
   rendererJob->mMainWindowHandle = mainWindowHandle;
+  // The null renderer lets the cpu side of graphics run (and be measured) without a gpu.
+  bool nullRenderer = Environment::GetValue<bool>("NullRenderer", false);
+  rendererJob->mAPI = nullRenderer ? RenderAPI::Null : RenderAPI::OpenGL;
   AddRendererJob(rendererJob);
   rendererJob->WaitOnThisJob();
 
@@ -731,6 +738,7 @@ void GraphicsEngine::AddMaterial(Material* material)
   rendererJob->mRenderData = material->mRenderData;
   rendererJob->mCompositeName = material->mCompositeName;
   rendererJob->mMaterialId = material->mResourceId.mValue;
+  rendererJob->mReadsPerObjectInputs = material->mReadsPerObjectInputs;
 
   AddRendererJob(rendererJob);
 }
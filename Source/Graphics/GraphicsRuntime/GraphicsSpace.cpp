@@ -96,6 +96,52 @@ void GraphicsSpace::OnLogicUpdate(UpdateEvent* event)
   mLogicTime += event->Dt;
 }
 
+struct CameraCullTask
+{
+  void operator()(uint index)
+  {
+    Transform::UncachedWorldMatrixScope uncached;
+    mSpace->CullCamera((*mSlices)[index], mRenderGroupCount);
+  }
+
+  GraphicsSpace* mSpace;
+  Array<CameraCullingSlice>* mSlices;
+  uint mRenderGroupCount;
+};
+
+struct ExtractFrameDataTask
+{
+  void operator()(uint index)
+  {
+    Transform::UncachedWorldMatrixScope uncached;
+    FrameNode& node = (*mFrameNodes)[index];
+    Graphical* graphical = ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical;
+    if (graphical->IsExtractionThreadSafe())
+      graphical->ExtractFrameData(node, *mFrameBlock);
+  }
+
+  Array<FrameNode>* mFrameNodes;
+  FrameBlock* mFrameBlock;
+};
+
+struct ExtractViewDataTask
+{
+  void operator()(uint index)
+  {
+    Transform::UncachedWorldMatrixScope uncached;
+    ViewNode& node = mViewBlock->mViewNodes[index];
+    Graphical* graphical = ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical;
+    if (graphical->IsExtractionThreadSafe())
+      graphical->ExtractViewData(node, *mViewBlock, *mFrameBlock);
+  }
+
+  ViewBlock* mViewBlock;
+  FrameBlock* mFrameBlock;
+};
+
+// Nodes are cheap to extract, so hand them out in chunks.
+static const uint cExtractGrainSize = 64;
+
 // currently considering keeping this as a part of graphics update and not frame
 // update
 void GraphicsSpace::OnFrameUpdate(float frameDt)
@@ -129,82 +175,145 @@ void GraphicsSpace::OnFrameUpdate(float frameDt)
   CreateDebugGraphicals();
 
   mVisibleGraphicals.Clear();
-  uint lastIndex = 0;
 
   uint renderGroupCount = mGraphicsEngine->GetRenderGroupCount();
   ErrorIf(renderGroupCount == 0, "No render groups, core resources must be missing.");
 
-  // for each view object in use
+  uint cameraCount = 0;
   forRange (Camera& camera, mCameras.All())
   {
-    // Ranges must be cleared from the last this camera was used
-    // Must be cleared before RenderTasks event is sent out
-    // because render pass tasks can add to this array
-    camera.mGraphicalIndexRanges.Clear();
-
-    // resize to number of render types
-    camera.mRenderGroupCounts.Resize(renderGroupCount);
-    for (uint i = 0; i < camera.mRenderGroupCounts.Size(); ++i)
-      camera.mRenderGroupCounts[i] = 0;
+    if (cameraCount == mCullingSlices.Size())
+      mCullingSlices.PushBack();
+    mCullingSlices[cameraCount++].mCamera = &camera;
+  }
 
-    Vec3 cameraPos = camera.mTransform->GetWorldTranslation();
-    Mat3 rotation = Math::ToMatrix3(camera.mTransform->GetWorldRotation());
-    Vec3 cameraDir = -rotation.BasisZ();
+  CameraCullTask task;
+  task.mSpace = this;
+  task.mSlices = &mCullingSlices;
+  task.mRenderGroupCount = renderGroupCount;
+  PL::gJobs->ParallelFor(cameraCount, task);
 
-    Frustum frustum = camera.GetFrustum(camera.mViewportInterface->GetAspectRatio());
+  uint totalEntries = 0;
+  for (uint i = 0; i < cameraCount; ++i)
+    totalEntries += mCullingSlices[i].mEntries.Size();
+  mVisibleGraphicals.Reserve(totalEntries);
 
-    // Visibility culled graphicals
-    forRangeBroadphaseTree(GraphicsBroadPhase, mBroadPhase, Frustum, frustum)
-        AddToVisibleGraphicals(*range.Front(), camera, cameraPos, cameraDir, &frustum);
+  // Merge in camera order so the result is the same as culling serially.
+  for (uint i = 0; i < cameraCount; ++i)
+    MergeCullingSlice(mCullingSlices[i]);
+}
 
-    // Not culled
-    forRange (Graphical& graphical, mGraphicalsNeverCulled.All())
-      AddToVisibleGraphicals(graphical, camera, cameraPos, cameraDir);
+GraphicalEntryData& CameraCullingSlice::StageEntryData(GraphicalEntryData& sharedData)
+{
+  StagedEntryData& staged = mStagedEntryData.PushBack();
+  staged.mSharedData = &sharedData;
+  return staged.mData;
+}
 
-    // Get DebugGraphical entries, not broadphased
-    // DebugGraphicals exist for one frame and are not placed in broadphase
-    forRange (Graphical& graphical, mDebugGraphicals.All())
+GraphicalEntryData* CameraCullingSlice::GetSharedEntryData(GraphicalEntryData* data, uint& stagedIndex)
+{
+  // Queries stage data in the same order they add entries, so this is almost always
+  // found on the first or second check.
+  for (uint i = stagedIndex; i < mStagedEntryData.Size(); ++i)
+  {
+    StagedEntryData& staged = mStagedEntryData[i];
+    if (&staged.mData == data)
     {
-      DebugGraphical* debugGraphical = (DebugGraphical*)&graphical;
-      if (debugGraphical->mDebugObjects.Size() == 0)
-        continue;
-
-      AddToVisibleGraphicals(graphical, camera, cameraPos, cameraDir);
+      stagedIndex = i;
+      return staged.mSharedData;
     }
+  }
+  return data;
+}
 
-    uint index = mVisibleGraphicals.Size();
-    IndexRange indexRange(lastIndex, index);
-    lastIndex = index;
+void GraphicsSpace::CullCamera(CameraCullingSlice& slice, uint renderGroupCount)
+{
+  Camera& camera = *slice.mCamera;
+  slice.mEntries.Clear();
+  slice.mVisible.Clear();
+  slice.mStagedEntryData.Clear();
+
+  // Graphicals share their entry data between cameras (so they get a single FrameNode),
+  // so queries write to this slice instead while cameras are culled in parallel.
+  camera.mCullingSlice = &slice;
+
+  // Ranges must be cleared from the last this camera was used
+  // Must be cleared before RenderTasks event is sent out
+  // because render pass tasks can add to this array
+  camera.mGraphicalIndexRanges.Clear();
+
+  // resize to number of render types
+  camera.mRenderGroupCounts.Resize(renderGroupCount);
+  for (uint i = 0; i < camera.mRenderGroupCounts.Size(); ++i)
+    camera.mRenderGroupCounts[i] = 0;
+
+  Vec3 cameraPos = camera.mTransform->GetWorldTranslation();
+  Mat3 rotation = Math::ToMatrix3(camera.mTransform->GetWorldRotation());
+  Vec3 cameraDir = -rotation.BasisZ();
+
+  Frustum frustum = camera.GetFrustum(camera.mViewportInterface->GetAspectRatio());
+
+  // Visibility culled graphicals
+  forRangeBroadphaseTree(GraphicsBroadPhase, mBroadPhase, Frustum, frustum)
+      AddToVisibleGraphicals(slice, *range.Front(), cameraPos, cameraDir, &frustum);
+
+  // Not culled
+  forRange (Graphical& graphical, mGraphicalsNeverCulled.All())
+    AddToVisibleGraphicals(slice, graphical, cameraPos, cameraDir);
+
+  // Get DebugGraphical entries, not broadphased
+  // DebugGraphicals exist for one frame and are not placed in broadphase
+  forRange (Graphical& graphical, mDebugGraphicals.All())
+  {
+    DebugGraphical* debugGraphical = (DebugGraphical*)&graphical;
+    if (debugGraphical->mDebugObjects.Size() == 0)
+      continue;
 
-    uint start = indexRange.start;
-    uint size = indexRange.end - indexRange.start;
+    AddToVisibleGraphicals(slice, graphical, cameraPos, cameraDir);
+  }
 
-    camera.mGraphicalIndexRanges.PushBack(indexRange);
+  // Sort entries of this camera
+  // This sort will have all entries correctly organized by RenderGroup
+  // If a custom sort is enabled, it can then be re-sorted within that
+  // RenderGroup
+  SortGraphicalEntries(slice.mEntries.All(), slice.mSortScratch);
 
-    // Sort entries of this camera
-    // This sort will have all entries correctly organized by RenderGroup
-    // If a custom sort is enabled, it can then be re-sorted within that
-    // RenderGroup
-    Sort(mVisibleGraphicals.SubRange(start, size));
+  camera.mCullingSlice = nullptr;
+}
 
-    // Check for any RenderGroup with a custom sort and find its range of
-    // elements
-    for (uint i = 0, rangeStart = 0; i < camera.mRenderGroupCounts.Size(); ++i)
-    {
-      uint rangeEnd = rangeStart + camera.mRenderGroupCounts[i];
+void GraphicsSpace::MergeCullingSlice(CameraCullingSlice& slice)
+{
+  Camera& camera = *slice.mCamera;
 
-      RenderGroup* renderGroup = (RenderGroup*)mGraphicsEngine->mRenderGroups[i];
-      if (renderGroup->mGraphicalSortMethod == GraphicalSortMethod::SortEvent)
-      {
-        GraphicalSortEvent sortEvent;
-        sortEvent.mGraphicalEntries = mVisibleGraphicals.SubRange(rangeStart, rangeEnd - rangeStart);
-        sortEvent.mRenderGroup = renderGroup;
-        camera.mViewportInterface->SendSortEvent(&sortEvent);
-        Sort(mVisibleGraphicals.SubRange(rangeStart, rangeEnd - rangeStart));
-      }
+  // Publish the entry data that was staged while culling. Every camera writes the
+  // same values for a graphical, so the order doesn't matter.
+  forRange (StagedEntryData& staged, slice.mStagedEntryData.All())
+    *staged.mSharedData = staged.mData;
 
-      rangeStart = rangeEnd;
+  uint start = mVisibleGraphicals.Size();
+  mVisibleGraphicals.Append(slice.mEntries.All());
+  camera.mGraphicalIndexRanges.PushBack(IndexRange(start, mVisibleGraphicals.Size()));
+
+  forRange (Graphical* graphical, slice.mVisible.All())
+    graphical->mVisibleFlags.SetFlag(camera.mVisibilityId);
+
+  // Check for any RenderGroup with a custom sort and find its range of
+  // elements. Sort events can go to script so they're sent from here.
+  for (uint i = 0, rangeStart = start; i < camera.mRenderGroupCounts.Size(); ++i)
+  {
+    uint rangeEnd = rangeStart + camera.mRenderGroupCounts[i];
+
+    RenderGroup* renderGroup = (RenderGroup*)mGraphicsEngine->mRenderGroups[i];
+    if (renderGroup->mGraphicalSortMethod == GraphicalSortMethod::SortEvent)
+    {
+      GraphicalSortEvent sortEvent;
+      sortEvent.mGraphicalEntries = mVisibleGraphicals.SubRange(rangeStart, rangeEnd - rangeStart);
+      sortEvent.mRenderGroup = renderGroup;
+      camera.mViewportInterface->SendSortEvent(&sortEvent);
+      SortGraphicalEntries(mVisibleGraphicals.SubRange(rangeStart, rangeEnd - rangeStart), mSortScratch);
     }
+
+    rangeStart = rangeEnd;
   }
 }
 
@@ -306,6 +415,7 @@ void GraphicsSpace::RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& r
       indexRange.start += groupCount;
 
       viewBlock.mRenderGroupRanges.PushBack(IndexRange(rangeStart, rangeEnd));
+      viewBlock.mRenderGroupReadsPerObjectInputs.PushBack(camera.mPerObjectInputRenderGroupIds.Contains(i));
       rangeStart = rangeEnd;
     }
 
@@ -358,21 +468,13 @@ void GraphicsSpace::RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& r
     }
   }
 
-  // extract frame node data
-  forRange (FrameNode& node, frameNodes.All())
-  {
-    ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical->ExtractFrameData(node, frameBlock);
-  }
+  ExtractRenderData(frameBlock, viewBlockStartIndex);
 
-  // only process view blocks from this graphics space
-  for (uint i = viewBlockStartIndex; i < renderQueues.mViewBlocks.Size(); ++i)
+  // Has to be after extraction, batches are built from the view transforms.
+  if (PL::gRenderer->mDriverSupport.mInstancing)
   {
-    // extract view node data
-    ViewBlock& viewBlock = renderQueues.mViewBlocks[i];
-    forRange (ViewNode& node, viewBlock.mViewNodes.All())
-    {
-      ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical->ExtractViewData(node, viewBlock, frameBlock);
-    }
+    for (uint i = viewBlockStartIndex; i < renderQueues.mViewBlocks.Size(); ++i)
+      renderQueues.BuildInstanceBatches(renderQueues.mViewBlocks[i], frameBlock);
   }
 
   // Waiting to send these events until after render data is collected
@@ -386,7 +488,7 @@ void GraphicsSpace::RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& r
 }
 
 void GraphicsSpace::AddToVisibleGraphicals(
-    Graphical& graphical, Camera& camera, Vec3 cameraPos, Vec3 cameraDir, Frustum* frustum)
+    CameraCullingSlice& slice, Graphical& graphical, Vec3 cameraPos, Vec3 cameraDir, Frustum* frustum)
 {
   if (GetOwner()->IsEditorMode() && graphical.GetOwner()->GetEditorViewportHidden())
     return;
@@ -394,13 +496,20 @@ void GraphicsSpace::AddToVisibleGraphicals(
   if (graphical.GetOwner()->GetMarkedForDestruction())
     return;
 
-  graphical.mVisibleFlags.SetFlag(camera.mVisibilityId);
+  // Other cameras can be culling this graphical, flags are set when the slice is merged.
+  slice.mVisible.PushBack(&graphical);
 
-  Array<GraphicalEntry> entries;
+  Camera& camera = *slice.mCamera;
+  Array<GraphicalEntry>& entries = slice.mQueryEntries;
+  entries.Clear();
+  uint stagedIndex = slice.mStagedEntryData.Size();
   graphical.MidPhaseQuery(entries, camera, frustum);
   forRange (GraphicalEntry& entry, entries.All())
   {
+    // Sort by the staged values, but point the entry at the shared data that
+    // extraction will use once the slice is merged.
     Vec3 pos = entry.mData->mPosition;
+    entry.mData = slice.GetSharedEntryData(entry.mData, stagedIndex);
     // Make entry for each RenderGroup associated with this Graphical's
     // Material.
     forRange (RenderGroup* renderGroup, graphical.mMaterial->mActiveResources.All())
@@ -427,7 +536,7 @@ void GraphicsSpace::AddToVisibleGraphicals(
 
         // Materials will not refer to RenderGroups that have not been given an
         // id.
-        mVisibleGraphicals.PushBack(entry);
+        slice.mEntries.PushBack(entry);
         // Add to RenderGroup counters so they can be accessed by index later.
         ++camera.mRenderGroupCounts[renderGroup->mSortId];
 
@@ -440,6 +549,46 @@ void GraphicsSpace::AddToVisibleGraphicals(
   }
 }
 
+void GraphicsSpace::ExtractRenderData(FrameBlock& frameBlock, uint viewBlockStartIndex)
+{
+  RenderQueues& renderQueues = *frameBlock.mRenderQueues;
+
+  // extract frame node data, thread safe graphicals first
+  ExtractFrameDataTask frameTask;
+  frameTask.mFrameNodes = &frameBlock.mFrameNodes;
+  frameTask.mFrameBlock = &frameBlock;
+  PL::gJobs->ParallelFor(frameBlock.mFrameNodes.Size(), frameTask, cExtractGrainSize);
+
+  // only process view blocks from this graphics space
+  for (uint i = viewBlockStartIndex; i < renderQueues.mViewBlocks.Size(); ++i)
+  {
+    ExtractViewDataTask viewTask;
+    viewTask.mViewBlock = &renderQueues.mViewBlocks[i];
+    viewTask.mFrameBlock = &frameBlock;
+    PL::gJobs->ParallelFor(viewTask.mViewBlock->mViewNodes.Size(), viewTask, cExtractGrainSize);
+  }
+
+  // Everything else writes to the shared RenderQueues buffers, extracting in the
+  // original order keeps the buffers laid out the same as before.
+  forRange (FrameNode& node, frameBlock.mFrameNodes.All())
+  {
+    Graphical* graphical = ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical;
+    if (!graphical->IsExtractionThreadSafe())
+      graphical->ExtractFrameData(node, frameBlock);
+  }
+
+  for (uint i = viewBlockStartIndex; i < renderQueues.mViewBlocks.Size(); ++i)
+  {
+    ViewBlock& viewBlock = renderQueues.mViewBlocks[i];
+    forRange (ViewNode& node, viewBlock.mViewNodes.All())
+    {
+      Graphical* graphical = ((GraphicalEntry*)node.mGraphicalEntry)->mData->mGraphical;
+      if (!graphical->IsExtractionThreadSafe())
+        graphical->ExtractViewData(node, viewBlock, frameBlock);
+    }
+  }
+}
+
 void GraphicsSpace::CreateDebugGraphicals()
 {
   if (mDebugDrawGraphicals[0] == nullptr)
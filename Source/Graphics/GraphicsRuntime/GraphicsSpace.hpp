@@ -27,6 +27,37 @@ class RaycastResultList;
 
 typedef AvlDynamicAabbTree<Graphical*> GraphicsBroadPhase;
 
+/// Entry data written by a MidPhaseQuery while its camera is culled on a worker thread.
+class StagedEntryData
+{
+public:
+  GraphicalEntryData mData;
+  // The graphical's data, shared by every camera. Written when the slice is merged.
+  GraphicalEntryData* mSharedData;
+};
+
+/// Visible entries found for one Camera. Every camera is culled and sorted into its own
+/// slice on a worker thread and the slices are then merged into mVisibleGraphicals.
+class CameraCullingSlice
+{
+public:
+  // Returns data for a MidPhaseQuery to fill out in place of sharedData.
+  GraphicalEntryData& StageEntryData(GraphicalEntryData& sharedData);
+  // Returns the shared data that data was staged for, searching from stagedIndex
+  // (advanced to the match). Returns data if it wasn't staged.
+  GraphicalEntryData* GetSharedEntryData(GraphicalEntryData* data, uint& stagedIndex);
+
+  Camera* mCamera;
+  Array<GraphicalEntry> mEntries;
+  // Graphicals that get this camera's visibility flag once merged.
+  Array<Graphical*> mVisible;
+  // Block allocated so the addresses handed to queries stay valid.
+  PodBlockArray<StagedEntryData> mStagedEntryData;
+  // Scratch space for MidPhaseQuery and sorting.
+  Array<GraphicalEntry> mQueryEntries;
+  Array<GraphicalEntry> mSortScratch;
+};
+
 /// Core space component that manages all interactions between graphics related
 /// objects.
 class GraphicsSpace : public Component
@@ -54,8 +85,15 @@ public:
   void RenderTasksUpdate(RenderTasks& renderTasks);
   void RenderQueuesUpdate(RenderTasks& renderTasks, RenderQueues& renderQueues);
 
-  void AddToVisibleGraphicals(
-      Graphical& graphical, Camera& camera, Vec3 cameraPos, Vec3 cameraDir, Frustum* frustum = nullptr);
+  // Can be called for different cameras at the same time.
+  void CullCamera(CameraCullingSlice& slice, uint renderGroupCount);
+  void AddToVisibleGraphicals(CameraCullingSlice& slice,
+                              Graphical& graphical,
+                              Vec3 cameraPos,
+                              Vec3 cameraDir,
+                              Frustum* frustum = nullptr);
+  void MergeCullingSlice(CameraCullingSlice& slice);
+  void ExtractRenderData(FrameBlock& frameBlock, uint viewBlockStartIndex);
   void CreateDebugGraphicals();
 
   Link<GraphicsSpace> EngineLink;
@@ -93,6 +131,10 @@ public:
   GraphicsBroadPhase mBroadPhase;
 
   Array<GraphicalEntry> mVisibleGraphicals;
+  // One per camera, kept between frames so their arrays don't have to be reallocated.
+  Array<CameraCullingSlice> mCullingSlices;
+  // For sorting RenderGroups that use sort events.
+  Array<GraphicalEntry> mSortScratch;
 
   Array<uint> mRenderTaskRangeIndices;
 
@@ -58,6 +58,7 @@ public:
 #include "LightningFragment.hpp"
 #include "PlasmaLightningShaderGlslBackend.hpp"
 #include "LightningShaderGenerator.hpp"
+#include "TranslatedShaderCache.hpp"
 
 // Some Dependencies
 #include "Atlas.hpp"
@@ -65,6 +66,7 @@ public:
 #include "MaterialFactory.hpp"
 #include "ParticleEmitters.hpp"
 #include "RendererThread.hpp"
+#include "NullRenderer.hpp"
 
 // Base Graphicals
 #include "Graphical.hpp"
@@ -129,7 +129,7 @@ namespace Plasma
                 HeightPatch* heightPatch = pair.first;
                 GraphicalHeightPatch& graphicalPatch = pair.second;
 
-                AddGraphicalPatchEntry(entries, graphicalPatch, heightPatch->Index);
+                AddGraphicalPatchEntry(entries, camera, graphicalPatch, heightPatch->Index);
             }
         }
         else
@@ -142,7 +142,7 @@ namespace Plasma
 
                 Aabb aabb = graphicalPatch.mLocalAabb.TransformAabb(worldMatrix);
                 if (Overlap(aabb, *frustum))
-                    AddGraphicalPatchEntry(entries, graphicalPatch, heightPatch->Index);
+                    AddGraphicalPatchEntry(entries, camera, graphicalPatch, heightPatch->Index);
             }
         }
     }
@@ -166,11 +166,17 @@ namespace Plasma
         return "DefaultHeightMapMaterial";
     }
 
+    bool HeightMapModel::IsExtractionThreadSafe()
+    {
+        return true;
+    }
+
     void HeightMapModel::AddGraphicalPatchEntry(Array<GraphicalEntry>& entries,
+                                                Camera& camera,
                                                 GraphicalHeightPatch& graphicalPatch,
                                                 PatchIndex index)
     {
-        GraphicalEntryData& entryData = graphicalPatch.mGraphicalEntryData;
+        GraphicalEntryData& entryData = GetQueryEntryData(camera, graphicalPatch.mGraphicalEntryData);
         entryData.mGraphical = this;
         entryData.mFrameNodeIndex = -1;
         entryData.mPosition = mTransform->GetWorldTranslation();
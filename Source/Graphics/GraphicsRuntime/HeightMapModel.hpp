@@ -53,10 +53,14 @@ public:
   void MidPhaseQuery(Array<GraphicalEntry>& entries, Camera& camera, Frustum* frustum) override;
   bool TestRay(GraphicsRayCast& rayCast, CastInfo& castInfo) override;
   String GetDefaultMaterialName() override;
+  bool IsExtractionThreadSafe() override;
 
   // Internal
 
-  void AddGraphicalPatchEntry(Array<GraphicalEntry>& entries, GraphicalHeightPatch& graphicalPatch, PatchIndex index);
+  void AddGraphicalPatchEntry(Array<GraphicalEntry>& entries,
+                              Camera& camera,
+                              GraphicalHeightPatch& graphicalPatch,
+                              PatchIndex index);
 
   void OnPatchAdded(HeightMapEvent* event);
   void OnPatchRemoved(HeightMapEvent* event);
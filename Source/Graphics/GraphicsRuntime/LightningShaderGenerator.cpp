@@ -161,9 +161,15 @@ namespace Plasma
         // miscData.AddField(sampledImage2dType, "HeightMapWeights");
         settings->AddUniformBufferDescription(miscData);
 
+        // Per instance transforms for instance batches, see RenderQueues::BuildInstanceBatches.
+        UniformBufferDescription instanceData(4);
+        instanceData.mDebugName = "InstanceData";
+        instanceData.AddField(boneTransformsType, "InstanceTransforms");
+        settings->AddUniformBufferDescription(instanceData);
+
         settings->AutoSetDefaultUniformBufferDescription();
 
-        settings->SetHardwareBuiltInName(spv::BuiltInPosition, "ApiPerspectivePosition");
+        settings->SetHardwareBuiltInName(spv::BuiltInPosition, nameSettings.mApiPerspectivePositionName);
 
         // Utility
 
@@ -175,6 +181,7 @@ namespace Plasma
                                                       nullptr);
 
         settings->Finalize();
+        mSettingsHash = GetSettingsHash();
 
         mFrontEndTranslator = new LightningSpirVFrontEnd();
         mFrontEndTranslator->SetSettings(mSpirVSettings);
@@ -410,7 +417,8 @@ namespace Plasma
         mFragmentsProject.Clear();
         mFragmentsProject.mProjectName = libraryName;
 
-        // Add all fragments
+        // Add all fragments (and hash their sources to key translated shaders)
+        Sha1Builder sourceHash;
         forRange(Resource* resource, fragments.All())
         {
             // Templates shouldn't be compiled. They contain potentially invalid code
@@ -421,6 +429,11 @@ namespace Plasma
 
             LightningFragment* fragment = static_cast<LightningFragment*>(resource);
             mFragmentsProject.AddCodeFromString(fragment->mText, fragment->GetOrigin(), resource);
+
+            // Hash the size first so the text of one fragment can't shift into the next
+            uint textSize = (uint)fragment->mText.SizeInBytes();
+            sourceHash.Append(String::Format("%s %u\n", fragment->GetOrigin().c_str(), textSize));
+            sourceHash.Append(fragment->mText);
         }
 
         // Internal dependencies used to build the internal library
@@ -474,12 +487,14 @@ namespace Plasma
         {
             if (pendingLib->Name == library->Name)
             {
+                mLibrarySourceHashes.Erase(pendingLib);
                 mPendingToPendingInternal.Erase(pendingLib);
                 break;
             }
         }
 
         mPendingToPendingInternal.Insert(library, fragmentsLibrary);
+        mLibrarySourceHashes.Insert(library, sourceHash.OutputHashString());
 
         LightningFragmentTypeMap& fragmentTypes = mPendingFragmentTypes[library];
         fragmentTypes.Clear();
@@ -519,6 +534,7 @@ namespace Plasma
                     pendingLibrary, nullptr);
                 ErrorIf(internalPendingLibrary == nullptr, "Invalid pending library");
 
+                mLibrarySourceHashes.Erase(library->mSwapFragment.mCurrentLibrary);
                 mCurrentToInternal.Erase(library->mSwapFragment.mCurrentLibrary);
                 mCurrentToInternal.Insert(pendingLibrary, internalPendingLibrary);
                 mPendingToPendingInternal.Erase(pendingLibrary);
@@ -577,6 +593,30 @@ namespace Plasma
         }
     }
 
+    // Must be incremented whenever the translated shader key changes
+    static const uint cShaderCacheKeyVersion = 1;
+
+    // Runs the tools and backend on the binary spir-v of one shader stage. Stages
+    // are independent, so every stage of a batch is translated in parallel.
+    struct TranslateShaderStageTask
+    {
+        void operator()(uint index)
+        {
+            Array<LightningShaderGenerator::TranslationPassResultRef>& pipelineResults = (*mStageResults)[index];
+            // Stages the shader doesn't have
+            if (pipelineResults.Empty())
+                return;
+
+            ZoneScopedN("TranslateShaderStage");
+            ShaderPipelineDescription pipeline;
+            mGenerator->CreatePipelineDescription(pipeline);
+            mGenerator->RunPipeline(pipeline, pipelineResults);
+        }
+
+        LightningShaderGenerator* mGenerator;
+        Array<Array<LightningShaderGenerator::TranslationPassResultRef>>* mStageResults;
+    };
+
     bool LightningShaderGenerator::BuildShaders(ShaderSet& shaders,
                                                 HashMap<String, UniqueComposite>& composites,
                                                 Array<ShaderEntry>& shaderEntries,
@@ -584,29 +624,40 @@ namespace Plasma
     {
 	    ZoneScoped;
         ProfileScopeFunction();
-        // @Nate: Build a description of the pipeline tools to run.
-        // This could be cached and down the line should probably be
-        // split up to deal with multiple libraries and caching.
+        // Only used to key the cache, each translating thread builds its own
         ShaderPipelineDescription pipelineDescription;
-#if !defined(PlasmaDebug)
-        pipelineDescription.mToolPasses.PushBack(new SpirVSpecializationConstantPass());
-        pipelineDescription.mToolPasses.PushBack(new SpirVOptimizerPass());
-#endif
-        pipelineDescription.mDebugPasses.PushBack(new SpirVValidatorPass());
-        PlasmaLightningShaderGlslBackend* backend = new PlasmaLightningShaderGlslBackend();
-        pipelineDescription.mBackend = backend;
-
-#ifdef PlasmaTargetOsEmscripten
-  backend->mTargetVersion = 300;
-  backend->mTargetGlslEs = true;
-#endif
+        CreatePipelineDescription(pipelineDescription);
 
         LightningShaderIRCompositor compositor;
 
         LightningShaderIRLibraryRef fragmentsLibrary = GetCurrentInternalProjectLibrary();
 
+        // Shaders that were already translated from the same fragments are loaded
+        // from the cache. Composites are only built when translating, so the cache
+        // isn't used when they're requested.
+        String fragmentsHash;
+        if (TranslatedShaderCache::IsEnabled() && compositeShaderDefs == nullptr)
+            fragmentsHash = GetFragmentsHash();
+
         Array<Shader*> shaderArray;
-        shaderArray.Append(shaders.All());
+        Array<String> shaderKeys;
+        forRange(Shader* shader, shaders.All())
+        {
+            if (!fragmentsHash.Empty())
+            {
+                String key = GetShaderCacheKey(shader, composites, fragmentsHash, pipelineDescription);
+                ShaderEntry entry(shader);
+                if (TranslatedShaderCache::Load(key, entry))
+                {
+                    shaderEntries.PushBack(entry);
+                    shader->mSentToRenderer = true;
+                    continue;
+                }
+                shaderKeys.PushBack(key);
+            }
+
+            shaderArray.PushBack(shader);
+        }
 
         // Value should not be very large to prevent unnecessary memory consumption to
         // compile.
@@ -712,42 +763,74 @@ namespace Plasma
                 return false;
             }
 
-            for (size_t i = entryStartIndex; i < shaderEntries.Size(); ++i)
+            // Converting to binary reads the shared shader library, so only the tools
+            // and backend of each stage are run in parallel
+            size_t batchShaderCount = shaderEntries.Size() - entryStartIndex;
+            Array<Array<TranslationPassResultRef>> stageResults;
+            stageResults.Resize(batchShaderCount * FragmentType::Size);
+            for (size_t i = 0; i < batchShaderCount; ++i)
             {
-                ShaderEntry& entry = shaderEntries[i];
+                ShaderEntry& entry = shaderEntries[entryStartIndex + i];
 
                 LightningShaderIRType* vertexShader = shaderLibrary->FindType(entry.mVertexShader);
                 LightningShaderIRType* geometryShader = shaderLibrary->FindType(entry.mGeometryShader);
                 LightningShaderIRType* pixelShader = shaderLibrary->FindType(entry.mPixelShader);
                 ErrorIf(vertexShader == nullptr || pixelShader == nullptr, "Invalid shader entry");
 
-                bool success = true;
-                Array<TranslationPassResultRef> vertexPipelineResults;
-                success &= CompilePipeline(vertexShader, pipelineDescription, vertexPipelineResults);
+                Array<TranslationPassResultRef>* shaderResults = &stageResults[i * FragmentType::Size];
 
-                Array<TranslationPassResultRef> geometryPipelineResults;
+                bool success = true;
+                success &= TranslateToBinary(vertexShader, shaderResults[FragmentType::Vertex]);
                 if (geometryShader != nullptr)
-                    success &= CompilePipeline(geometryShader, pipelineDescription, geometryPipelineResults);
-
-                Array<TranslationPassResultRef> pixelPipelineResults;
-                success &= CompilePipeline(pixelShader, pipelineDescription, pixelPipelineResults);
+                    success &= TranslateToBinary(geometryShader, shaderResults[FragmentType::Geometry]);
+                success &= TranslateToBinary(pixelShader, shaderResults[FragmentType::Pixel]);
 
                 if (!success)
                     return false;
+            }
 
-                entry.mVertexShader = vertexPipelineResults.Back()->mByteStream.ToString();
-                if (geometryShader != nullptr)
-                    entry.mGeometryShader = geometryPipelineResults.Back()->mByteStream.ToString();
-                entry.mPixelShader = pixelPipelineResults.Back()->mByteStream.ToString();
+            TranslateShaderStageTask translateTask = {this, &stageResults};
+            PL::gJobs->ParallelFor(stageResults.Size(), translateTask);
+
+            for (size_t i = 0; i < batchShaderCount; ++i)
+            {
+                ShaderEntry& entry = shaderEntries[entryStartIndex + i];
+                Array<TranslationPassResultRef>* shaderResults = &stageResults[i * FragmentType::Size];
+
+                entry.mVertexShader = shaderResults[FragmentType::Vertex].Back()->mByteStream.ToString();
+                if (!shaderResults[FragmentType::Geometry].Empty())
+                    entry.mGeometryShader = shaderResults[FragmentType::Geometry].Back()->mByteStream.ToString();
+                entry.mPixelShader = shaderResults[FragmentType::Pixel].Back()->mByteStream.ToString();
+
+                if (!shaderKeys.Empty())
+                    TranslatedShaderCache::Save(shaderKeys[startIndex + i], entry);
             }
         }
 
         return true;
     }
 
-    bool LightningShaderGenerator::CompilePipeline(LightningShaderIRType* shaderType,
-                                                   ShaderPipelineDescription& pipeline,
-                                                   Array<TranslationPassResultRef>& pipelineResults)
+    void LightningShaderGenerator::CreatePipelineDescription(ShaderPipelineDescription& pipeline)
+    {
+        // @Nate: Build a description of the pipeline tools to run.
+        // This could be cached and down the line should probably be
+        // split up to deal with multiple libraries and caching.
+#if !defined(PlasmaDebug)
+        pipeline.mToolPasses.PushBack(new SpirVSpecializationConstantPass());
+        pipeline.mToolPasses.PushBack(new SpirVOptimizerPass());
+#endif
+        pipeline.mDebugPasses.PushBack(new SpirVValidatorPass());
+        PlasmaLightningShaderGlslBackend* backend = new PlasmaLightningShaderGlslBackend();
+        pipeline.mBackend = backend;
+
+#ifdef PlasmaTargetOsEmscripten
+  backend->mTargetVersion = 300;
+  backend->mTargetGlslEs = true;
+#endif
+    }
+
+    bool LightningShaderGenerator::TranslateToBinary(LightningShaderIRType* shaderType,
+                                                     Array<TranslationPassResultRef>& pipelineResults)
     {
         if (shaderType == nullptr)
             return false;
@@ -761,6 +844,12 @@ namespace Plasma
         LightningShaderSpirVBinaryBackend binaryBackend;
         binaryBackend.TranslateType(shaderType, byteWriter, binaryBackendData->mReflectionData);
 
+        return true;
+    }
+
+    void LightningShaderGenerator::RunPipeline(ShaderPipelineDescription& pipeline,
+                                               Array<TranslationPassResultRef>& pipelineResults)
+    {
         // Run each tool in the pipeline
         for (size_t i = 0; i < pipeline.mToolPasses.Size(); ++i)
         {
@@ -793,8 +882,101 @@ namespace Plasma
         ShaderTranslationPassResult* backendResult = new ShaderTranslationPassResult();
         pipelineResults.PushBack(backendResult);
         pipeline.mBackend->RunTranslationPass(*lastPassData, *backendResult);
+    }
 
-        return true;
+    String LightningShaderGenerator::GetFragmentsHash()
+    {
+        // Libraries are hashed in the same order no matter how they were loaded
+        Array<String> libraryHashes;
+        forRange(LibraryRef wrapperLibrary, mCurrentToInternal.Keys())
+        {
+            String* libraryHash = mLibrarySourceHashes.FindPointer(wrapperLibrary);
+            if (libraryHash == nullptr)
+                return String();
+            libraryHashes.PushBack(*libraryHash);
+        }
+        Sort(libraryHashes.All());
+
+        Sha1Builder builder;
+        forRange(String& libraryHash, libraryHashes.All())
+            builder.Append(libraryHash);
+        return builder.OutputHashString();
+    }
+
+    String LightningShaderGenerator::GetSettingsHash()
+    {
+        LightningShaderSpirVSettings* settings = mSpirVSettings;
+        Sha1Builder builder;
+
+        // Names of the built-in inputs and outputs fragments are matched against
+        SpirVNameSettings& nameSettings = settings->mNameSettings;
+        builder.Append(BuildString(nameSettings.mApiPerspectivePositionName, "\n"));
+        builder.Append(BuildString(nameSettings.mPerspectiveToApiPerspectiveName, "\n"));
+
+        forRange(ShaderIRFieldMeta* field, settings->mVertexDefinitions.mFields.All())
+            builder.Append(BuildString(field->mLightningType->Name, " ", field->mLightningName, "\n"));
+
+        // Uniform buffer layouts and bindings, such as the InstanceData block
+        forRange(UniformBufferDescription& description, settings->mUniformBufferDescriptions.All())
+        {
+            builder.Append(String::Format("%s %u %u %u\n",
+                                          description.mDebugName.c_str(),
+                                          description.mBindingId,
+                                          description.mDescriptorSetId,
+                                          (uint)description.mAllowedStages.U32Field));
+            forRange(ShaderIRFieldMeta* field, description.mFields.All())
+                builder.Append(BuildString(field->mLightningType->Name, " ", field->mLightningName, "\n"));
+        }
+        UniformBufferDescription& materialDescription = settings->mDefaultUniformBufferDescription;
+        builder.Append(String::Format("%s %u %u\n",
+                                      materialDescription.mDebugName.c_str(),
+                                      materialDescription.mBindingId,
+                                      materialDescription.mDescriptorSetId));
+
+        forRange(String& renderTargetName, settings->mRenderTargetNames.All())
+            builder.Append(BuildString(renderTargetName, "\n"));
+
+        // Sampler settings are baked into the generated shader inputs
+        Array<String> samplerAttributes;
+        forRange(String& attribute, mSamplerAttributeValues.Keys())
+            samplerAttributes.PushBack(attribute);
+        Sort(samplerAttributes.All());
+        forRange(String& attribute, samplerAttributes.All())
+            builder.Append(String::Format("%s %u\n", attribute.c_str(), mSamplerAttributeValues[attribute]));
+
+        return builder.OutputHashString();
+    }
+
+    String LightningShaderGenerator::GetShaderCacheKey(Shader* shader,
+                                                       HashMap<String, UniqueComposite>& composites,
+                                                       StringParam fragmentsHash,
+                                                       ShaderPipelineDescription& pipeline)
+    {
+        Sha1Builder builder;
+        builder.Append(String::Format("%u %s\n", cShaderCacheKeyVersion, fragmentsHash.c_str()));
+        // Engine side settings the shader is composited with
+        builder.Append(BuildString(mSettingsHash, "\n"));
+
+        // The fragments composited, in the same order as BuildShaders
+        builder.Append(BuildString(shader->mCoreVertex, "\n"));
+        if (composites.ContainsKey(shader->mComposite))
+        {
+            forRange(String fragmentName, composites[shader->mComposite].mFragmentNames.All())
+                builder.Append(BuildString(fragmentName, "\n"));
+        }
+        else
+        {
+            builder.Append(BuildString(shader->mComposite, "\n"));
+        }
+        builder.Append(BuildString(shader->mRenderPass, "\n"));
+
+        // Translation settings that can differ between builds of the same version
+        LightningShaderIRBackend* backendPass = pipeline.mBackend;
+        PlasmaLightningShaderGlslBackend* backend = static_cast<PlasmaLightningShaderGlslBackend*>(backendPass);
+        uint toolCount = pipeline.mToolPasses.Size();
+        builder.Append(String::Format("%u %d %d\n", toolCount, backend->mTargetVersion, (int)backend->mTargetGlslEs));
+
+        return builder.OutputHashString();
     }
 
     ShaderInput LightningShaderGenerator::CreateShaderInput(StringParam fragmentName,
@@ -46,9 +46,26 @@ public:
                     HashMap<String, UniqueComposite>& composites,
                     Array<ShaderEntry>& shaderEntries,
                     Array<ShaderDefinition>* compositeShaderDefs = nullptr);
-  bool CompilePipeline(LightningShaderIRType* shaderType,
-                       ShaderPipelineDescription& pipeline,
-                       Array<TranslationPassResultRef>& pipelineResults);
+  // Builds the tools and backend shaders are translated with. Passes keep state
+  // while running, so each thread translating shaders needs its own pipeline.
+  void CreatePipelineDescription(ShaderPipelineDescription& pipeline);
+  // Converts the shader type to binary spir-v. Reads the shader's library, so it
+  // must not be run on multiple threads at once.
+  bool TranslateToBinary(LightningShaderIRType* shaderType, Array<TranslationPassResultRef>& pipelineResults);
+  // Runs the tools and backend of the pipeline on the binary spir-v.
+  void RunPipeline(ShaderPipelineDescription& pipeline, Array<TranslationPassResultRef>& pipelineResults);
+
+  // Hash of the sources of every current fragment library, empty if unknown.
+  String GetFragmentsHash();
+  // Hash of the translation settings built in InitializeSpirV. These are part
+  // of the engine rather than the fragments, so a modified build has to change
+  // the key even when the fragments haven't.
+  String GetSettingsHash();
+  // Key the translated shader is cached under in the TranslatedShaderCache.
+  String GetShaderCacheKey(Shader* shader,
+                           HashMap<String, UniqueComposite>& composites,
+                           StringParam fragmentsHash,
+                           ShaderPipelineDescription& pipeline);
 
   ShaderInput
   CreateShaderInput(StringParam fragmentName, StringParam inputName, ShaderInputType::Enum type, AnyParam value);
@@ -87,7 +104,13 @@ public:
 
   HashMap<Library*, LightningFragmentTypeMap> mPendingFragmentTypes;
 
+  // Hash of the fragment sources each wrapper library was built from.
+  HashMap<Library*, String> mLibrarySourceHashes;
+
   HashMap<String, u32> mSamplerAttributeValues;
+
+  // Hash of the SpirV settings and sampler attributes, see GetSettingsHash.
+  String mSettingsHash;
 };
 
 } // namespace Plasma
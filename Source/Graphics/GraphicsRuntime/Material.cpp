@@ -29,6 +29,7 @@ Material::Material() :
     mRenderData(nullptr),
     mSerializedList(this),
     mReferencedByList(this),
+    mReadsPerObjectInputs(false),
     mCompositionChanged(false),
     mPropertiesChanged(true),
     mInputRangeVersion(-1)
@@ -145,6 +146,7 @@ HandleOf<Material> Material::RuntimeClone()
   ReturnIf(resource == nullptr, nullptr, "Failed to clone the material, returning null");
 
   resource->mCompositeName = mCompositeName;
+  resource->mReadsPerObjectInputs = mReadsPerObjectInputs;
 
   // Add the runtime list to the clone's list so that library resources don't
   // have to be modified and all effective connections are preserved
@@ -258,6 +260,7 @@ void Material::UpdateCompositeName()
   MaterialFactory* factory = MaterialFactory::GetInstance();
   StringBuilder compositeNameBuilder;
   mFragmentNames.Clear();
+  mReadsPerObjectInputs = false;
 
   bool hasGeometry = false;
 
@@ -297,6 +300,9 @@ void Material::UpdateCompositeName()
     if (block.StoredType->HasAttribute(ObjectAttributes::cProxy))
       continue;
 
+    if (factory->mPerObjectInputComponents.Contains(block.StoredType))
+      mReadsPerObjectInputs = true;
+
     String fragmentName = block.StoredType->Name;
     compositeNameBuilder.Append(fragmentName);
     mFragmentNames.PushBack(fragmentName);
@@ -77,6 +77,8 @@ public:
 
   String mCompositeName;
   Array<String> mFragmentNames;
+  // If any fragment reads per object built-ins, see MaterialFactory
+  bool mReadsPerObjectInputs;
 
   bool mCompositionChanged;
   bool mPropertiesChanged;
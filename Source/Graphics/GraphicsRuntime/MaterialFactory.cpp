@@ -90,11 +90,45 @@ bool MaterialFactory::CanAddComponent(HandleParam owner, BoundType* typeToAdd, A
   return MetaComposition::CanAddComponent(owner, typeToAdd, info);
 }
 
+// Built-ins the renderer sets per object, an instance batch only uploads them
+// for the first object so any fragment reading them has to be drawn on its own
+static const cstr cPerObjectBuiltIns[] = {"LocalToWorld",
+                                          "WorldToLocal",
+                                          "LocalToView",
+                                          "LastLocalToView",
+                                          "ViewToLocal",
+                                          "LocalToViewNormal",
+                                          "ViewToLocalNormal",
+                                          "LocalToWorldNormal",
+                                          "WorldToLocalNormal",
+                                          "LocalToPerspective",
+                                          "ObjectWorldPosition",
+                                          "BoneTransforms"};
+
+static bool ReadsPerObjectInput(BoundType* boundType)
+{
+  forRange (Property* property, boundType->GetProperties())
+  {
+    // Plain inputs can also be resolved from app built-ins
+    if (property->HasAttribute("AppBuiltInInput") == nullptr && property->HasAttribute("Input") == nullptr)
+      continue;
+
+    for (uint i = 0; i < sizeof(cPerObjectBuiltIns) / sizeof(cstr); ++i)
+    {
+      if (property->Name == cPerObjectBuiltIns[i])
+        return true;
+    }
+  }
+
+  return false;
+}
+
 void MaterialFactory::UpdateRestrictedComponents(HashMap<LibraryRef, LightningShaderIRLibraryRef>& libraries,
                                                  LightningFragmentTypeMap& fragmentTypes)
 {
   mRestrictedComponents.Clear();
   mGeometryComponents.Clear();
+  mPerObjectInputComponents.Clear();
 
   forRange (LibraryRef wrapperLibrary, libraries.Keys())
   {
@@ -107,6 +141,9 @@ void MaterialFactory::UpdateRestrictedComponents(HashMap<LibraryRef, LightningSh
 
       if (boundType->HasAttribute("Geometry") != nullptr)
         mGeometryComponents.Insert(boundType);
+
+      if (ReadsPerObjectInput(boundType))
+        mPerObjectInputComponents.Insert(boundType);
     }
   }
 }
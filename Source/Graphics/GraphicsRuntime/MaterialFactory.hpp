@@ -35,6 +35,10 @@ public:
   // Keeping track of geometry fragments so that using multiple can be
   // disallowed
   HashSet<BoundType*> mGeometryComponents;
+
+  // Fragments that read built-ins set per object (transforms,
+  // ObjectWorldPosition, bones), materials using them cannot be instanced
+  HashSet<BoundType*> mPerObjectInputComponents;
 };
 
 } // namespace Plasma
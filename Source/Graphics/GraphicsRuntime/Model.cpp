@@ -73,6 +73,11 @@ namespace Plasma
         return mMesh->TestFrustum(localFrustum);
     }
 
+    bool Model::IsExtractionThreadSafe()
+    {
+        return true;
+    }
+
     Mesh* Model::GetMesh()
     {
         return mMesh;
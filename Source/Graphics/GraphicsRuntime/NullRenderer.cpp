@@ -0,0 +1,480 @@
+// MIT Licensed (see LICENSE.md).
+
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+Renderer* CreateRendererNull(OsHandle windowHandle, String& error)
+{
+  return new NullRenderer();
+}
+
+NullRendererStats::NullRendererStats() :
+    mFrames(0),
+    mRenderTasks(0),
+    mDrawCalls(0),
+    mInstancedDrawCalls(0),
+    mInstances(0),
+    mStateChanges(0),
+    mStreamedVertices(0),
+    mBytesUploaded(0),
+    mFrameBlocks(0),
+    mFrameNodes(0),
+    mViewBlocks(0),
+    mViewNodes(0),
+    mRenderTaskBytes(0)
+{
+}
+
+void NullRendererStats::Accumulate(const NullRendererStats& other)
+{
+  mFrames += other.mFrames;
+  mRenderTasks += other.mRenderTasks;
+  mDrawCalls += other.mDrawCalls;
+  mInstancedDrawCalls += other.mInstancedDrawCalls;
+  mInstances += other.mInstances;
+  mStateChanges += other.mStateChanges;
+  mStreamedVertices += other.mStreamedVertices;
+  mBytesUploaded += other.mBytesUploaded;
+  mFrameBlocks += other.mFrameBlocks;
+  mFrameNodes += other.mFrameNodes;
+  mViewBlocks += other.mViewBlocks;
+  mViewNodes += other.mViewNodes;
+  mRenderTaskBytes += other.mRenderTaskBytes;
+}
+
+NullRenderer::NullRenderer() :
+    mRenderTasks(nullptr),
+    mRenderQueues(nullptr),
+    mFrameBlock(nullptr),
+    mViewBlock(nullptr),
+    mLazyShaderCompilation(true)
+{
+  ResetState();
+
+  // Claim everything so that no fallback paths are taken on the engine side.
+  mDriverSupport.mTextureCompression = true;
+  mDriverSupport.mMultiTargetBlend = true;
+  mDriverSupport.mSamplerObjects = true;
+  // Instance batching can be turned off to compare draw counts against the unbatched path.
+  mDriverSupport.mInstancing = !Environment::GetValue<bool>("NullRendererNoInstancing", false);
+}
+
+NullRenderer::~NullRenderer()
+{
+  DelayedRenderDataDestruction();
+
+  NullRendererStats totals = GetTotalStats();
+  if (totals.mFrames == 0)
+    return;
+
+  double frames = (double)totals.mFrames;
+  PlasmaPrint("NullRenderer: %u frames, per frame averages: %.1f draw calls (%.1f instanced drawing %.1f objects), "
+              "%.1f state changes, %.1f render tasks, %.1f KB uploaded, %.1f frame nodes, %.1f view nodes, "
+              "%.1f KB of tasks\n",
+              totals.mFrames,
+              totals.mDrawCalls / frames,
+              totals.mInstancedDrawCalls / frames,
+              totals.mInstances / frames,
+              totals.mStateChanges / frames,
+              totals.mRenderTasks / frames,
+              totals.mBytesUploaded / frames / 1024.0,
+              totals.mFrameNodes / frames,
+              totals.mViewNodes / frames,
+              totals.mRenderTaskBytes / frames / 1024.0);
+}
+
+void NullRenderer::BuildOrthographicTransform(
+    Mat4Ref matrix, float size, float aspect, float nearPlane, float farPlane)
+{
+  // Match OpenGL so that anything computed from these transforms is identical.
+  BuildOrthographicTransformGl(matrix, size, aspect, nearPlane, farPlane);
+}
+
+void NullRenderer::BuildPerspectiveTransform(Mat4Ref matrix, float fov, float aspect, float nearPlane, float farPlane)
+{
+  BuildPerspectiveTransformGl(matrix, fov, aspect, nearPlane, farPlane);
+}
+
+MaterialRenderData* NullRenderer::CreateMaterialRenderData()
+{
+  MaterialRenderData* renderData = new MaterialRenderData();
+  renderData->mResourceId = 0;
+  renderData->mReadsPerObjectInputs = false;
+  return renderData;
+}
+
+MeshRenderData* NullRenderer::CreateMeshRenderData()
+{
+  return new MeshRenderData();
+}
+
+TextureRenderData* NullRenderer::CreateTextureRenderData()
+{
+  return new TextureRenderData();
+}
+
+void NullRenderer::AddMaterial(AddMaterialInfo* info)
+{
+  info->mRenderData->mCompositeName = info->mCompositeName;
+  info->mRenderData->mResourceId = info->mMaterialId;
+  info->mRenderData->mReadsPerObjectInputs = info->mReadsPerObjectInputs;
+}
+
+void NullRenderer::AddMesh(AddMeshInfo* info)
+{
+  if (info->mVertexData != nullptr)
+    mFrameStats.mBytesUploaded += info->mVertexCount * info->mVertexSize;
+  if (info->mIndexData != nullptr)
+    mFrameStats.mBytesUploaded += info->mIndexCount * info->mIndexSize;
+
+  // The renderer owns the data once it's been handed over.
+  delete[] info->mVertexData;
+  delete[] info->mIndexData;
+}
+
+void NullRenderer::AddTexture(AddTextureInfo* info)
+{
+  if (info->mImageData != nullptr)
+    mFrameStats.mBytesUploaded += info->mTotalDataSize;
+
+  delete[] info->mImageData;
+  delete[] info->mMipHeaders;
+}
+
+void NullRenderer::RemoveMaterial(MaterialRenderData* data)
+{
+  mMaterialRenderDataToDestroy.PushBack(data);
+}
+
+void NullRenderer::RemoveMesh(MeshRenderData* data)
+{
+  mMeshRenderDataToDestroy.PushBack(data);
+}
+
+void NullRenderer::RemoveTexture(TextureRenderData* data)
+{
+  mTextureRenderDataToDestroy.PushBack(data);
+}
+
+bool NullRenderer::GetLazyShaderCompilation()
+{
+  return mLazyShaderCompilation;
+}
+
+void NullRenderer::SetLazyShaderCompilation(bool isLazy)
+{
+  mLazyShaderCompilation = isLazy;
+}
+
+void NullRenderer::AddShaders(Array<ShaderEntry>& entries, uint forceCompileBatchCount)
+{
+}
+
+void NullRenderer::RemoveShaders(Array<ShaderEntry>& entries)
+{
+}
+
+void NullRenderer::SetVSync(bool vsync)
+{
+}
+
+void NullRenderer::GetTextureData(GetTextureDataInfo* info)
+{
+  // There is no image to read back, callers treat a null image as a failed read.
+  info->mImage = nullptr;
+}
+
+void NullRenderer::DoRenderTasks(RenderTasks* renderTasks, RenderQueues* renderQueues)
+{
+  ZoneScoped;
+  mRenderTasks = renderTasks;
+  mRenderQueues = renderQueues;
+
+  mFrameStats.mFrames = 1;
+  mFrameStats.mRenderTaskBytes = renderTasks->mRenderTaskBuffer.mCurrentIndex;
+  mFrameStats.mFrameBlocks = renderQueues->mFrameBlocks.Size();
+  mFrameStats.mViewBlocks = renderQueues->mViewBlocks.Size();
+  forRange (FrameBlock& frameBlock, renderQueues->mFrameBlocks.All())
+    mFrameStats.mFrameNodes += frameBlock.mFrameNodes.Size();
+  forRange (ViewBlock& viewBlock, renderQueues->mViewBlocks.All())
+    mFrameStats.mViewNodes += viewBlock.mViewNodes.Size();
+
+  forRange (RenderTaskRange& taskRange, mRenderTasks->mRenderTaskRanges.All())
+    DoRenderTaskRange(taskRange);
+
+  mThreadLock.Lock();
+  mLastFrameStats = mFrameStats;
+  mTotalStats.Accumulate(mFrameStats);
+  mThreadLock.Unlock();
+  mFrameStats = NullRendererStats();
+
+  mRenderTasks = nullptr;
+  mRenderQueues = nullptr;
+  mFrameBlock = nullptr;
+  mViewBlock = nullptr;
+
+  DelayedRenderDataDestruction();
+}
+
+NullRendererStats NullRenderer::GetLastFrameStats()
+{
+  mThreadLock.Lock();
+  NullRendererStats stats = mLastFrameStats;
+  mThreadLock.Unlock();
+  return stats;
+}
+
+NullRendererStats NullRenderer::GetTotalStats()
+{
+  mThreadLock.Lock();
+  NullRendererStats stats = mTotalStats;
+  mThreadLock.Unlock();
+  return stats;
+}
+
+void NullRenderer::DoRenderTaskRange(RenderTaskRange& taskRange)
+{
+  mFrameBlock = &mRenderQueues->mFrameBlocks[taskRange.mFrameBlockIndex];
+  mViewBlock = &mRenderQueues->mViewBlocks[taskRange.mViewBlockIndex];
+
+  uint taskIndex = taskRange.mTaskIndex;
+  for (uint i = 0; i < taskRange.mTaskCount; ++i)
+  {
+    ErrorIf(taskIndex >= mRenderTasks->mRenderTaskBuffer.mCurrentIndex, "Render task data is not valid.");
+    RenderTask* task = (RenderTask*)&mRenderTasks->mRenderTaskBuffer.mRenderTaskData[taskIndex];
+    ++mFrameStats.mRenderTasks;
+
+    switch (task->mId)
+    {
+    case RenderTaskType::ClearTarget:
+      // Bind targets and clear.
+      ++mFrameStats.mStateChanges;
+      taskIndex += sizeof(RenderTaskClearTarget);
+      break;
+
+    case RenderTaskType::RenderPass:
+    {
+      RenderTaskRenderPass* renderPass = static_cast<RenderTaskRenderPass*>(task);
+      DoRenderTaskRenderPass(renderPass);
+      // RenderPass tasks can have multiple following task entries for sub
+      // RenderGroup settings. Have to index past all sub tasks.
+      taskIndex += sizeof(RenderTaskRenderPass) * (renderPass->mSubRenderGroupCount + 1);
+      i += renderPass->mSubRenderGroupCount;
+    }
+    break;
+
+    case RenderTaskType::PostProcess:
+    {
+      RenderTaskPostProcess* postProcess = static_cast<RenderTaskPostProcess*>(task);
+      bool hasTargets = postProcess->mRenderSettings.mTargetsWidth != 0 && postProcess->mRenderSettings.mTargetsHeight != 0;
+      bool hasShader = postProcess->mMaterialRenderData != nullptr || !postProcess->mPostProcessName.Empty();
+      if (hasTargets && hasShader)
+      {
+        // Targets, settings, and shader followed by a fullscreen triangle.
+        mFrameStats.mStateChanges += 3;
+        ++mFrameStats.mDrawCalls;
+      }
+      taskIndex += sizeof(RenderTaskPostProcess);
+    }
+    break;
+
+    case RenderTaskType::BackBufferBlit:
+      ++mFrameStats.mStateChanges;
+      taskIndex += sizeof(RenderTaskBackBufferBlit);
+      break;
+
+    case RenderTaskType::TextureUpdate:
+      // Reallocates the texture, no data is uploaded.
+      ++mFrameStats.mStateChanges;
+      taskIndex += sizeof(RenderTaskTextureUpdate);
+      break;
+
+    case RenderTaskType::ComputePass:
+      ++mFrameStats.mStateChanges;
+      ++mFrameStats.mDrawCalls;
+      taskIndex += sizeof(RenderTaskCompute);
+      break;
+
+    default:
+      Error("Render task not implemented.");
+      break;
+    }
+  }
+}
+
+void NullRenderer::DoRenderTaskRenderPass(RenderTaskRenderPass* task)
+{
+  ZoneScoped;
+
+  // Create a map of RenderGroup id to task memory index for every sub group entry.
+  HashMap<int, size_t> taskIndexMap;
+  while (taskIndexMap.Size() < task->mSubRenderGroupCount)
+  {
+    size_t index = taskIndexMap.Size() + 1;
+    RenderTaskRenderPass* subTask = task + index;
+    taskIndexMap.InsertOrError(subTask->mRenderGroupIndex, index);
+  }
+
+  // Initialize to invalid index so state is set for the first object.
+  size_t currentTaskIndex = (size_t)-1;
+
+  IndexRange viewNodeRange = mViewBlock->mRenderGroupRanges[task->mRenderGroupIndex];
+  for (uint i = viewNodeRange.start; i < viewNodeRange.end; ++i)
+  {
+    ViewNode& viewNode = mViewBlock->mViewNodes[i];
+    FrameNode& frameNode = mFrameBlock->mFrameNodes[viewNode.mFrameNodeIndex];
+
+    size_t index = taskIndexMap.FindValue(viewNode.mRenderGroupId, 0);
+    if (index != currentTaskIndex)
+    {
+      RenderTaskRenderPass* subTask = task + index;
+      if (subTask->mRender == false)
+        continue;
+
+      currentTaskIndex = index;
+
+      // Render settings and targets.
+      FlushStreamed();
+      mFrameStats.mStateChanges += 2;
+    }
+
+    switch (frameNode.mRenderingType)
+    {
+    case RenderingType::Static:
+      FlushStreamed();
+      DrawStatic(viewNode, frameNode);
+      break;
+
+    case RenderingType::Streamed:
+      DrawStreamed(viewNode, frameNode);
+      break;
+    }
+  }
+
+  FlushStreamed();
+  ResetState();
+}
+
+void NullRenderer::DrawStatic(ViewNode& viewNode, FrameNode& frameNode)
+{
+  if (frameNode.mMeshRenderData == nullptr || frameNode.mMaterialRenderData == nullptr)
+    return;
+
+  SetMaterial(frameNode.mMaterialRenderData);
+
+  // Per object inputs force the material inputs to be set again for the next object.
+  if (frameNode.mShaderInputRange.Count() != 0)
+  {
+    ++mFrameStats.mStateChanges;
+    mActiveMaterial = nullptr;
+  }
+
+  if (frameNode.mTextureRenderData != nullptr)
+    ++mFrameStats.mStateChanges;
+
+  uint remapCount = frameNode.mIndexRemapRange.Count();
+  if (frameNode.mBoneMatrixRange.Count() > 0 && remapCount > 0)
+    mFrameStats.mBytesUploaded += remapCount * sizeof(Mat4);
+
+  uint instanceTransformCount = viewNode.mInstanceRange.Count();
+  if (instanceTransformCount != 0)
+  {
+    mFrameStats.mBytesUploaded += instanceTransformCount * sizeof(Mat4);
+    mFrameStats.mInstances += instanceTransformCount / cInstanceTransformStride;
+    ++mFrameStats.mInstancedDrawCalls;
+  }
+
+  ++mFrameStats.mDrawCalls;
+}
+
+void NullRenderer::DrawStreamed(ViewNode& viewNode, FrameNode& frameNode)
+{
+  if (frameNode.mMaterialRenderData == nullptr || viewNode.mStreamedVertexCount == 0)
+    return;
+
+  if (mCurrentLineWidth != frameNode.mBorderThickness)
+  {
+    FlushStreamed();
+    mCurrentLineWidth = frameNode.mBorderThickness;
+    ++mFrameStats.mStateChanges;
+  }
+
+  // Same batching rules as the OpenGL renderer, any change of material or texture
+  // ends the current batch.
+  if (frameNode.mMaterialRenderData != mActiveMaterial || frameNode.mTextureRenderData != mActiveTexture)
+  {
+    FlushStreamed();
+    SetMaterial(frameNode.mMaterialRenderData);
+    if (frameNode.mTextureRenderData != nullptr)
+      ++mFrameStats.mStateChanges;
+    mActiveTexture = frameNode.mTextureRenderData;
+  }
+
+  if (frameNode.mShaderInputRange.Count() != 0)
+  {
+    FlushStreamed();
+    ++mFrameStats.mStateChanges;
+    mActiveMaterial = nullptr;
+  }
+
+  if (frameNode.mBlendSettingsOverride)
+  {
+    FlushStreamed();
+    ++mFrameStats.mStateChanges;
+  }
+
+  mPendingStreamedVertices += viewNode.mStreamedVertexCount;
+
+  if (frameNode.mBlendSettingsOverride)
+  {
+    FlushStreamed();
+    ++mFrameStats.mStateChanges;
+  }
+}
+
+void NullRenderer::SetMaterial(MaterialRenderData* materialData)
+{
+  if (materialData == mActiveMaterial)
+    return;
+
+  // Shader and material inputs.
+  mFrameStats.mStateChanges += 2;
+  mActiveMaterial = materialData;
+}
+
+void NullRenderer::FlushStreamed()
+{
+  if (mPendingStreamedVertices == 0)
+    return;
+
+  ++mFrameStats.mDrawCalls;
+  mFrameStats.mStreamedVertices += mPendingStreamedVertices;
+  mFrameStats.mBytesUploaded += mPendingStreamedVertices * sizeof(StreamedVertex);
+  mPendingStreamedVertices = 0;
+}
+
+void NullRenderer::ResetState()
+{
+  mActiveMaterial = nullptr;
+  mActiveTexture = nullptr;
+  mCurrentLineWidth = 0.0f;
+  mPendingStreamedVertices = 0;
+}
+
+void NullRenderer::DelayedRenderDataDestruction()
+{
+  forRange (MaterialRenderData* renderData, mMaterialRenderDataToDestroy.All())
+    delete renderData;
+  forRange (MeshRenderData* renderData, mMeshRenderDataToDestroy.All())
+    delete renderData;
+  forRange (TextureRenderData* renderData, mTextureRenderDataToDestroy.All())
+    delete renderData;
+
+  mMaterialRenderDataToDestroy.Clear();
+  mMeshRenderDataToDestroy.Clear();
+  mTextureRenderDataToDestroy.Clear();
+}
+
+} // namespace Plasma
@@ -0,0 +1,112 @@
+// MIT Licensed (see LICENSE.md).
+
+#pragma once
+
+namespace Plasma
+{
+
+/// Counters recorded by the NullRenderer, either for a single frame or totaled over every frame.
+class NullRendererStats
+{
+public:
+  NullRendererStats();
+
+  void Accumulate(const NullRendererStats& other);
+
+  uint mFrames;
+  uint mRenderTasks;
+  // Draw calls the OpenGL renderer would have issued (streamed vertices are batched the same way).
+  uint mDrawCalls;
+  // Draw calls that were instance batches and the objects drawn by them.
+  uint mInstancedDrawCalls;
+  uint mInstances;
+  // Render target/settings switches plus shader, material, and texture binds.
+  uint mStateChanges;
+  u64 mStreamedVertices;
+  // Mesh and texture data, streamed vertices, skinning matrices, and instance transforms sent to the "gpu".
+  u64 mBytesUploaded;
+  uint mFrameBlocks;
+  uint mFrameNodes;
+  uint mViewBlocks;
+  uint mViewNodes;
+  // Size of the render task buffer produced by the engine.
+  u64 mRenderTaskBytes;
+};
+
+/// Renderer that consumes RenderTasks and RenderQueues exactly like an api renderer does but
+/// never touches a graphics device. Used to measure the cpu side of graphics (extraction,
+/// culling, sorting, task building) on machines without a gpu. Selected at startup with the
+/// 'NullRenderer' command line/environment value.
+class NullRenderer : public Renderer
+{
+public:
+  NullRenderer();
+  ~NullRenderer() override;
+
+  void BuildOrthographicTransform(Mat4Ref matrix, float size, float aspect, float nearPlane, float farPlane) override;
+  void BuildPerspectiveTransform(Mat4Ref matrix, float fov, float aspect, float nearPlane, float farPlane) override;
+
+  MaterialRenderData* CreateMaterialRenderData() override;
+  MeshRenderData* CreateMeshRenderData() override;
+  TextureRenderData* CreateTextureRenderData() override;
+
+  void AddMaterial(AddMaterialInfo* info) override;
+  void AddMesh(AddMeshInfo* info) override;
+  void AddTexture(AddTextureInfo* info) override;
+  void RemoveMaterial(MaterialRenderData* data) override;
+  void RemoveMesh(MeshRenderData* data) override;
+  void RemoveTexture(TextureRenderData* data) override;
+
+  bool GetLazyShaderCompilation() override;
+  void SetLazyShaderCompilation(bool isLazy) override;
+  void AddShaders(Array<ShaderEntry>& entries, uint forceCompileBatchCount) override;
+  void RemoveShaders(Array<ShaderEntry>& entries) override;
+
+  void SetVSync(bool vsync) override;
+
+  void GetTextureData(GetTextureDataInfo* info) override;
+
+  void DoRenderTasks(RenderTasks* renderTasks, RenderQueues* renderQueues) override;
+
+  // Can be called from any thread.
+  NullRendererStats GetLastFrameStats();
+  NullRendererStats GetTotalStats();
+
+private:
+  void DoRenderTaskRange(RenderTaskRange& taskRange);
+  void DoRenderTaskRenderPass(RenderTaskRenderPass* task);
+  void DrawStatic(ViewNode& viewNode, FrameNode& frameNode);
+  void DrawStreamed(ViewNode& viewNode, FrameNode& frameNode);
+
+  void SetMaterial(MaterialRenderData* materialData);
+  // Counts the pending batch of streamed vertices as a draw call.
+  void FlushStreamed();
+  void ResetState();
+
+  void DelayedRenderDataDestruction();
+
+  RenderTasks* mRenderTasks;
+  RenderQueues* mRenderQueues;
+  FrameBlock* mFrameBlock;
+  ViewBlock* mViewBlock;
+
+  // Bound state, used to decide what a real renderer would have to change.
+  MaterialRenderData* mActiveMaterial;
+  TextureRenderData* mActiveTexture;
+  float mCurrentLineWidth;
+  uint mPendingStreamedVertices;
+
+  bool mLazyShaderCompilation;
+
+  // Only touched by the renderer thread.
+  NullRendererStats mFrameStats;
+  // Published at the end of every frame, guarded by mThreadLock.
+  NullRendererStats mLastFrameStats;
+  NullRendererStats mTotalStats;
+
+  Array<MaterialRenderData*> mMaterialRenderDataToDestroy;
+  Array<MeshRenderData*> mMeshRenderDataToDestroy;
+  Array<TextureRenderData*> mTextureRenderDataToDestroy;
+};
+
+} // namespace Plasma
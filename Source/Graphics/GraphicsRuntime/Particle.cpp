@@ -9,13 +9,6 @@ namespace Tags
 DefineTag(Particle);
 }
 
-//////////Helper functions///////////////
-void PushFront(Particle*& front, Particle* particle)
-{
-  particle->Next = front;
-  front = particle;
-}
-
 LightningDefineType(Particle, builder, type)
 {
   type->HandleManager = LightningManagerId(PointerManager);
@@ -30,61 +23,92 @@ LightningDefineType(Particle, builder, type)
   LightningBindFieldProperty(WanderAngle);
 }
 
-Memory::Pool* ParticleList::Memory = NULL;
+// Particles are allocated in blocks so a block's particles are next to each
+// other in memory when animated
+static const uint cParticlesPerBlock = 256;
 
-void ParticleList::Initialize()
+ParticleList::ParticleList() : mHasDestroyed(false)
 {
-  Particles = NULL;
-  Destroyed = NULL;
-  mActiveParticles = 0;
 }
 
-void ParticleList::AddParticle(Particle* particle)
+ParticleList::~ParticleList()
 {
-  ++mActiveParticles;
-  PushFront(Particles, particle);
+  FreeParticles();
 }
 
 Particle* ParticleList::AllocateParticle()
 {
-  return (Particle*)Memory->Allocate(sizeof(Particle));
-}
+  if (mFreeParticles.Empty())
+  {
+    Particle* block = new Particle[cParticlesPerBlock];
+    mBlocks.PushBack(block);
 
-void ParticleList::FreeParticle(Particle* particle)
-{
-  --mActiveParticles;
-  Memory->Deallocate(particle, sizeof(Particle));
+    // Reversed so the block is handed out front to back
+    for (uint i = cParticlesPerBlock; i > 0; --i)
+      mFreeParticles.PushBack(block + i - 1);
+  }
+
+  Particle* particle = mFreeParticles.Back();
+  mFreeParticles.PopBack();
+  mParticles.PushBack(particle);
+  return particle;
 }
 
-void ParticleList::DestroyParticle(Particle* particle)
+void ParticleList::DestroyParticle(uint index)
 {
-  PushFront(Destroyed, particle);
+  mFreeParticles.PushBack(mParticles[index]);
+  mParticles[index] = nullptr;
+  mHasDestroyed = true;
 }
 
 void ParticleList::ClearDestroyed()
 {
-  Particle* curParticle = Destroyed;
-  while (curParticle != NULL)
+  if (!mHasDestroyed)
+    return;
+
+  uint liveCount = 0;
+  for (uint i = 0; i < mParticles.Size(); ++i)
   {
-    Particle* nextParticle = curParticle->Next;
-    FreeParticle(curParticle);
-    curParticle = nextParticle;
+    if (mParticles[i] != nullptr)
+      mParticles[liveCount++] = mParticles[i];
   }
-  Destroyed = NULL;
+  mParticles.Resize(liveCount);
+  mHasDestroyed = false;
 }
 
 void ParticleList::FreeParticles()
 {
-  Particle* curParticle = Particles;
-  while (curParticle != NULL)
-  {
-    Particle* nextParticle = curParticle->Next;
-    FreeParticle(curParticle);
-    curParticle = nextParticle;
-  }
-  Particles = NULL;
-  ErrorIf(Destroyed != 0, "Particle on destroy.");
-  ErrorIf(mActiveParticles != 0, "Particle system memory error.");
+  forRange (Particle* block, mBlocks.All())
+    delete[] block;
+  mBlocks.Clear();
+  mParticles.Clear();
+  mFreeParticles.Clear();
+  mHasDestroyed = false;
+}
+
+uint ParticleList::Size()
+{
+  return mParticles.Size();
+}
+
+bool ParticleList::Empty()
+{
+  return mParticles.Empty();
+}
+
+Particle& ParticleList::operator[](uint index)
+{
+  return *mParticles[index];
+}
+
+ParticleList::range ParticleList::All()
+{
+  return range(mParticles.Begin(), mParticles.End());
+}
+
+ParticleList::range ParticleList::SubRange(uint start, uint end)
+{
+  return range(mParticles.Begin() + start, mParticles.Begin() + end);
 }
 
 } // namespace Plasma
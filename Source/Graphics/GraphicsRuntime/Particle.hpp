@@ -16,7 +16,6 @@ class Particle
 public:
   LightningDeclareType(Particle, TypeCopyMode::ReferenceType);
 
-  Particle* Next;
   float Time;
   float Lifetime;
   float Size;
@@ -28,19 +27,33 @@ public:
   float WanderAngle;
 };
 
-/// This class manages a linked-list of particles.
+/// This class stores the particles of a system in fixed size blocks that are
+/// never moved, so a particle (and any handle to it) stays valid for its whole
+/// lifetime. The list of live particles is kept in the order they were
+/// allocated (oldest first).
 class ParticleList
 {
 public:
+  ParticleList();
+  ~ParticleList();
+
+  /// Adds a particle to the end of the list. Its values are not initialized.
   Particle* AllocateParticle();
-  void FreeParticle(Particle* particle);
 
-  void DestroyParticle(Particle* particle);
+  /// Marks the particle at the given index as dead. The list can't be used
+  /// until ClearDestroyed is called.
+  void DestroyParticle(uint index);
+  /// Removes every particle destroyed since the last call, keeping the order of
+  /// the rest.
   void ClearDestroyed();
 
-  void AddParticle(Particle* particle);
+  /// Removes all particles.
   void FreeParticles();
 
+  uint Size();
+  bool Empty();
+  Particle& operator[](uint index);
+
   struct range
   {
     typedef Particle* value_type;
@@ -49,7 +62,7 @@ public:
     range() : mCurrentParticle(nullptr), mEndParticle(nullptr)
     {
     }
-    range(Particle* curr, Particle* endParticle = nullptr)
+    range(Particle** curr, Particle** endParticle)
     {
       mCurrentParticle = curr;
       mEndParticle = endParticle;
@@ -57,35 +70,41 @@ public:
 
     void PopFront()
     {
-      mCurrentParticle = mCurrentParticle->Next;
+      ++mCurrentParticle;
     }
     FrontResult Front()
     {
-      return mCurrentParticle;
+      return *mCurrentParticle;
     }
     bool Empty()
     {
       return mCurrentParticle == mEndParticle;
     }
+    uint Length()
+    {
+      return (uint)(mEndParticle - mCurrentParticle);
+    }
     range& All()
     {
       return *this;
     }
-    Particle* mCurrentParticle;
-    Particle* mEndParticle;
+    Particle** mCurrentParticle;
+    Particle** mEndParticle;
   };
 
-  range All()
-  {
-    return range(Particles);
-  }
-
-  static Memory::Pool* Memory;
-  Particle* Particles;
-  Particle* Destroyed;
+  range All();
+  /// The particles in [start, end).
+  range SubRange(uint start, uint end);
 
-  uint mActiveParticles;
-  void Initialize();
+private:
+  /// Live particles in the order they were allocated.
+  Array<Particle*> mParticles;
+  /// Particles that can be reused.
+  Array<Particle*> mFreeParticles;
+  /// Every block of particles allocated.
+  Array<Particle*> mBlocks;
+  /// Set when a particle was destroyed and not yet removed.
+  bool mHasDestroyed;
 };
 
 typedef ParticleList::range ParticleListRange;
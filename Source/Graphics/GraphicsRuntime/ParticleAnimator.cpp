@@ -19,4 +19,13 @@ void ParticleAnimator::Initialize(CogInitializer& initializer)
   mGraphicsSpace = GetSpace()->has(GraphicsSpace);
 }
 
+void ParticleAnimator::BeginAnimate(float dt, Mat4Ref transform)
+{
+}
+
+bool ParticleAnimator::IsAnimationThreadSafe()
+{
+  return false;
+}
+
 } // namespace Plasma
@@ -16,7 +16,19 @@ public:
   void Initialize(CogInitializer& initializer) override;
 
   // Particle Animator Interface
-  virtual void Animate(ParticleList* particleList, float dt, Mat4Ref transform) = 0;
+
+  /// Called once per update before any particles are animated. Anything shared
+  /// by all particles (such as random samples) should be computed here.
+  virtual void BeginAnimate(float dt, Mat4Ref transform);
+
+  /// Animates a contiguous run of the system's particles. The system runs every
+  /// animator on a run before moving on to the next run.
+  virtual void Animate(ParticleListRange particles, float dt, Mat4Ref transform) = 0;
+
+  /// If Animate can be called for different runs at the same time on worker
+  /// threads. Animators that touch shared state per particle (random
+  /// generators, transforms, other components) must return false.
+  virtual bool IsAnimationThreadSafe();
 
   Link<ParticleAnimator> link;
   GraphicsSpace* mGraphicsSpace;
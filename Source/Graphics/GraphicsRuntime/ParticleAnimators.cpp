@@ -47,38 +47,41 @@ LinearParticleAnimator::~LinearParticleAnimator()
   AnimatorList::Unlink(this);
 }
 
-void LinearParticleAnimator::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
+void LinearParticleAnimator::BeginAnimate(float dt, Mat4Ref transform)
 {
-  Particle* p = particleList->Particles;
   Math::Random& random = mGraphicsSpace->mRandom;
 
-  Vec3 center = GetTranslationFrom(transform);
+  for (uint i = 0; i < cRandomForceSamples; ++i)
+    mRandomForces[i] = random.PointOnUnitSphere() * mRandomForce;
+
+  mRandomForceStart = random.IntRangeInIn(0, 5);
+}
 
-  const uint cNumberOfRandomSamples = 13;
-  Vec3 randomForces[cNumberOfRandomSamples];
-  for (uint i = 0; i < cNumberOfRandomSamples; ++i)
-    randomForces[i] = random.PointOnUnitSphere() * mRandomForce;
+void LinearParticleAnimator::Animate(ParticleListRange particles, float dt, Mat4Ref transform)
+{
+  Vec3 center = GetTranslationFrom(transform);
 
   Vec3 twistVector = mTwist;
   float twistStrength = twistVector.AttemptNormalize();
 
-  uint i = 0;
-  i += random.IntRangeInIn(0, 5);
+  Vec3 force = mForce * dt;
+  float growth = mGrowth * dt;
+  float torque = mTorque * dt;
+  float damping = Math::Clamp(1.0f - dt * mDampening, 0.0f, 1.0f);
 
-  while (p != NULL)
-  {
-
-    float t = p->Time;
+  uint i = mRandomForceStart;
 
-    i = (i + 1) % cNumberOfRandomSamples;
+  forRange (Particle* p, particles)
+  {
+    i = (i + 1) % cRandomForceSamples;
 
     Vec3 velocity = p->Velocity;
 
     // Apply constant force
-    velocity += mForce * dt;
+    velocity += force;
 
     // Apply random force
-    velocity += randomForces[i] * dt;
+    velocity += mRandomForces[i] * dt;
 
     // Integrate position
     Vec3 position = p->Position;
@@ -86,17 +89,16 @@ void LinearParticleAnimator::Animate(ParticleList* particleList, float dt, Mat4R
     p->Position = position;
 
     // Expand size
-    p->Size += mGrowth * dt;
-    p->Size = Math::Max(p->Size, 0.0f);
+    p->Size = Math::Max(p->Size + growth, 0.0f);
 
     // Integrate rotation of particle
     p->Rotation += p->RotationalVelocity * dt;
-    p->RotationalVelocity = p->RotationalVelocity + mTorque * dt;
+    p->RotationalVelocity = p->RotationalVelocity + torque;
 
     // Twist effect
     if (twistStrength != 0.0f)
     {
-      Vec3 toCenter = center - p->Position;
+      Vec3 toCenter = center - position;
       toCenter.AttemptNormalize();
 
       Vec3 twistMove = Cross(toCenter, twistVector);
@@ -105,18 +107,18 @@ void LinearParticleAnimator::Animate(ParticleList* particleList, float dt, Mat4R
     }
 
     // Damping
-    {
-      velocity *= Math::Clamp(1.0f - dt * mDampening, 0.0f, 1.0f);
-    }
+    velocity *= damping;
 
     // Store updated velocity
     p->Velocity = velocity;
-
-    // Move to next particle.
-    p = p->Next;
   }
 }
 
+bool LinearParticleAnimator::IsAnimationThreadSafe()
+{
+  return true;
+}
+
 LightningDefineType(ParticleWander, builder, type)
 {
   PlasmaBindComponent();
@@ -150,12 +152,9 @@ ParticleWander::~ParticleWander()
   AnimatorList::Unlink(this);
 }
 
-void ParticleWander::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
+void ParticleWander::Animate(ParticleListRange particles, float dt, Mat4Ref transform)
 {
-  Particle* p = particleList->Particles;
-  Vec3 center = GetTranslationFrom(transform);
-
-  while (p != NULL)
+  forRange (Particle* p, particles)
   {
     Vec3 velocity = p->Velocity;
     Vec3 normalizedVel = velocity;
@@ -181,9 +180,6 @@ void ParticleWander::Animate(ParticleList* particleList, float dt, Mat4Ref trans
       p->WanderAngle = curAngle;
       p->Velocity = velocity;
     }
-
-    // Move to next particle.
-    p = p->Next;
   }
 }
 
@@ -217,7 +213,7 @@ void ParticleColorAnimator::Initialize(CogInitializer& initializer)
   GetOwner()->has(ParticleSystem)->AddAnimator(this);
 }
 
-void ParticleColorAnimator::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
+void ParticleColorAnimator::Animate(ParticleListRange particles, float dt, Mat4Ref transform)
 {
   // Do nothing if neither gradients exist
   ColorGradient* timeGradient = mTimeGradient;
@@ -229,8 +225,7 @@ void ParticleColorAnimator::Animate(ParticleList* particleList, float dt, Mat4Re
   float maxSpeedSq = mMaxParticleSpeed * mMaxParticleSpeed;
 
   // Iterate over each particle
-  Particle* p = particleList->Particles;
-  while (p != NULL)
+  forRange (Particle* p, particles)
   {
     Vec4 color = Vec4(1);
 
@@ -255,12 +250,14 @@ void ParticleColorAnimator::Animate(ParticleList* particleList, float dt, Mat4Re
 
     // Set the final color
     p->Color = color;
-
-    // Move to next particle.
-    p = p->Next;
   }
 }
 
+bool ParticleColorAnimator::IsAnimationThreadSafe()
+{
+  return true;
+}
+
 LightningDefineType(ParticleAttractor, builder, type)
 {
   PlasmaBindComponent();
@@ -295,9 +292,8 @@ void ParticleAttractor::Initialize(CogInitializer& initializer)
   GetOwner()->has(ParticleSystem)->AddAnimator(this);
 }
 
-void ParticleAttractor::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
+void ParticleAttractor::Animate(ParticleListRange particles, float dt, Mat4Ref transform)
 {
-  Vec3 center = GetTranslationFrom(transform);
   float range = mMaxDistance - mMinDistance;
   float invRange = (1.0f / range);
 
@@ -305,8 +301,7 @@ void ParticleAttractor::Animate(ParticleList* particleList, float dt, Mat4Ref tr
   if (mPositionSpace == SystemSpace::LocalSpace)
     attractPosition = Math::TransformPoint(transform, attractPosition);
 
-  Particle* particle = particleList->Particles;
-  while (particle != NULL)
+  forRange (Particle* particle, particles)
   {
     Vec3 toAttractPoint = attractPosition - particle->Position;
     float distance = toAttractPoint.AttemptNormalize();
@@ -320,12 +315,14 @@ void ParticleAttractor::Animate(ParticleList* particleList, float dt, Mat4Ref tr
     Vec3 velocity = particle->Velocity;
     velocity += toAttractPoint * mStrength * falloff * dt;
     particle->Velocity = velocity;
-
-    // Move to next particle.
-    particle = particle->Next;
   }
 }
 
+bool ParticleAttractor::IsAnimationThreadSafe()
+{
+  return true;
+}
+
 LightningDefineType(ParticleTwister, builder, type)
 {
   PlasmaBindComponent();
@@ -362,7 +359,7 @@ void ParticleTwister::Initialize(CogInitializer& initializer)
   GetOwner()->has(ParticleSystem)->AddAnimator(this);
 }
 
-void ParticleTwister::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
+void ParticleTwister::Animate(ParticleListRange particles, float dt, Mat4Ref transform)
 {
   Vec3 center = GetTranslationFrom(transform);
   float range = mMaxDistance - mMinDistance;
@@ -374,8 +371,7 @@ void ParticleTwister::Animate(ParticleList* particleList, float dt, Mat4Ref tran
   Vec3 twistVector = mAxis;
   float strength = mStrength;
 
-  Particle* particle = particleList->Particles;
-  while (particle != NULL)
+  forRange (Particle* particle, particles)
   {
     Vec3 toCenter = center - particle->Position;
     float distance = toCenter.Normalize();
@@ -392,12 +388,14 @@ void ParticleTwister::Animate(ParticleList* particleList, float dt, Mat4Ref tran
     velocity += (twistMove + inVector) * (dt * strength * falloff);
 
     particle->Velocity = velocity;
-
-    // Move to next particle.
-    particle = particle->Next;
   }
 }
 
+bool ParticleTwister::IsAnimationThreadSafe()
+{
+  return true;
+}
+
 LightningDefineType(ParticleCollisionPlane, builder, type)
 {
   PlasmaBindComponent();
@@ -450,7 +448,7 @@ void ReflectParticle(Particle* particle, Vec3Param planeNormal, float restitutio
   particle->Velocity = velocityNormal + velocityTangent;
 }
 
-void ParticleCollisionPlane::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
+void ParticleCollisionPlane::Animate(ParticleListRange particles, float dt, Mat4Ref transform)
 {
   Vec3 planePosition = mPlanePosition;
   Vec3 planeNormal = mPlaneNormal.AttemptNormalized();
@@ -462,8 +460,7 @@ void ParticleCollisionPlane::Animate(ParticleList* particleList, float dt, Mat4R
 
   Plane plane(planeNormal, planePosition);
 
-  Particle* particle = particleList->Particles;
-  while (particle != NULL)
+  forRange (Particle* particle, particles)
   {
     Vec3 position = particle->Position;
 
@@ -475,12 +472,14 @@ void ParticleCollisionPlane::Animate(ParticleList* particleList, float dt, Mat4R
 
       ReflectParticle(particle, planeNormal, mRestitution, mFriction);
     }
-
-    // Move to next particle.
-    particle = particle->Next;
   }
 }
 
+bool ParticleCollisionPlane::IsAnimationThreadSafe()
+{
+  return true;
+}
+
 float ParticleCollisionPlane::GetRestitution()
 {
   return mRestitution;
@@ -538,7 +537,7 @@ void ParticleCollisionHeightmap::Initialize(CogInitializer& initializer)
   GetOwner()->has(ParticleSystem)->AddAnimator(this);
 }
 
-void ParticleCollisionHeightmap::Animate(ParticleList* particleList, float dt, Mat4Ref transform)
+void ParticleCollisionHeightmap::Animate(ParticleListRange particles, float dt, Mat4Ref transform)
 {
   Cog* cog = mHeightMap.GetCog();
   if (cog == nullptr)
@@ -552,8 +551,7 @@ void ParticleCollisionHeightmap::Animate(ParticleList* particleList, float dt, M
   Vec3 mapRight, mapForward;
   Math::GenerateOrthonormalBasis(mapUp, &mapRight, &mapForward);
 
-  Particle* particle = particleList->Particles;
-  while (particle != NULL)
+  forRange (Particle* particle, particles)
   {
     Vec3 position = particle->Position;
 
@@ -571,9 +569,6 @@ void ParticleCollisionHeightmap::Animate(ParticleList* particleList, float dt, M
 
       ReflectParticle(particle, normal, mRestitution, mFriction);
     }
-
-    // Move to next particle.
-    particle = particle->Next;
   }
 }
 
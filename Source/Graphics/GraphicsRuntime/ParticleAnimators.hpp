@@ -18,7 +18,9 @@ public:
   void Serialize(Serializer& stream) override;
 
   // ParticleAnimator Interface
-  void Animate(ParticleList* particleList, float dt, Mat4Ref transform) override;
+  void BeginAnimate(float dt, Mat4Ref transform) override;
+  void Animate(ParticleListRange particles, float dt, Mat4Ref transform) override;
+  bool IsAnimationThreadSafe() override;
 
 private:
   /// Constance force applied to particles.
@@ -38,6 +40,11 @@ private:
 
   /// Twist applies a twisting/tornado force to the particles.
   Vec3 mTwist;
+
+  /// Random forces sampled once per update and shared by all particles.
+  static const uint cRandomForceSamples = 13;
+  Vec3 mRandomForces[cRandomForceSamples];
+  uint mRandomForceStart;
 };
 
 /// Particle animator that causes particle to wander
@@ -55,7 +62,7 @@ public:
   void Serialize(Serializer& stream) override;
 
   // ParticleAnimator Interface
-  void Animate(ParticleList* particleList, float dt, Mat4Ref transform) override;
+  void Animate(ParticleListRange particles, float dt, Mat4Ref transform) override;
 
 private:
   float mWanderAngle;
@@ -76,7 +83,8 @@ public:
   void Serialize(Serializer& stream) override;
 
   // ParticleAnimator Interface
-  void Animate(ParticleList* particleList, float dt, Mat4Ref transform) override;
+  void Animate(ParticleListRange particles, float dt, Mat4Ref transform) override;
+  bool IsAnimationThreadSafe() override;
 
 private:
   friend class LinearParticleAnimator;
@@ -98,7 +106,8 @@ public:
   void Serialize(Serializer& stream) override;
 
   // ParticleAnimator Interface
-  void Animate(ParticleList* particleList, float dt, Mat4Ref transform) override;
+  void Animate(ParticleListRange particles, float dt, Mat4Ref transform) override;
+  bool IsAnimationThreadSafe() override;
 
 private:
   SystemSpace::Enum mPositionSpace;
@@ -122,7 +131,8 @@ public:
   void Serialize(Serializer& stream) override;
 
   // ParticleAnimator Interface
-  void Animate(ParticleList* particleList, float dt, Mat4Ref transform) override;
+  void Animate(ParticleListRange particles, float dt, Mat4Ref transform) override;
+  bool IsAnimationThreadSafe() override;
 
 private:
   Vec3 mAxis;
@@ -143,7 +153,8 @@ public:
   void Serialize(Serializer& stream) override;
 
   /// ParticleAnimator Interface.
-  void Animate(ParticleList* particleList, float dt, Mat4Ref transform) override;
+  void Animate(ParticleListRange particles, float dt, Mat4Ref transform) override;
+  bool IsAnimationThreadSafe() override;
 
   /// How much the particle will bounce during a collision. Values should be in
   /// the range of [0, 1], where 0 is an in-elastic collision and 1 is a fully
@@ -180,7 +191,7 @@ public:
   void OnAllObjectsCreated(CogInitializer& initializer) override;
 
   // ParticleAnimator Interface
-  void Animate(ParticleList* particleList, float dt, Mat4Ref transform) override;
+  void Animate(ParticleListRange particles, float dt, Mat4Ref transform) override;
 
   /// How much the particle will bounce during a collision. Values should be in
   /// the range of [0, 1], where 0 is an in-elastic collision and 1 is a fully
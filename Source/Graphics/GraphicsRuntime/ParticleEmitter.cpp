@@ -293,8 +293,6 @@ Particle* ParticleEmitterShared::CreateInitializedParticle(ParticleList* particl
 
   newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
 
-  particleList->AddParticle(newParticle);
-
   return newParticle;
 }
 
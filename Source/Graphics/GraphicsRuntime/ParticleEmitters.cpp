@@ -99,8 +99,6 @@ int SphericalParticleEmitter::EmitParticles(
       newParticle->Rotation = 0;
 
     newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
-
-    particleList->AddParticle(newParticle);
   }
 
   return particlesToEmit;
@@ -191,8 +189,6 @@ int BoxParticleEmitter::EmitParticles(
       newParticle->Rotation = 0;
 
     newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
-
-    particleList->AddParticle(newParticle);
   }
 
   return particlesToEmit;
@@ -358,8 +354,6 @@ int MeshParticleEmitter::EmitParticles(
       newParticle->Rotation = 0;
 
     newParticle->RotationalVelocity = random.FloatVariance(Math::DegToRad(mSpin), Math::DegToRad(mSpinVariance));
-
-    particleList->AddParticle(newParticle);
   }
 
   return particlesToEmit;
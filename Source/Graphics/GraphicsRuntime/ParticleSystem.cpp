@@ -35,19 +35,52 @@ int EmitParticles(ParticleSystem* main,
   return particlesEmitted;
 }
 
-void RunAnimator(
-    ParticleSystem* main, ParticleAnimator* animator, ParticleList* particleList, float dt, Mat4Ref parentTransform)
-{
-  // Could not find anywhere that ParticleAnimator::mTransform was being
-  // initialized, so I removed it
-  // if(animator->GetOwner() != main->GetOwner())
-  //{
-  //  Mat4 transform = parentTransform * animator->mTransform->GetLocalMatrix();
-  //  animator->Animate(particleList, dt, transform);
-  //}
-  // else
+// Particles are animated in runs small enough to stay in cache while every
+// animator is run on them
+static const uint cAnimateRunSize = 256;
+// Smaller systems are animated faster than they can be handed to workers
+static const uint cMinThreadedParticles = 4096;
+
+struct AnimateRunTask
+{
+  void operator()(uint index)
+  {
+    uint start = index * cAnimateRunSize;
+    uint end = Math::Min(start + cAnimateRunSize, mParticleList->Size());
+    for (AnimatorList::range r = mAnimators->All(); !r.Empty(); r.PopFront())
+      r.Front().Animate(mParticleList->SubRange(start, end), mDt, *mTransform);
+  }
+
+  AnimatorList* mAnimators;
+  ParticleList* mParticleList;
+  float mDt;
+  Mat4* mTransform;
+};
+
+void AnimateParticles(AnimatorList& animators, ParticleList* particleList, float dt, Mat4Ref transform)
+{
+  bool threadSafe = true;
+  for (AnimatorList::range r = animators.All(); !r.Empty(); r.PopFront())
+  {
+    r.Front().BeginAnimate(dt, transform);
+    threadSafe &= r.Front().IsAnimationThreadSafe();
+  }
+
+  AnimateRunTask task;
+  task.mAnimators = &animators;
+  task.mParticleList = particleList;
+  task.mDt = dt;
+  task.mTransform = &transform;
+
+  uint runCount = (particleList->Size() + cAnimateRunSize - 1) / cAnimateRunSize;
+  if (threadSafe && particleList->Size() >= cMinThreadedParticles)
   {
-    animator->Animate(particleList, dt, parentTransform);
+    PL::gJobs->ParallelFor(runCount, task);
+  }
+  else
+  {
+    for (uint i = 0; i < runCount; ++i)
+      task(i);
   }
 }
 
@@ -111,7 +144,6 @@ void ParticleSystem::Initialize(CogInitializer& initializer)
       parentSystem->AddChildSystem(this);
   }
 
-  mParticleList.Initialize();
   mTimeAlive = 0.0f;
   mDebugDrawing = false;
 
@@ -296,7 +328,6 @@ ParticleListRange ParticleSystem::AllParticles()
 
 void ParticleSystem::Clear()
 {
-  mParticleList.ClearDestroyed();
   mParticleList.FreeParticles();
 
   forRange (ParticleEmitter& emitter, mEmitters.All())
@@ -319,7 +350,6 @@ void ParticleSystem::SystemUpdate(float dt)
 
   BaseUpdate(dt);
   UpdateLifetimes(dt);
-  mParticleList.ClearDestroyed();
 }
 
 uint ParticleSystem::BaseUpdate(float dt)
@@ -335,7 +365,7 @@ uint ParticleSystem::BaseUpdate(float dt)
 
   // Emit Particles
   int emitCount = 0;
-  Particle* oldFront = mParticleList.Particles;
+  uint oldCount = mParticleList.Size();
   for (EmitterList::range r = mEmitters.All(); !r.Empty(); r.PopFront())
     emitCount += EmitParticles(this, &r.Front(), &mParticleList, dt, worldTransform, mTimeAlive);
 
@@ -344,13 +374,12 @@ uint ParticleSystem::BaseUpdate(float dt)
   {
     ParticleEvent eventToSend;
     eventToSend.mNewParticleCount = (uint)emitCount;
-    eventToSend.mNewParticles = ParticleList::range(mParticleList.Particles, oldFront);
+    eventToSend.mNewParticles = mParticleList.SubRange(oldCount, mParticleList.Size());
     GetOwner()->DispatchEvent(Events::ParticlesSpawned, &eventToSend);
   }
 
   // Run animators on all particles
-  for (AnimatorList::range r = mAnimators.All(); !r.Empty(); r.PopFront())
-    RunAnimator(this, &r.Front(), &mParticleList, dt, worldTransform);
+  AnimateParticles(mAnimators, &mParticleList, dt, worldTransform);
 
   for (ParticleSystemList::range r = mChildSystems.All(); !r.Empty(); r.PopFront())
     r.Front().ChildUpdate(dt, &mParticleList, emitCount);
@@ -363,62 +392,42 @@ void ParticleSystem::ChildUpdate(float dt, ParticleList* parentList, uint parent
   uint emitCount = 0;
   Mat4 worldTransform = mTransform->GetWorldMatrix();
 
-  Particle* particle = parentList->Particles;
-
-  while (particle != nullptr)
+  forRange (Particle* particle, parentList->All())
   {
     SetTranslationOn(&worldTransform, particle->Position);
 
     for (EmitterList::range r = mEmitters.All(); !r.Empty(); r.PopFront())
       emitCount += r.Front().EmitParticles(&mParticleList, dt, worldTransform, particle->Velocity, particle->Time);
-
-    particle = particle->Next;
   }
 
-  for (AnimatorList::range r = mAnimators.All(); !r.Empty(); r.PopFront())
-    RunAnimator(this, &r.Front(), &mParticleList, dt, worldTransform);
+  AnimateParticles(mAnimators, &mParticleList, dt, worldTransform);
 
   for (ParticleSystemList::range r = mChildSystems.All(); !r.Empty(); r.PopFront())
     r.Front().ChildUpdate(dt, &mParticleList, emitCount);
-
-  mParticleList.ClearDestroyed();
 }
 
 void ParticleSystem::UpdateLifetimes(float dt)
 {
   // Begin particle update pass removing dead particles
-  Particle* particle = mParticleList.Particles;
-  Particle** prev = &mParticleList.Particles;
-
-  while (particle != nullptr)
+  if (!mParticleList.Empty())
   {
-    particle->Time += dt;
-
-    if (particle->Time >= particle->Lifetime)
+    uint particleCount = mParticleList.Size();
+    for (uint i = 0; i < particleCount; ++i)
     {
-      // Particle is dead remove from active list
-      (*prev) = particle->Next;
-
-      Particle* deadParticle = particle;
+      Particle& particle = mParticleList[i];
+      particle.Time += dt;
 
-      // Move to next particle
-      particle = particle->Next;
+      if (particle.Time >= particle.Lifetime)
+        mParticleList.DestroyParticle(i);
+    }
 
-      mParticleList.DestroyParticle(deadParticle);
+    // The remaining particles keep their order so unsorted sprites don't flicker
+    mParticleList.ClearDestroyed();
 
-      if (mParticleList.Particles == nullptr)
-      {
-        ObjectEvent event(this);
-        DispatchEvent(Events::AllParticlesDead, &event);
-      }
-    }
-    else
+    if (mParticleList.Empty())
     {
-      // Set the prev to this particle
-      prev = &particle->Next;
-
-      // Move to next particle.
-      particle = particle->Next;
+      ObjectEvent event(this);
+      DispatchEvent(Events::AllParticlesDead, &event);
     }
   }
 
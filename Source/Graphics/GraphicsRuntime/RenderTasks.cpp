@@ -330,6 +330,13 @@ void RenderTasksEvent::AddRenderTaskClearTarget(
       .AddRenderTaskClearTarget(renderSettings, color, depth, stencil, stencilWriteMask);
 }
 
+// The RenderPass fragment is compiled into the same shader as the Material, so
+// it rules out instancing the same way a Material's fragments do.
+static bool ReadsPerObjectInputs(MaterialBlock& renderPass)
+{
+  return MaterialFactory::GetInstance()->mPerObjectInputComponents.Contains(LightningVirtualTypeId(&renderPass));
+}
+
 void RenderTasksEvent::AddRenderTaskRenderPass(GraphicsRenderSettings& renderSettings,
                                                RenderGroup& renderGroup,
                                                MaterialBlock& renderPass,
@@ -356,6 +363,8 @@ void RenderTasksEvent::AddRenderTaskRenderPass(GraphicsRenderSettings& renderSet
       .AddRenderTaskRenderPass(renderSettings, renderGroup.mSortId, renderPassName, name, shaderInputsId);
 
   mCamera->mUsedRenderGroupIds.Insert(renderGroup.mSortId);
+  if (ReadsPerObjectInputs(renderPass))
+    mCamera->mPerObjectInputRenderGroupIds.Insert(renderGroup.mSortId);
 }
 
 void RenderTasksEvent::AddRenderTaskSubRenderGroupPass(SubRenderGroupPass& subRenderGroupPass)
@@ -369,6 +378,7 @@ void RenderTasksEvent::AddRenderTaskSubRenderGroupPass(SubRenderGroupPass& subRe
   subRenderGroupPass.mBaseRenderGroup->GetMaterials(materials);
 
   RenderTaskHelper renderTaskHelper(mRenderTasks->mRenderTaskBuffer);
+  bool readsPerObjectInputs = false;
 
   for (size_t i = 0; i < subRenderGroupPass.mSubData.Size(); ++i)
   {
@@ -400,11 +410,16 @@ void RenderTasksEvent::AddRenderTaskSubRenderGroupPass(SubRenderGroupPass& subRe
 
     // Only set the sub count for the first task.
     subGroupCount = 0;
+
+    if (subData.mRender && ReadsPerObjectInputs(subData.mRenderPass))
+      readsPerObjectInputs = true;
   }
 
   // Sub RenderGroups are sorted as the base group, only set the base as being
   // used.
   mCamera->mUsedRenderGroupIds.Insert(subRenderGroupPass.mBaseRenderGroup->mSortId);
+  if (readsPerObjectInputs)
+    mCamera->mPerObjectInputRenderGroupIds.Insert(subRenderGroupPass.mBaseRenderGroup->mSortId);
 }
 
 void RenderTasksEvent::AddRenderTaskRenderPass(GraphicsRenderSettings& renderSettings,
@@ -465,6 +480,8 @@ void RenderTasksEvent::AddRenderTaskRenderPass(GraphicsRenderSettings& renderSet
       .AddRenderTaskRenderPass(renderSettings, groupId, renderPassName, name, shaderInputsId);
 
   mCamera->mUsedRenderGroupIds.Insert(groupId);
+  if (ReadsPerObjectInputs(renderPass))
+    mCamera->mPerObjectInputRenderGroupIds.Insert(groupId);
 }
 
 void RenderTasksEvent::AddRenderTaskPostProcess(RenderTarget* colorTarget, Material& material, String& name)
@@ -784,6 +801,7 @@ void RenderTasksUpdateHelper(RenderTasksUpdateData& update)
   uint startingTaskCount = renderTaskBuffer.mTaskCount;
 
   update.mCamera->mUsedRenderGroupIds.Clear();
+  update.mCamera->mPerObjectInputRenderGroupIds.Clear();
 
   {
     ZoneScopedN("Dispatch Render Tasks");
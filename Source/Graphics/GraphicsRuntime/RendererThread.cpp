@@ -17,6 +17,7 @@ void ExecuteRendererJob(RendererJob* job)
 OsInt RendererThreadMain(void* rendererThreadJobQueue)
 {
   tracy::SetThreadName("RenderThread");
+  Profile::ProfileSystem::SetThreadName("RenderThread");
 	
   RendererThreadJobQueue* jobQueue = (RendererThreadJobQueue*)rendererThreadJobQueue;
 
@@ -38,6 +39,8 @@ OsInt RendererThreadMain(void* rendererThreadJobQueue)
     running = !jobQueue->ShouldExitThread();
   }
 
+  if (ThreadingEnabled)
+    Profile::ProfileSystem::ReleaseThreadBuffer();
   return 0;
 }
 
@@ -106,6 +109,11 @@ void CreateRendererJob::Execute()
       PL::gRenderer = CreateRendererOpenGL(mMainWindowHandle, mError);
       break;
     }
+    case RenderAPI::Null:
+    {
+      PL::gRenderer = CreateRendererNull(mMainWindowHandle, mError);
+      break;
+    }
     default:
     {
       // OpenGL is the default renderer
@@ -108,13 +108,14 @@ void SelectionIcon::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBlock, Fr
 
 void SelectionIcon::MidPhaseQuery(Array<GraphicalEntry>& entries, Camera& camera, Frustum* frustum)
 {
-  mGraphicalEntryData.mGraphical = this;
-  mGraphicalEntryData.mFrameNodeIndex = -1;
-  mGraphicalEntryData.mPosition = GetWorldTranslation();
-  mGraphicalEntryData.mUtility = 0;
+  GraphicalEntryData& entryData = GetQueryEntryData(camera, mGraphicalEntryData);
+  entryData.mGraphical = this;
+  entryData.mFrameNodeIndex = -1;
+  entryData.mPosition = GetWorldTranslation();
+  entryData.mUtility = 0;
 
   GraphicalEntry entry;
-  entry.mData = &mGraphicalEntryData;
+  entry.mData = &entryData;
   entry.mSort = 0;
 
   entries.PushBack(entry);
@@ -576,6 +576,11 @@ LightningDefineType(MultiSprite, builder, type)
   LightningBindMethod(All);
 }
 
+MultiSprite::~MultiSprite()
+{
+  DeleteObjectsInContainer(mGroupMaps);
+}
+
 void MultiSprite::Serialize(Serializer& stream)
 {
   BaseSprite::Serialize(stream);
@@ -630,7 +635,7 @@ void MultiSprite::ExtractViewData(ViewNode& viewNode, ViewBlock& viewBlock, Fram
 
   Texture* atlas = (Texture*)entryData->mUtility;
   // Should never get extract calls on missing data
-  GroupMap& groupMap = mGroupMaps[CogId(viewBlock.mCameraId)];
+  GroupMap& groupMap = GetGroupMap(CogId(viewBlock.mCameraId));
   MultiSpriteTextureGroup& group = groupMap[atlas];
 
   FrameNode& frameNode = frameBlock.mFrameNodes[viewNode.mFrameNodeIndex];
@@ -669,7 +674,8 @@ void MultiSprite::MidPhaseQuery(Array<GraphicalEntry>& entries, Camera& camera,
 {
   CogId cameraId = camera.GetOwner()->GetId();
 
-  GroupMap& groupMap = mGroupMaps[cameraId];
+  // Only this camera's query uses its map, other cameras can be queried at once
+  GroupMap& groupMap = GetGroupMap(cameraId);
   groupMap.Clear();
 
   if (frustum == nullptr)
@@ -907,4 +913,15 @@ void MultiSprite::AddCellEntries(MultiSpriteCell& cell, GroupMap& groupMap)
   }
 }
 
+MultiSprite::GroupMap& MultiSprite::GetGroupMap(CogId cameraId)
+{
+  mGroupMapsLock.Lock();
+  GroupMap*& groupMap = mGroupMaps[cameraId];
+  if (groupMap == nullptr)
+    groupMap = new GroupMap();
+  GroupMap& result = *groupMap;
+  mGroupMapsLock.Unlock();
+  return result;
+}
+
 } // namespace Plasma
@@ -219,6 +219,8 @@ class MultiSprite : public BaseSprite
 public:
   LightningDeclareType(MultiSprite, TypeCopyMode::ReferenceType);
 
+  ~MultiSprite();
+
   // Component Interface
 
   void Serialize(Serializer& stream) override;
@@ -267,7 +269,14 @@ public:
   float mFrameTime;
   Aabb mLocalAabb;
   HashMap<IntVec2, MultiSpriteCell> mCells;
-  HashMap<CogId, GroupMap> mGroupMaps;
+  // Entries point into a camera's GroupMap, so each one is allocated separately
+  // to keep it in place when another camera's cull adds its own.
+  HashMap<CogId, GroupMap*> mGroupMaps;
+  // Cameras are culled in parallel and each one can add a GroupMap.
+  ThreadLock mGroupMapsLock;
+
+  /// Returns the GroupMap of the camera, adding it if this is its first query.
+  GroupMap& GetGroupMap(CogId cameraId);
 };
 
 } // namespace Plasma
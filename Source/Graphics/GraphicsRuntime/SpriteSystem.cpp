@@ -78,9 +78,8 @@ namespace Plasma
         Vec3 emitterPos = mTransform->GetWorldTranslation();
 
         CheckSort(viewBlock);
-        Particle* particle = mParticleList.Particles;
 
-        while (particle != nullptr)
+        forRange (Particle* particle, mDrawOrder.All())
         {
             float particleWidth = particle->Size * 0.5f;
 
@@ -198,19 +197,13 @@ namespace Plasma
             Vec4 color = particle->Color * mVertexColor;
 
             frameBlock.mRenderQueues->AddStreamedQuadView(viewNode, pos, uv0, uv1, color);
-
-            particle = particle->Next;
         }
     }
 
-    struct ParticleSortInfo
-    {
-        Particle* mParticle;
-        u32 mSortValue;
-    };
-
     struct LocalSpriteSorter
     {
+        typedef SpriteParticleSystem::ParticleSortInfo ParticleSortInfo;
+
         bool operator()(const ParticleSortInfo& lhs, const ParticleSortInfo& rhs)
         {
             return lhs.mSortValue < rhs.mSortValue;
@@ -261,17 +254,19 @@ namespace Plasma
 
     void SpriteParticleSystem::CheckSort(ViewBlock& viewBlock)
     {
-        Particle* particle = mParticleList.Particles;
+        mDrawOrder.Clear();
+        mDrawOrder.Reserve(mParticleList.Size());
 
-        // As long as we're in sort mode, and we have particles to be sorted...
-        if (mParticleSort == SpriteParticleSortMode::None || particle == nullptr)
+        // Newest first, the same order every frame
+        if (mParticleSort == SpriteParticleSortMode::None)
+        {
+            for (uint i = mParticleList.Size(); i > 0; --i)
+                mDrawOrder.PushBack(&mParticleList[i - 1]);
             return;
+        }
 
-        // An array to store all sorted particles
-        Array<ParticleSortInfo> sortedParticles;
-
-        // Reserve space in the sorted particle array
-        sortedParticles.Reserve(mParticleList.mActiveParticles);
+        mSortedParticles.Clear();
+        mSortedParticles.Reserve(mParticleList.Size());
 
         // Particle info for the sorter
         ParticleSortInfo particleInfo;
@@ -280,38 +275,20 @@ namespace Plasma
         Vec3 cameraDir = viewBlock.mEyeDirection;
 
         // Loop through all the particles
-        while (particle != nullptr)
+        forRange (Particle* particle, mParticleList.All())
         {
             // Fill in the particle info and push it back
             particleInfo.mParticle = particle;
             particleInfo.mSortValue = GetParticleSortValue(mParticleSort, particle->Position, cameraPos, cameraDir);
 
             // Push them into the array
-            sortedParticles.PushBack(particleInfo);
-
-            // Iterate to the next particle
-            particle = particle->Next;
+            mSortedParticles.PushBack(particleInfo);
         }
 
         // Sort the array
-        Sort(sortedParticles.All(), LocalSpriteSorter());
-
-        // Loop through all the sorted particles
-        for (size_t i = 0; i < (sortedParticles.Size() - 1); ++i)
-        {
-            // Re-point the particle's next pointer
-            sortedParticles[i].mParticle->Next = sortedParticles[i + 1].mParticle;
-        }
-
-        // Make sure we set the last particle in the array to point at null for its
-        // "next" pointer
-        sortedParticles.Back().mParticle->Next = nullptr;
-
-        // The particle list is now pointing to the front of our array
-        particle = sortedParticles.Front().mParticle;
+        Sort(mSortedParticles.All(), LocalSpriteSorter());
 
-        // Since we resorted the list and actually modified the particles, we need to
-        // make sure we set the new head of the list
-        mParticleList.Particles = particle;
+        forRange (ParticleSortInfo& info, mSortedParticles.All())
+            mDrawOrder.PushBack(info.mParticle);
     }
 } // namespace Plasma
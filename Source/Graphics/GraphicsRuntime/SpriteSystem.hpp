@@ -63,7 +63,21 @@ public:
 
   // Internal
 
+  /// A particle and its key when sorting.
+  struct ParticleSortInfo
+  {
+    Particle* mParticle;
+    u32 mSortValue;
+  };
+
+  /// Fills DrawOrder with the particles in the order they're drawn in the view.
+  /// Unsorted particles are drawn newest first.
   void CheckSort(ViewBlock& viewBlock);
+
+  /// Reused every time the particles are drawn, the particles themselves are
+  /// never moved.
+  Array<Particle*> mDrawOrder;
+  Array<ParticleSortInfo> mSortedParticles;
 };
 
 } // namespace Plasma
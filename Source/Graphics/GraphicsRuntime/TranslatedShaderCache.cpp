@@ -0,0 +1,97 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+// Identifies a cached shader file
+static const u32 cTranslatedShaderSignature = 0x52444853;
+// Must be incremented whenever the cached shader layout changes
+static const u32 cTranslatedShaderVersion = 1;
+// The oldest cached shaders are deleted when the directory grows past this
+static const u64 cMaxCacheSize = 64 * 1024 * 1024;
+
+String TranslatedShaderCache::sDirectory;
+
+static void SaveStage(BinaryBufferSaver& saver, StringRange stage)
+{
+  u32 size = (u32)stage.SizeInBytes();
+  saver.FundamentalType(size);
+  saver.Data((byte*)stage.Data(), size);
+}
+
+void TranslatedShaderCache::SetDirectory(StringParam directory)
+{
+  sDirectory = directory;
+  if (!sDirectory.Empty())
+    DiskCache::TrimDirectory(sDirectory, cMaxCacheSize);
+}
+
+String TranslatedShaderCache::GetDirectory()
+{
+  return sDirectory;
+}
+
+bool TranslatedShaderCache::IsEnabled()
+{
+  return !sDirectory.Empty();
+}
+
+bool TranslatedShaderCache::Load(StringParam key, ShaderEntry& entry)
+{
+  if (sDirectory.Empty())
+    return false;
+
+  // Shaders cached by a different layout, or that were not fully written, are skipped
+  String cachePath = GetCachePath(key);
+  DiskCacheReader reader;
+  if (!DiskCache::Load(cachePath, cTranslatedShaderSignature, cTranslatedShaderVersion, reader))
+    return false;
+
+  String vertexShader, geometryShader, pixelShader;
+  u32 end = 0;
+  bool loaded = reader.ReadString(vertexShader) && reader.ReadString(geometryShader) &&
+                reader.ReadString(pixelShader) && reader.Read(end) && end == BinaryEndSignature &&
+                reader.GetRemainingSize() == 0;
+
+  // Delete a shader that didn't read back the way it was written
+  if (!loaded || vertexShader.Empty() || pixelShader.Empty())
+  {
+    DiskCache::Delete(cachePath);
+    return false;
+  }
+
+  entry.mVertexShader = vertexShader;
+  entry.mGeometryShader = geometryShader;
+  entry.mPixelShader = pixelShader;
+  return true;
+}
+
+void TranslatedShaderCache::Save(StringParam key, ShaderEntry& entry)
+{
+  if (sDirectory.Empty())
+    return;
+
+  BinaryBufferSaver saver;
+  saver.Open();
+
+  SaveStage(saver, entry.mVertexShader);
+  SaveStage(saver, entry.mGeometryShader);
+  SaveStage(saver, entry.mPixelShader);
+
+  u32 end = BinaryEndSignature;
+  saver.FundamentalType(end);
+
+  uint size = saver.GetSize();
+  byte* buffer = (byte*)plAllocate(size);
+  saver.ExtractInto(buffer, size);
+  DiskCache::Save(GetCachePath(key), cTranslatedShaderSignature, cTranslatedShaderVersion, buffer, size);
+  plDeallocate(buffer);
+}
+
+String TranslatedShaderCache::GetCachePath(StringParam key)
+{
+  return FilePath::Combine(sDirectory, BuildString(key, ".bin"));
+}
+
+} // namespace Plasma
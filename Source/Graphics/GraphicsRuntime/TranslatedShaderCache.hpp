@@ -0,0 +1,37 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Plasma
+{
+
+/// Keeps the shaders translated by the LightningShaderGenerator on disk, so
+/// shaders built from unchanged fragments skip compositing and translation.
+/// Translated shaders are keyed by a hash of the fragment sources, the
+/// shader's composition, and the settings of the translation pipeline.
+class TranslatedShaderCache
+{
+public:
+  /// Sets the directory translated shaders are stored in. Caching is disabled
+  /// while the directory is empty. The directory should be unique to the engine
+  /// version, as the core libraries and translation passes are not hashed. The
+  /// oldest shaders in the directory are deleted if it has grown past its size limit.
+  static void SetDirectory(StringParam directory);
+  static String GetDirectory();
+
+  static bool IsEnabled();
+
+  /// Loads the translated stages cached under the key into the entry.
+  /// Returns false if the key has not been cached.
+  static bool Load(StringParam key, ShaderEntry& entry);
+
+  /// Caches the translated stages of the entry under the key.
+  static void Save(StringParam key, ShaderEntry& entry);
+
+private:
+  /// Returns the path the shader of the key is cached at.
+  static String GetCachePath(StringParam key);
+
+  static String sDirectory;
+};
+
+} // namespace Plasma
@@ -1036,6 +1036,8 @@ namespace Plasma
         mDriverSupport.mTextureCompression = texture_compression;
         mDriverSupport.mMultiTargetBlend = draw_buffers_blend;
         mDriverSupport.mSamplerObjects = sampler_objects;
+        // Instanced draws are core since OpenGL 3.1 (and in WebGL 2).
+        mDriverSupport.mInstancing = true;
 
         // Intel integrated graphics does not render correctly with borderless
         // Window's aero on OpenGL.
@@ -1217,6 +1219,7 @@ namespace Plasma
     {
         GlMaterialRenderData* renderData = new GlMaterialRenderData();
         renderData->mResourceId = 0;
+        renderData->mReadsPerObjectInputs = false;
         return renderData;
     }
 
@@ -1244,6 +1247,7 @@ namespace Plasma
 
         renderData->mCompositeName = info->mCompositeName;
         renderData->mResourceId = info->mMaterialId;
+        renderData->mReadsPerObjectInputs = info->mReadsPerObjectInputs;
     }
 
     void OpenglRenderer::AddMesh(AddMeshInfo* info)
@@ -2069,9 +2073,15 @@ namespace Plasma
         if (meshData == nullptr || materialData == nullptr)
             return;
 
+        // Instance batches are drawn with their own vertex fragment.
+        uint instanceCount = viewNode.mInstanceRange.Count() / cInstanceTransformStride;
+        CoreVertexType::Enum coreVertexType = frameNode.mCoreVertexType;
+        if (instanceCount != 0)
+            coreVertexType = CoreVertexType::InstancedMesh;
+
         // Shader permutation lookup for vertex type and render pass
         ShaderKey shaderKey(materialData->mCompositeName,
-                            StringPair(GetCoreVertexFragmentName(frameNode.mCoreVertexType), mRenderPassName));
+                            StringPair(GetCoreVertexFragmentName(coreVertexType), mRenderPassName));
         GlShader* shader = GetShader(shaderKey);
         if (shader == nullptr)
             return;
@@ -2084,9 +2094,20 @@ namespace Plasma
             mActiveMaterial = 0;
         }
 
-        // Per object built-in inputs
+        // Per object built-in inputs, instance batches use the first object's values
+        // for anything that isn't in the instance transforms.
         SetShaderParameters(&frameNode, &viewNode);
 
+        if (instanceCount != 0)
+        {
+            GLint location = glGetUniformLocation(mActiveShader, "InstanceData.InstanceTransforms");
+            if (location != -1)
+            {
+                glUniformMatrix4fv(location, viewNode.mInstanceRange.Count(), cTransposeMatrices,
+                                   mRenderQueues->mInstanceTransforms[viewNode.mInstanceRange.start].array);
+            }
+        }
+
         // Set RenderPass inputs once on new shader or if a reset is triggered
         if (mActiveMaterial == 0)
         {
@@ -2129,7 +2150,16 @@ namespace Plasma
     	TracyGpuZone("DrawStatic");
     	
         glBindVertexArray(meshData->mVertexArray);
-        if (meshData->mIndexBuffer == 0)
+        if (instanceCount != 0)
+        {
+            if (meshData->mIndexBuffer == 0)
+                glDrawArraysInstanced(
+                    GlPrimitiveType(meshData->mPrimitiveType), 0, meshData->mIndexCount, instanceCount);
+            else
+                glDrawElementsInstanced(GlPrimitiveType(meshData->mPrimitiveType), meshData->mIndexCount,
+                                        GL_UNSIGNED_INT, static_cast<void*>(nullptr), instanceCount);
+        }
+        else if (meshData->mIndexBuffer == 0)
             // If nothing is bound, glDrawArrays will invoke the shader pipeline the
             // given number of times
             glDrawArrays(GlPrimitiveType(meshData->mPrimitiveType), 0, meshData->mIndexCount);
@@ -0,0 +1,117 @@
+// MIT Licensed (see LICENSE.md).
+
+#include "Precompiled.hpp"
+
+namespace Lightning
+{
+static const char* cCallBenchmarkCode = "class CallBenchmark\n"
+                                        "{\n"
+                                        "  [Static]\n"
+                                        "  function Increment(value : Integer) : Integer\n"
+                                        "  {\n"
+                                        "    return value + 1;\n"
+                                        "  }\n"
+                                        "\n"
+                                        "  [Static]\n"
+                                        "  function CallLoop(count : Integer) : Integer\n"
+                                        "  {\n"
+                                        "    var total = 0;\n"
+                                        "    for (var i = 0; i < count; ++i)\n"
+                                        "    {\n"
+                                        "      total = CallBenchmark.Increment(total);\n"
+                                        "    }\n"
+                                        "    return total;\n"
+                                        "  }\n"
+                                        "\n"
+                                        "  [Static]\n"
+                                        "  function EmptyLoop(count : Integer) : Integer\n"
+                                        "  {\n"
+                                        "    var total = 0;\n"
+                                        "    for (var i = 0; i < count; ++i)\n"
+                                        "    {\n"
+                                        "      total = total + 1;\n"
+                                        "    }\n"
+                                        "    return total;\n"
+                                        "  }\n"
+                                        "}\n";
+
+CallBenchmarkResults::CallBenchmarkResults() : Iterations(0), NativeToScriptNs(0.0), ScriptToScriptNs(0.0)
+{
+}
+
+// Invokes a static function that takes and returns an Integer
+static bool CallIntegerFunction(Function* function, ExecutableState* state, Integer argument, Integer& resultOut)
+{
+  ExceptionReport report;
+  Call call(function, state);
+  call.Set<Integer>(0, argument);
+  call.Invoke(report);
+  if (report.HasThrownExceptions())
+    return false;
+
+  resultOut = call.Get<Integer>(Call::Return);
+  return true;
+}
+
+bool RunCallBenchmark(size_t iterations, CallBenchmarkResults& results)
+{
+  Module dependencies;
+  Project project;
+  project.AddCodeFromString(cCallBenchmarkCode, "CallBenchmark");
+  LibraryRef library = project.Compile("CallBenchmark", dependencies, EvaluationMode::Project);
+  if (library == nullptr)
+    return false;
+  dependencies.PushBack(library);
+
+  BoundType* type = library->BoundTypes.FindValue("CallBenchmark", nullptr);
+  if (type == nullptr)
+    return false;
+
+  Array<Type*> parameters;
+  parameters.PushBack(LightningTypeId(Integer));
+  Type* returnType = LightningTypeId(Integer);
+  Function* increment = type->FindFunction("Increment", parameters, returnType, FindMemberOptions::Static);
+  Function* callLoop = type->FindFunction("CallLoop", parameters, returnType, FindMemberOptions::Static);
+  Function* emptyLoop = type->FindFunction("EmptyLoop", parameters, returnType, FindMemberOptions::Static);
+  if (increment == nullptr || callLoop == nullptr || emptyLoop == nullptr)
+    return false;
+
+  ExecutableState* state = dependencies.Link();
+
+  // Run each function once first so nothing is measured cold
+  Integer result = 0;
+  bool succeeded = CallIntegerFunction(increment, state, 0, result) &&
+                   CallIntegerFunction(callLoop, state, 1, result) &&
+                   CallIntegerFunction(emptyLoop, state, 1, result);
+
+  Plasma::Timer timer;
+
+  // Native to script, a new Call per invocation
+  timer.Reset();
+  result = 0;
+  for (size_t i = 0; i < iterations && succeeded; ++i)
+    succeeded = CallIntegerFunction(increment, state, result, result);
+  double nativeToScript = timer.UpdateAndGetTime();
+
+  // Script to script, timing the same loop with and without the call in it
+  timer.Reset();
+  succeeded = succeeded && CallIntegerFunction(callLoop, state, (Integer)iterations, result);
+  double callLoopTime = timer.UpdateAndGetTime();
+
+  timer.Reset();
+  succeeded = succeeded && CallIntegerFunction(emptyLoop, state, (Integer)iterations, result);
+  double emptyLoopTime = timer.UpdateAndGetTime();
+
+  delete state;
+
+  if (!succeeded || iterations == 0)
+    return false;
+
+  const double cNanosecondsPerSecond = 1000000000.0;
+  results.Iterations = iterations;
+  results.NativeToScriptNs = nativeToScript * cNanosecondsPerSecond / (double)iterations;
+  results.ScriptToScriptNs =
+      Math::Max(callLoopTime - emptyLoopTime, 0.0) * cNanosecondsPerSecond / (double)iterations;
+  return true;
+}
+} // namespace Lightning
@@ -0,0 +1,35 @@
+// MIT Licensed (see LICENSE.md).
+
+#pragma once
+#ifndef LIGHTNING_CALL_BENCHMARK_HPP
+#  define LIGHTNING_CALL_BENCHMARK_HPP
+
+namespace Lightning
+{
+// The cost of calling a tiny script function, as measured by RunCallBenchmark
+class PlasmaShared CallBenchmarkResults
+{
+public:
+  // Constructor
+  CallBenchmarkResults();
+
+  // How many calls were timed for each measurement
+  size_t Iterations;
+
+  // Nanoseconds per call when native code invokes a script function through a
+  // Call (the way events and component callbacks enter script)
+  double NativeToScriptNs;
+
+  // Nanoseconds per call when a script function calls another script function
+  // (the cost of the surrounding loop is subtracted)
+  double ScriptToScriptNs;
+};
+
+// Compiles a small library and times calls to a function that only adds one to
+// its argument, roughly the size of a property getter. This measures the fixed
+// overhead the virtual machine pays on every call. Returns false if the library
+// did not compile or a call threw an exception
+PlasmaShared bool RunCallBenchmark(size_t iterations, CallBenchmarkResults& results);
+} // namespace Lightning
+
+#endif
@@ -1018,6 +1018,11 @@ void CodeGenerator::GenerateBinaryOperation(BinaryOperatorNode*& node, Generator
 
       // The size is needed for some operations, such as value comparison
       opcode.Size = node->LeftOperand->ResultType->GetCopyableSize();
+
+      // Operating on two locals is by far the most common case, so use an instruction
+      // that reads them directly rather than switching on each operand's type
+      if (opcode.Left.Type == OperandType::Local && opcode.Right.Type == OperandType::Local)
+        opcode.Instruction = VirtualMachine::GetLocalOperandInstruction(info.Instruction);
     }
   }
 
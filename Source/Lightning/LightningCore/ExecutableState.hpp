@@ -223,11 +223,6 @@ public:
   // created
   ExceptionReport* Report;
 
-  // When we're inside the VM, this is the location that we jump to if an
-  // exception occurs This is only set when actually inside the VM's
-  // 'ExecuteNext' function
-  jmp_buf ExceptionJump;
-
   // The number of timeouts we have associated with this stack frame
   // When this frame gets destroyed/unrolled, we need to pop these timeouts
   size_t Timeouts;
@@ -43,6 +43,16 @@
               LightningEnumValue(AssignmentBitwiseOr##Type) LightningEnumValue(AssignmentBitwiseXor##Type)                     \
                   LightningEnumValue(AssignmentBitwiseAnd##Type)
 
+// Binary operators whose operands and output are all locals (picked by the code
+// generator so the virtual machine doesn't have to switch on the operand types)
+#define LightningLocalArithmeticInstructions(Type)                                                                         \
+  LightningEnumValue(Add##Type##Locals) LightningEnumValue(Subtract##Type##Locals) LightningEnumValue(Multiply##Type##Locals)
+
+#define LightningLocalComparisonInstructions(Type)                                                                         \
+  LightningEnumValue(TestLessThan##Type##Locals) LightningEnumValue(TestLessThanOrEqualTo##Type##Locals)                   \
+      LightningEnumValue(TestGreaterThan##Type##Locals) LightningEnumValue(TestGreaterThanOrEqualTo##Type##Locals)         \
+          LightningEnumValue(TestEquality##Type##Locals) LightningEnumValue(TestInequality##Type##Locals)
+
 // Core instructions
 LightningEnumValue(InvalidInstruction)
 
@@ -135,3 +145,9 @@ LightningEnumValue(InvalidInstruction)
                                                                                                                 AnyDynamicMemberGet)
                                                                                                                 LightningEnumValue(
                                                                                                                     AnyDynamicMemberSet)
+
+// Operand specialized instructions
+LightningLocalArithmeticInstructions(Integer) LightningLocalComparisonInstructions(Integer)
+    LightningLocalArithmeticInstructions(Real) LightningLocalComparisonInstructions(Real)
+        LightningLocalArithmeticInstructions(Real2) LightningLocalArithmeticInstructions(Real3)
+            LightningLocalArithmeticInstructions(Real4)
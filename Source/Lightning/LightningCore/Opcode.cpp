@@ -505,5 +505,14 @@ void GenerateDebugInstructionInfo(Array<DebugInstruction>& debugOut)
       info.Options.PushBack(PlasmaOffsetOf(CopyOpcode, Mode));
     }
   }
+
+  // Operand specialized instructions read and write the same operands as their generic versions
+  for (size_t i = 0; i < Instruction::Count; ++i)
+  {
+    Instruction::Enum instruction = (Instruction::Enum)i;
+    Instruction::Enum specialized = VirtualMachine::GetLocalOperandInstruction(instruction);
+    if (specialized != instruction)
+      debugOut[specialized] = debugOut[instruction];
+  }
 }
 } // namespace Lightning
@@ -306,6 +306,7 @@ String GetDocumentationCStringOrEmpty(cstr string);
 #  include "RangeBinding.hpp"
 #  include "Tokenizer.hpp"
 #  include "VirtualMachine.hpp"
+#  include "CallBenchmark.hpp"
 #  include "Base64.hpp"
 #  include "DataDrivenLexer.hpp"
 #  include "Wrapper.hpp"
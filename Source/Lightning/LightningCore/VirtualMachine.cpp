@@ -284,7 +284,7 @@ GetField(PerFrameData* stackFrame, PerFrameData* reportFrame, OperandIndex handl
     stackFrame->State->ThrowNullReferenceException(*reportFrame->Report);
 
     // Unwind our stack
-    longjmp(reportFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Return the data (with the member offset)
@@ -353,7 +353,7 @@ PlasmaForceInline T& GetOperand(PerFrameData* stackFrame, PerFrameData* reportFr
   stackFrame->State->ThrowException(*reportFrame->Report, message);
 
   // Unwind our stack
-  longjmp(reportFrame->ExceptionJump, ExceptionJumpResult);
+  throw ExceptionUnwind();
 }
 
 // Reusable code for the if opcodes
@@ -365,7 +365,7 @@ PlasmaForceInline void IfHandler(PerFrameData* stackFrame, const Opcode& opcode)
   if (stackFrame->State->ThrowExceptionOnTimeout(*stackFrame->Report))
   {
     // Unwind our stack
-    longjmp(stackFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Grab the rest of the data
@@ -542,6 +542,19 @@ VirtualInstructionFn InstructionTable[Instruction::Count] = {0};
 #define LightningCaseBinaryLValue(argType, operation, expression)                                                          \
   LightningCaseBinaryLValue2(argType, argType, operation, expression)
 
+// Same as a binary rvalue, but the code generator guaranteed every operand is a local
+#define LightningCaseBinaryRValueLocals(argType, resultType, operation, expression)                                         \
+  LightningVirtualInstruction(operation##argType##Locals)                                                                  \
+  {                                                                                                                    \
+    const BinaryRValueOpcode& op = (const BinaryRValueOpcode&)opcode;                                                  \
+    byte* frame = ourFrame->Frame;                                                                                     \
+    const argType& left = GetLocal<argType>(frame, op.Left.HandleConstantLocal);                                       \
+    const argType& right = GetLocal<argType>(frame, op.Right.HandleConstantLocal);                                     \
+    resultType& output = GetLocal<resultType>(frame, op.Output);                                                       \
+    expression;                                                                                                        \
+    programCounter += sizeof(BinaryRValueOpcode);                                                                      \
+  }
+
 #define LightningCaseUnaryRValue(argType, resultType, operation, expression)                                               \
   LightningVirtualInstruction(operation##argType)                                                                          \
   {                                                                                                                    \
@@ -717,6 +730,20 @@ VirtualInstructionFn InstructionTable[Instruction::Count] = {0};
   LightningCaseBinaryLValue(WithType, AssignmentBitwiseXor, output ^= right);                                              \
   LightningCaseBinaryLValue(WithType, AssignmentBitwiseAnd, output &= right);
 
+// Operand specialized versions of the hottest binary operators
+#define LightningLocalArithmeticCases(WithType)                                                                            \
+  LightningCaseBinaryRValueLocals(WithType, WithType, Add, output = left + right);                                         \
+  LightningCaseBinaryRValueLocals(WithType, WithType, Subtract, output = left - right);                                    \
+  LightningCaseBinaryRValueLocals(WithType, WithType, Multiply, output = left * right);
+
+#define LightningLocalComparisonCases(WithType)                                                                            \
+  LightningCaseBinaryRValueLocals(WithType, Boolean, TestLessThan, output = left < right);                                 \
+  LightningCaseBinaryRValueLocals(WithType, Boolean, TestLessThanOrEqualTo, output = left <= right);                       \
+  LightningCaseBinaryRValueLocals(WithType, Boolean, TestGreaterThan, output = left > right);                              \
+  LightningCaseBinaryRValueLocals(WithType, Boolean, TestGreaterThanOrEqualTo, output = left >= right);                    \
+  LightningCaseBinaryRValueLocals(WithType, Boolean, TestEquality, output = left == right);                                \
+  LightningCaseBinaryRValueLocals(WithType, Boolean, TestInequality, output = left != right);
+
 LightningVirtualInstruction(InternalDebugBreakpoint)
 {
   // Trigger the breakpoint
@@ -736,7 +763,7 @@ LightningVirtualInstruction(BeginTimeout)
   if (state->PushTimeout(ourFrame, op.LengthSeconds))
   {
     // Jump out so we don't run any more code
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Move the instruction counter past this opcode
@@ -750,7 +777,7 @@ LightningVirtualInstruction(EndTimeout)
   if (state->PopTimeout(ourFrame))
   {
     // Jump out so we don't run any more code
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Move the instruction counter past this opcode
@@ -931,7 +958,7 @@ LightningVirtualInstruction(RelativeGoTo)
   if (state->ThrowExceptionOnTimeout(report))
   {
     // Jump out so we don't run any more code
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Grab the rest of the data
@@ -953,7 +980,7 @@ LightningVirtualInstruction(PrepForFunctionCall)
   if (state->ThrowExceptionOnTimeout(report))
   {
     // Jump out so we don't run any more code
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Grab the rest of the data
@@ -970,7 +997,7 @@ LightningVirtualInstruction(PrepForFunctionCall)
   {
     // Throw an exception and bail out
     state->ThrowException(report, "Attempted to invoke a null delegate");
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Get the frame at the top of the stack (it could be ours)
@@ -984,7 +1011,7 @@ LightningVirtualInstruction(PrepForFunctionCall)
   // jump out
   if (newFrame->AttemptThrowStackExceptions(report))
   {
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Check if the "to be invoked" function is a static function (should we skip
@@ -1017,7 +1044,7 @@ LightningVirtualInstruction(FunctionCall)
   // Check to see if we threw any exceptions in the above invokation
   if (report.HasThrownExceptions())
   {
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Increment the program counter to point past the opcode
@@ -1040,7 +1067,7 @@ LightningVirtualInstruction(LocalObject)
   // If allocating the stack object threw an exception...
   if (report.HasThrownExceptions())
   {
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Copy the handle to the stack
@@ -1068,7 +1095,7 @@ LightningVirtualInstruction(NewObject)
   // If allocating the stack object threw an exception...
   if (report.HasThrownExceptions())
   {
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Copy the handle to the stack
@@ -1096,7 +1123,7 @@ LightningVirtualInstruction(PropertyDelegate)
   // If allocating the stack object threw an exception...
   if (report.HasThrownExceptions())
   {
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Copy the handle to the stack
@@ -1206,7 +1233,7 @@ LightningVirtualInstruction(DeleteObject)
                                          handle.Manager->GetName().c_str()));
 
     // Jump back since we just threw an exception
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Increment the program counter to point past the opcode
@@ -1233,7 +1260,7 @@ LightningVirtualInstruction(ThrowException)
   }
 
   // Jump back since we just threw an exception
-  longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+  throw ExceptionUnwind();
 }
 
 LightningVirtualInstruction(TypeId)
@@ -1298,7 +1325,7 @@ LightningVirtualInstruction(ConvertFromAny)
     state->ThrowException(report, "Cannot cast a null any type");
 
     // Jump back since we just threw an exception
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // If we can't directly convert the any into this type...
@@ -1317,7 +1344,7 @@ LightningVirtualInstruction(ConvertFromAny)
     state->ThrowException(report, error);
 
     // Jump back since we just threw an exception
-    longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+    throw ExceptionUnwind();
   }
 
   // Grab the bytes that will hold the value we copy from the Any
@@ -1467,6 +1494,10 @@ LightningIntegralCases(Byte) LightningScalarCases(Byte) LightningIntegralCases(I
                 LightningVectorCases(Real3, Real, Boolean3) LightningVectorCases(Real4, Real, Boolean4)
                     LightningScalarCases(DoubleReal) LightningIntegralCases(DoubleInteger) LightningScalarCases(DoubleInteger)
 
+LightningLocalArithmeticCases(Integer) LightningLocalComparisonCases(Integer) LightningLocalArithmeticCases(Real)
+    LightningLocalComparisonCases(Real) LightningLocalArithmeticCases(Real2) LightningLocalArithmeticCases(Real3)
+        LightningLocalArithmeticCases(Real4)
+
                         LightningEqualityCases(Boolean, Boolean) LightningEqualityCases(Handle, Boolean)
                             LightningEqualityCases(Delegate, Boolean) LightningEqualityCases(Any, Boolean)
 
@@ -1541,6 +1572,44 @@ void VirtualMachine::InitializeJumpTable()
 #undef LightningEnumValue
 }
 
+#define LightningLocalArithmeticMapping(Type)                                                                              \
+  case Instruction::Add##Type:                                                                                         \
+    return Instruction::Add##Type##Locals;                                                                             \
+  case Instruction::Subtract##Type:                                                                                    \
+    return Instruction::Subtract##Type##Locals;                                                                        \
+  case Instruction::Multiply##Type:                                                                                    \
+    return Instruction::Multiply##Type##Locals;
+
+#define LightningLocalComparisonMapping(Type)                                                                              \
+  case Instruction::TestLessThan##Type:                                                                                \
+    return Instruction::TestLessThan##Type##Locals;                                                                    \
+  case Instruction::TestLessThanOrEqualTo##Type:                                                                       \
+    return Instruction::TestLessThanOrEqualTo##Type##Locals;                                                           \
+  case Instruction::TestGreaterThan##Type:                                                                             \
+    return Instruction::TestGreaterThan##Type##Locals;                                                                 \
+  case Instruction::TestGreaterThanOrEqualTo##Type:                                                                    \
+    return Instruction::TestGreaterThanOrEqualTo##Type##Locals;                                                        \
+  case Instruction::TestEquality##Type:                                                                                \
+    return Instruction::TestEquality##Type##Locals;                                                                    \
+  case Instruction::TestInequality##Type:                                                                              \
+    return Instruction::TestInequality##Type##Locals;
+
+Instruction::Enum VirtualMachine::GetLocalOperandInstruction(Instruction::Enum instruction)
+{
+  switch (instruction)
+  {
+    LightningLocalArithmeticMapping(Integer);
+    LightningLocalComparisonMapping(Integer);
+    LightningLocalArithmeticMapping(Real);
+    LightningLocalComparisonMapping(Real);
+    LightningLocalArithmeticMapping(Real2);
+    LightningLocalArithmeticMapping(Real3);
+    LightningLocalArithmeticMapping(Real4);
+  default:
+    return instruction;
+  }
+}
+
 void VirtualMachine::ExecuteNext(Call& call, ExceptionReport& report)
 {
   // Since we do a raw copy, we always tell the caller to ignore debug checking
@@ -1559,13 +1628,6 @@ void VirtualMachine::ExecuteNext(Call& call, ExceptionReport& report)
   ourFrame->ProgramCounter = 0;
   size_t& programCounter = ourFrame->ProgramCounter;
 
-  // Setup where we jump to if an exception occurs
-  int jumpResult = setjmp(ourFrame->ExceptionJump);
-
-  // If an exception occurred...
-  if (jumpResult == ExceptionJumpResult)
-    return;
-
   // Store the compacted opcode as an attempt to bring the opcode into crash
   // reports / mini-dumps Also save it into a non-thread safe global pointer
   // (hopefully it will be pulled in)
@@ -1574,22 +1636,40 @@ void VirtualMachine::ExecuteNext(Call& call, ExceptionReport& report)
   LightningLastRunningFunction = ourFrame->CurrentFunction;
   LightningLastRunningOpcodeLength = ourFrame->CurrentFunction->CompactedOpcode.Size();
 
-  // Loop through all the opcodes in the function
-  // We don't need to check for the end since the return opcode will exit this
-  // function
-  LightningLoop
+  // Instructions that report an exception throw an 'ExceptionUnwind' back to here.
+  // The report already holds the exception so all we have to do is return.
+  try
   {
-    // Grab the current opcode that we're executing
-    const Opcode& opcode = *(Opcode*)(compactedOpcode + programCounter);
+    // Loop through all the opcodes in the function
+    // We don't need to check for the end since the return opcode will exit this
+    // function
+    LightningLoop
+    {
+      // Grab the current opcode that we're executing
+      const Opcode& opcode = *(Opcode*)(compactedOpcode + programCounter);
+
+      // Opcode events only matter when a debugger asked for them, so only pay for the
+      // calls then (checked every instruction since a debugger can attach at any time)
+      if (state->EnableDebugEvents)
+      {
+        // If any pre opcode callbacks are set then send the event
+        state->SendOpcodeEvent(Events::OpcodePreStep, ourFrame);
+        InstructionTable[opcode.Instruction](state, call, report, programCounter, ourFrame, opcode);
 
-    // If any pre opcode callbacks are set then send the event
-    state->SendOpcodeEvent(Events::OpcodePreStep, ourFrame);
-    InstructionTable[opcode.Instruction](state, call, report, programCounter, ourFrame, opcode);
+        // If any post opcode callbacks are set then send the event
+        state->SendOpcodeEvent(Events::OpcodePostStep, ourFrame);
+      }
+      else
+      {
+        InstructionTable[opcode.Instruction](state, call, report, programCounter, ourFrame, opcode);
+      }
 
-    // If any post opcode callbacks are set then send the event
-    state->SendOpcodeEvent(Events::OpcodePostStep, ourFrame);
-    if (opcode.Instruction == Instruction::Return)
-      return;
+      if (opcode.Instruction == Instruction::Return)
+        return;
+    }
+  }
+  catch (const ExceptionUnwind&)
+  {
   }
 }
 
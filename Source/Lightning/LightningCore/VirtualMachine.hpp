@@ -6,9 +6,12 @@
 
 namespace Lightning
 {
-// This is just a special identifier that means we jumped, there's really no
-// reason to the number... ;)
-static const int ExceptionJumpResult = 1729;
+// Thrown by an instruction (after the exception has been reported) to unwind back to
+// the 'ExecuteNext' running it. Unlike a setjmp on every call this costs nothing
+// unless an exception actually occurs, which matters for tiny functions like getters.
+struct ExceptionUnwind
+{
+};
 
 // This class is responsible for executing a stream of opcodes
 class PlasmaShared VirtualMachine
@@ -21,6 +24,10 @@ public:
   // Execute a function, starting from a given stack frame
   static void ExecuteNext(Call& call, ExceptionReport& report);
 
+  // Returns the version of a binary instruction that assumes both operands and the
+  // output are locals (or the same instruction if there is no specialized version)
+  static Instruction::Enum GetLocalOperandInstruction(Instruction::Enum instruction);
+
   // Return the value of an enum property (the user data Contains the value)
   static void EnumerationProperty(Call& call, ExceptionReport& report);
 
@@ -117,7 +124,7 @@ public:
     if (GenericIsZero(value))
     {
       ExecutableState::GetCallingState()->ThrowException(String::Format("Attempted to %s by plasma", name));
-      longjmp(ourFrame->ExceptionJump, ExceptionJumpResult);
+      throw ExceptionUnwind();
     }
   }
 
@@ -38,6 +38,7 @@ LightningDefineType(NetObject, builder, type)
   LightningBindGetterSetterProperty(AccurateTimestampOnOnline);
   LightningBindGetterSetterProperty(AccurateTimestampOnChange);
   LightningBindGetterSetterProperty(AccurateTimestampOnOffline);
+  LightningBindGetterSetterProperty(ReplicationPriority);
   LightningBindGetterProperty(OnlineTimestamp)->Add(new EditInGameFilter);
   LightningBindGetterProperty(LastChangeTimestamp)->Add(new EditInGameFilter);
   LightningBindGetterProperty(OfflineTimestamp)->Add(new EditInGameFilter);
@@ -133,6 +134,7 @@ void NetObject::Serialize(Serializer& stream)
   SerializeNameDefault(mAccurateTimestampOnChange, accurateTimestampsByDefault);
   stream.SerializeFieldDefault(
       "AccurateTimestampOnOffline", mAccurateTimestampOnUninitialization, accurateTimestampsByDefault);
+  SerializeNameDefault(mReplicationPriority, GetReplicationPriority());
   SerializeResourceName(mAutomaticChannel, NetChannelConfigManager);
   SerializeNameDefault(mNetPropertyInfos, NetPropertyInfoArray());
 }
@@ -1249,6 +1251,7 @@ void NetObject::ResetConfig()
   SetAccurateTimestampOnOnline();
   SetAccurateTimestampOnChange();
   SetAccurateTimestampOnOffline();
+  SetReplicationPriority();
 }
 
 void NetObject::SetDetectOutgoingChanges(bool detectOutgoingChanges)
@@ -1305,6 +1308,15 @@ bool NetObject::GetAccurateTimestampOnOffline() const
   return Replica::GetAccurateTimestampOnUninitialization();
 }
 
+void NetObject::SetReplicationPriority(float replicationPriority)
+{
+  Replica::SetReplicationPriority(replicationPriority);
+}
+float NetObject::GetReplicationPriority() const
+{
+  return Replica::GetReplicationPriority();
+}
+
 float NetObject::GetOnlineTimestamp() const
 {
   // Get initialization timestamp
@@ -162,6 +162,11 @@ public:
   void SetAccurateTimestampOnOffline(bool accurateTimestampOnOffline = false);
   bool GetAccurateTimestampOnOffline() const;
 
+  /// Controls how quickly this net object's changes are sent when the net
+  /// peer's change budget limits how many changes are sent each frame.
+  void SetReplicationPriority(float replicationPriority = 1);
+  float GetReplicationPriority() const;
+
   /// Timestamp indicating when this net object was brought online, else 0.
   float GetOnlineTimestamp() const;
   /// Timestamp indicating when this net object was last changed, else 0.
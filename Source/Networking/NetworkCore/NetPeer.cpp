@@ -75,6 +75,10 @@ LightningDefineType(NetPeer, builder, type)
   LightningBindGetterProperty(NetSpaceCount)->Add(new EditInGameFilter);
   LightningBindGetterSetterProperty(FrameFillWarning);
   LightningBindGetterSetterProperty(FrameFillSkip);
+  LightningBindGetterSetterProperty(InterestManagement);
+  LightningBindGetterSetterProperty(InterestRadius);
+  LightningBindGetterSetterProperty(ChangeBudget);
+  LightningBindGetterSetterProperty(DeltaCompression);
 
   // Bind link interface
   LightningBindGetterProperty(LinkCount)->Add(new EditInGameFilter);
@@ -189,6 +193,10 @@ void NetPeer::ResetConfig()
   // Peer settings
   SetFrameFillWarning();
   SetFrameFillSkip();
+  SetInterestManagement();
+  SetInterestRadius();
+  SetChangeBudget();
+  SetDeltaCompression();
 
   // Timeout settings
   SetInternetHostListTimeout();
@@ -229,6 +237,10 @@ void NetPeer::Serialize(Serializer& stream)
   // Serialize peer settings
   SerializeNameDefault(mFrameFillWarning, GetFrameFillWarning());
   SerializeNameDefault(mFrameFillSkip, GetFrameFillSkip());
+  SerializeNameDefault(mInterestManagement, GetInterestManagement());
+  SerializeNameDefault(mInterestRadius, GetInterestRadius());
+  SerializeNameDefault(mChangeBudget, GetChangeBudget());
+  SerializeNameDefault(mDeltaCompression, GetDeltaCompression());
 
   // Serialize peer timeouts
   SerializeNameDefault(mInternetHostListTimeout, GetInternetHostListTimeout());
@@ -1276,6 +1288,42 @@ float NetPeer::GetFrameFillSkip() const
   return Replicator::GetFrameFillSkip();
 }
 
+void NetPeer::SetInterestManagement(bool interestManagement)
+{
+  Replicator::SetInterestManagement(interestManagement);
+}
+bool NetPeer::GetInterestManagement() const
+{
+  return Replicator::GetInterestManagement();
+}
+
+void NetPeer::SetInterestRadius(float interestRadius)
+{
+  Replicator::SetInterestRadius(interestRadius);
+}
+float NetPeer::GetInterestRadius() const
+{
+  return Replicator::GetInterestRadius();
+}
+
+void NetPeer::SetChangeBudget(uint changeBudget)
+{
+  Replicator::SetChangeBudget(changeBudget);
+}
+uint NetPeer::GetChangeBudget() const
+{
+  return Replicator::GetChangeBudget();
+}
+
+void NetPeer::SetDeltaCompression(bool deltaCompression)
+{
+  Replicator::SetDeltaCompression(deltaCompression);
+}
+bool NetPeer::GetDeltaCompression() const
+{
+  return Replicator::GetDeltaCompression();
+}
+
 //
 // Link Interface
 //
@@ -4713,6 +4761,51 @@ void NetPeer::RemovingLink(PeerLink* link)
   link->SetUserData(nullptr);
 }
 
+//
+// Replicator Interest Management Interface
+//
+
+void NetPeer::UpdatingInterest()
+{
+  // For all net objects
+  forRange (Replica* replica, Replicator::GetReplicas().All())
+  {
+    // Has a transform?
+    NetObject* netObject = static_cast<NetObject*>(replica);
+    Cog* cog = netObject->GetOwner();
+    Transform* transform = cog ? cog->has(Transform) : nullptr;
+    if (transform)
+      replica->SetInterestPosition(transform->GetWorldTranslation());
+    else
+      replica->ClearInterestPosition(); // Relevant to everyone
+  }
+
+  // For all links
+  PeerLinkSet links = Replicator::GetLinks();
+  forRange (PeerLink* link, links.All())
+  {
+    // Get replicator link
+    ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
+    replicatorLink->ClearInterestObservers();
+
+    // Observe from every net object with a transform owned by their users
+    NetUserRange users = GetUsersAddedByPeer(replicatorLink->GetReplicatorId().value());
+    forRange (Cog* userCog, users)
+    {
+      NetUser* netUser = userCog->has(NetUser);
+      if (!netUser)
+        continue;
+
+      forRange (Cog* ownedCog, netUser->GetOwnedNetObjects())
+      {
+        Transform* transform = ownedCog->has(Transform);
+        if (transform)
+          replicatorLink->AddInterestObserver(transform->GetWorldTranslation());
+      }
+    }
+  }
+}
+
 //
 // Replicator Handshake Sequence Interface
 //
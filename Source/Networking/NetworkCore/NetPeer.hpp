@@ -263,6 +263,29 @@ public:
   void SetFrameFillSkip(float frameFillSkip = 0.9);
   float GetFrameFillSkip() const;
 
+  /// [Server] Controls whether net object changes are only sent to the peers
+  /// they are relevant to, in priority order. Net objects with a transform are
+  /// relevant to a peer if they are within the interest radius of a net object
+  /// owned by one of the peer's users.
+  void SetInterestManagement(bool interestManagement = false);
+  bool GetInterestManagement() const;
+
+  /// Controls how far from a peer's owned net objects other net objects are
+  /// relevant to that peer.
+  void SetInterestRadius(float interestRadius = 100);
+  float GetInterestRadius() const;
+
+  /// Controls how many bytes of net object changes may be sent to each peer
+  /// every frame while interest management is enabled (0 is unlimited).
+  void SetChangeBudget(uint changeBudget = 0);
+  uint GetChangeBudget() const;
+
+  /// Controls whether unreliable net channel changes are sent as snapshots
+  /// delta encoded against the last snapshot each peer acknowledged, so values
+  /// which have not changed since then cost almost nothing to send.
+  void SetDeltaCompression(bool deltaCompression = false);
+  bool GetDeltaCompression() const;
+
   //
   // Link Interface
   //
@@ -754,6 +777,15 @@ public:
   /// Called before a link is removed.
   void RemovingLink(PeerLink* link) override;
 
+  //
+  // Replicator Interest Management Interface
+  //
+
+  /// Called before relevance is found while interest management is enabled.
+  /// Positions net objects at their transforms and observes from the net
+  /// objects owned by each link's users.
+  void UpdatingInterest() override;
+
   //
   // Replicator Handshake Sequence Interface
   //
@@ -143,6 +143,38 @@ public:
     return mPacketsReceived;
   }
 
+  /// Returns the minimum sent delta change byte size
+  Bytes GetMinDeltaChangeBytes() const
+  {
+    return mDeltaChangeBytesMin;
+  }
+  /// Returns the average sent delta change byte size
+  double GetAvgDeltaChangeBytes() const
+  {
+    return mDeltaChangeBytesAvg;
+  }
+  /// Returns the maximum sent delta change byte size
+  Bytes GetMaxDeltaChangeBytes() const
+  {
+    return mDeltaChangeBytesMax;
+  }
+
+  /// Returns the number of bytes sent as delta changes
+  uintmax GetDeltaChangeBytesSent() const
+  {
+    return BITS_TO_BYTES(uintmax(mDeltaChangeBitsCompressed));
+  }
+  /// Returns how many times smaller the sent delta changes were than the
+  /// replica channel states they encode (1 if no delta changes were sent)
+  double GetDeltaCompressionRatio() const
+  {
+    uintmax compressedBits = mDeltaChangeBitsCompressed;
+    if (compressedBits == 0)
+      return 1;
+
+    return double(uintmax(mDeltaChangeBitsUncompressed)) / double(compressedBits);
+  }
+
   /// Returns a summary of all peer statistics as an array of pairs containing
   /// the property name and array of minimum, average, and maximum values
   Array<Pair<String, Array<String>>> GetStatsSummary() const
@@ -192,6 +224,13 @@ protected:
     mReceivedPacketBytesMin = 0;
     mReceivedPacketBytesAvg = 0;
     mReceivedPacketBytesMax = 0;
+
+    mDeltaChangeBytesUpdated = false;
+    mDeltaChangeBytesMin = 0;
+    mDeltaChangeBytesAvg = 0;
+    mDeltaChangeBytesMax = 0;
+    mDeltaChangeBitsUncompressed = 0;
+    mDeltaChangeBitsCompressed = 0;
   }
 
   /// Initializes all bandwidth statistics
@@ -305,6 +344,27 @@ protected:
       mReceivedPacketBytesUpdated = true;
     }
   }
+  /// Updates the delta change statistics
+  void UpdateDeltaChange(Bits uncompressedBits, Bits compressedBits)
+  {
+    Bytes sample = BITS_TO_BYTES(compressedBits);
+    if (mDeltaChangeBytesUpdated)
+    {
+      mDeltaChangeBytesMin = std::min(Bytes(mDeltaChangeBytesMin), sample);
+      mDeltaChangeBytesAvg = Average(double(mDeltaChangeBytesAvg), double(sample), 0.1);
+      mDeltaChangeBytesMax = std::max(Bytes(mDeltaChangeBytesMax), sample);
+    }
+    else
+    {
+      mDeltaChangeBytesMin = sample;
+      mDeltaChangeBytesAvg = sample;
+      mDeltaChangeBytesMax = sample;
+      mDeltaChangeBytesUpdated = true;
+    }
+
+    mDeltaChangeBitsUncompressed = uintmax(mDeltaChangeBitsUncompressed) + uncompressedBits;
+    mDeltaChangeBitsCompressed = uintmax(mDeltaChangeBitsCompressed) + compressedBits;
+  }
   /// Updates the packets sent statistics
   void UpdatePacketsSent()
   {
@@ -360,6 +420,13 @@ private:
   double_type mReceivedPacketBytesAvg;   /// Average received packet bytes
   Bytes_type mReceivedPacketBytesMax;    /// Maximum received packet bytes
 
+  bool_type mDeltaChangeBytesUpdated;         /// Delta change bytes updated?
+  Bytes_type mDeltaChangeBytesMin;            /// Minimum sent delta change bytes
+  double_type mDeltaChangeBytesAvg;           /// Average sent delta change bytes
+  Bytes_type mDeltaChangeBytesMax;            /// Maximum sent delta change bytes
+  uintmax_type mDeltaChangeBitsUncompressed;  /// Replica channel state bits encoded as delta changes
+  uintmax_type mDeltaChangeBitsCompressed;    /// Delta change bits sent
+
   uintmax_type mPacketsSent;     /// Packets sent
   uintmax_type mPacketsReceived; /// Packets received
 };
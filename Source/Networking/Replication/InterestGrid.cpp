@@ -0,0 +1,121 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+// Cell coordinates are packed into 21 bits each
+static const int cCellCoordinateBits = 21;
+static const int cCellCoordinateOffset = 1 << (cCellCoordinateBits - 1);
+
+//                              ReplicaRelevance //
+
+ReplicaRelevance::ReplicaRelevance() : mReplica(nullptr), mWeight(0)
+{
+}
+ReplicaRelevance::ReplicaRelevance(Replica* replica, float weight) : mReplica(replica), mWeight(weight)
+{
+}
+
+//                                InterestGrid //
+
+InterestGrid::Entry::Entry() : mCell(0), mReplica(nullptr), mPosition(Vector3::cZero)
+{
+}
+InterestGrid::Entry::Entry(Replica* replica, const Vector3& position) :
+    mCell(0),
+    mReplica(replica),
+    mPosition(position)
+{
+}
+
+InterestGrid::InterestGrid() : mEntries(), mCellSize(1)
+{
+}
+
+void InterestGrid::Clear()
+{
+  mEntries.Clear();
+}
+
+void InterestGrid::Add(Replica* replica, const Vector3& position)
+{
+  mEntries.PushBack(Entry(replica, position));
+}
+
+void InterestGrid::Build(float cellSize)
+{
+  Assert(cellSize > 0);
+  mCellSize = cellSize;
+
+  // Assign each entry its cell
+  forRange (Entry& entry, mEntries.All())
+  {
+    entry.mCell = PackCell(GetCellCoordinate(entry.mPosition.x),
+                           GetCellCoordinate(entry.mPosition.y),
+                           GetCellCoordinate(entry.mPosition.z));
+  }
+
+  // Sort entries by cell
+  Sort(mEntries.All(), EntrySortPolicy());
+}
+
+void InterestGrid::Query(const Vector3& position, float radius, ReplicaRelevanceArray& results) const
+{
+  if (mEntries.Empty() || radius <= 0)
+    return;
+
+  // Get cells overlapped by the query sphere
+  int minX = GetCellCoordinate(position.x - radius);
+  int minY = GetCellCoordinate(position.y - radius);
+  int minZ = GetCellCoordinate(position.z - radius);
+  int maxX = GetCellCoordinate(position.x + radius);
+  int maxY = GetCellCoordinate(position.y + radius);
+  int maxZ = GetCellCoordinate(position.z + radius);
+
+  float radiusSq = radius * radius;
+
+  // For all overlapped cells
+  for (int x = minX; x <= maxX; ++x)
+    for (int y = minY; y <= maxY; ++y)
+      for (int z = minZ; z <= maxZ; ++z)
+      {
+        // Find the first entry in this cell
+        u64 cell = PackCell(x, y, z);
+        Array<Entry>::range entries = LowerBound(mEntries.All(), cell, EntrySortPolicy());
+
+        // For all entries in this cell
+        for (; !entries.Empty() && entries.Front().mCell == cell; entries.PopFront())
+        {
+          const Entry& entry = entries.Front();
+
+          // Within radius?
+          float distanceSq = (entry.mPosition - position).LengthSq();
+          if (distanceSq > radiusSq)
+            continue; // Skip
+
+          // Closer replicas have a higher weight
+          float weight = radius / (radius + Math::Sqrt(distanceSq));
+          results.PushBack(ReplicaRelevance(entry.mReplica, weight));
+        }
+      }
+}
+
+uint InterestGrid::GetReplicaCount() const
+{
+  return mEntries.Size();
+}
+
+int InterestGrid::GetCellCoordinate(float position) const
+{
+  float cell = Math::Floor(position / mCellSize);
+  return (int)Math::Clamp(cell, float(-cCellCoordinateOffset), float(cCellCoordinateOffset - 1));
+}
+
+u64 InterestGrid::PackCell(int x, int y, int z)
+{
+  return (u64(x + cCellCoordinateOffset) << (cCellCoordinateBits * 2)) |
+         (u64(y + cCellCoordinateOffset) << cCellCoordinateBits) | u64(z + cCellCoordinateOffset);
+}
+
+} // namespace Plasma
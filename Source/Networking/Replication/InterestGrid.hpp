@@ -0,0 +1,104 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Plasma
+{
+
+//                              ReplicaRelevance //
+
+/// Replica Relevance
+/// A replica found near an interest observer
+struct ReplicaRelevance
+{
+  /// Constructors
+  ReplicaRelevance();
+  ReplicaRelevance(Replica* replica, float weight);
+
+  /// Data
+  Replica* mReplica; /// Relevant replica
+  float mWeight;     /// Priority weight (1 at the observer, approaching 0.5 at the interest radius)
+};
+
+/// Sorts replica relevances by replica
+struct ReplicaRelevanceSortPolicy
+{
+  bool operator()(const ReplicaRelevance& lhs, const ReplicaRelevance& rhs) const
+  {
+    return lhs.mReplica < rhs.mReplica;
+  }
+  bool operator()(const ReplicaRelevance& lhs, Replica* rhs) const
+  {
+    return lhs.mReplica < rhs;
+  }
+};
+
+/// Typedefs
+typedef Array<ReplicaRelevance> ReplicaRelevanceArray;
+
+//                                InterestGrid //
+
+/// Interest Grid
+/// Sorts replicas with an interest position into uniform grid cells so the
+/// replicas near a point can be found without testing every replica
+/// (Rebuilt every update, the memory is kept between rebuilds)
+class InterestGrid
+{
+public:
+  /// Constructor
+  InterestGrid();
+
+  /// Removes all replicas from the grid
+  void Clear();
+
+  /// Adds the replica at the specified position
+  /// (The grid must be built again before it is queried)
+  void Add(Replica* replica, const Vector3& position);
+
+  /// Sorts the added replicas into cells of the specified size
+  void Build(float cellSize);
+
+  /// Adds every replica within the radius of the position to the results, along
+  /// with its priority weight
+  void Query(const Vector3& position, float radius, ReplicaRelevanceArray& results) const;
+
+  /// Returns the number of replicas in the grid
+  uint GetReplicaCount() const;
+
+private:
+  /// Grid Entry
+  struct Entry
+  {
+    /// Constructors
+    Entry();
+    Entry(Replica* replica, const Vector3& position);
+
+    /// Data
+    u64 mCell;          /// Packed cell coordinates
+    Replica* mReplica;  /// Replica
+    Vector3 mPosition;  /// Replica interest position
+  };
+
+  /// Sorts entries by cell
+  struct EntrySortPolicy
+  {
+    bool operator()(const Entry& lhs, const Entry& rhs) const
+    {
+      return lhs.mCell < rhs.mCell;
+    }
+    bool operator()(const Entry& lhs, u64 rhs) const
+    {
+      return lhs.mCell < rhs;
+    }
+  };
+
+  /// Returns the cell coordinate containing the specified position coordinate
+  int GetCellCoordinate(float position) const;
+  /// Returns the packed cell key of the specified cell coordinates
+  static u64 PackCell(int x, int y, int z);
+
+  /// Data
+  Array<Entry> mEntries; /// Grid entries sorted by cell (once built)
+  float mCellSize;       /// Cell size
+};
+
+} // namespace Plasma
@@ -1904,6 +1904,14 @@ LinkPlugin::LinkPlugin(size_t messageTypeCount) :
 {
 }
 
+void LinkPlugin::UpdateDeltaChangeStats(Bits uncompressedBits, Bits compressedBits)
+{
+  Assert(IsInitialized());
+
+  // Update link stats
+  mLink->UpdateDeltaChange(uncompressedBits, compressedBits);
+}
+
 //
 // Internal
 //
@@ -662,6 +662,9 @@ protected:
   /// Constructor
   LinkPlugin(size_t messageTypeCount);
 
+  /// Adds a sent delta change to the link's bandwidth statistics
+  void UpdateDeltaChangeStats(Bits uncompressedBits, Bits compressedBits);
+
   //
   // Link Plugin Interface
   //
@@ -24,6 +24,9 @@ Replica::Replica() :
     mAccurateTimestampOnInitialization(false),
     mAccurateTimestampOnChange(false),
     mAccurateTimestampOnUninitialization(false),
+    mReplicationPriority(1),
+    mHasInterestPosition(false),
+    mInterestPosition(Vector3::cZero),
     mReplicaChannels(),
     mUserData(nullptr)
 {
@@ -47,6 +50,9 @@ Replica::Replica(const CreateContext& createContext, const ReplicaType& replicaT
     mAccurateTimestampOnInitialization(false),
     mAccurateTimestampOnChange(false),
     mAccurateTimestampOnUninitialization(false),
+    mReplicationPriority(1),
+    mHasInterestPosition(false),
+    mInterestPosition(Vector3::cZero),
     mReplicaChannels(),
     mUserData(nullptr)
 {
@@ -247,6 +253,25 @@ bool Replica::IsNapping() const
   return !IsAwake();
 }
 
+void Replica::SetInterestPosition(const Vector3& interestPosition)
+{
+  mInterestPosition = interestPosition;
+  mHasInterestPosition = true;
+}
+void Replica::ClearInterestPosition()
+{
+  mInterestPosition = Vector3::cZero;
+  mHasInterestPosition = false;
+}
+bool Replica::HasInterestPosition() const
+{
+  return mHasInterestPosition;
+}
+const Vector3& Replica::GetInterestPosition() const
+{
+  return mInterestPosition;
+}
+
 void Replica::ResetConfig()
 {
   SetDetectOutgoingChanges();
@@ -256,6 +281,7 @@ void Replica::ResetConfig()
   SetAccurateTimestampOnInitialization();
   SetAccurateTimestampOnChange();
   SetAccurateTimestampOnUninitialization();
+  SetReplicationPriority();
 }
 
 void Replica::SetDetectOutgoingChanges(bool detectOutgoingChanges)
@@ -321,6 +347,15 @@ bool Replica::GetAccurateTimestampOnUninitialization() const
   return mAccurateTimestampOnUninitialization;
 }
 
+void Replica::SetReplicationPriority(float replicationPriority)
+{
+  mReplicationPriority = replicationPriority;
+}
+float Replica::GetReplicationPriority() const
+{
+  return mReplicationPriority;
+}
+
 //
 // Replica Channel Management
 //
@@ -116,6 +116,16 @@ public:
   /// Returns true if all replica channels are napping (not awake), else false
   bool IsNapping() const;
 
+  /// Sets the replica's position used by interest management
+  /// (Replicas without an interest position are relevant to every link)
+  void SetInterestPosition(const Vector3& interestPosition);
+  /// Clears the replica's interest position
+  void ClearInterestPosition();
+  /// Returns true if the replica has an interest position, else false
+  bool HasInterestPosition() const;
+  /// Returns the replica's interest position
+  const Vector3& GetInterestPosition() const;
+
   //
   // Configuration
   //
@@ -163,6 +173,12 @@ public:
   void SetAccurateTimestampOnUninitialization(bool accurateTimestampOnUninitialization = false);
   bool GetAccurateTimestampOnUninitialization() const;
 
+  /// Controls how quickly the replica's changes are sent when interest
+  /// management limits how many changes are sent to a link each frame
+  /// (Unsent changes accumulate this priority every frame until they are sent)
+  void SetReplicationPriority(float replicationPriority = 1);
+  float GetReplicationPriority() const;
+
   //
   // Replica Channel Management
   //
@@ -243,6 +259,9 @@ public:
                                              /// replica channel)?
   bool mAccurateTimestampOnUninitialization; /// Accurate timestamp when
                                              /// uninitialized?
+  float mReplicationPriority;                /// Replication priority
+  bool mHasInterestPosition;                 /// Has interest position?
+  Vector3 mInterestPosition;                 /// Interest position
   ReplicaChannelSet mReplicaChannels;        /// Replica channels
   void* mUserData;                           /// Optional user data
 
@@ -468,7 +468,10 @@ bool ReplicaChannel::ObserveForChange()
   }
 }
 
-bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const
+bool ReplicaChannel::Serialize(BitStream& bitStream,
+                               ReplicationPhase::Enum replicationPhase,
+                               TimeMs timestamp,
+                               bool forceChanged) const
 {
   // Get replica channel type
   ReplicaChannelType* replicaChannelType = GetReplicaChannelType();
@@ -487,7 +490,7 @@ bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum repl
     forRange (ReplicaProperty* replicaProperty, GetReplicaProperties().All())
     {
       // Write replica property
-      bool result = replicaProperty->Serialize(bitStream, replicationPhase, timestamp);
+      bool result = replicaProperty->Serialize(bitStream, replicationPhase, timestamp, forceChanged);
       if (!result) // Unable?
       {
         Assert(false);
@@ -504,12 +507,12 @@ bool ReplicaChannel::Serialize(BitStream& bitStream, ReplicationPhase::Enum repl
     forRange (ReplicaProperty* replicaProperty, GetReplicaProperties().All())
     {
       // Write 'Has Changed?' Flag
-      bool hasChanged = replicaProperty->HasChanged();
+      bool hasChanged = forceChanged || replicaProperty->HasChanged();
       bitStream.Write(hasChanged);
       if (hasChanged) // Has changed?
       {
         // Write replica property
-        bool result = replicaProperty->Serialize(bitStream, replicationPhase, timestamp);
+        bool result = replicaProperty->Serialize(bitStream, replicationPhase, timestamp, forceChanged);
         if (!result) // Unable?
         {
           Assert(false);
@@ -162,8 +162,13 @@ public:
   bool ObserveForChange();
 
   /// Serializes the replica channel
+  /// (Force changed writes every replica property as changed, used to bring a
+  /// link that missed changes up to date with a change message)
   /// Returns true if successful, else false
-  bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const;
+  bool Serialize(BitStream& bitStream,
+                 ReplicationPhase::Enum replicationPhase,
+                 TimeMs timestamp,
+                 bool forceChanged = false) const;
   /// Deserializes the replica channel
   /// Returns true if successful, else false
   bool Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp);
@@ -190,6 +190,7 @@ typedef ArrayMap<EmplaceContext, ReplicaSet> EmplaceMap;
 typedef ArrayMap<EmplaceContext, IdStore<EmplaceId>> EmplaceIdStores;
 typedef ArraySet<ReplicatorId> ReplicatorIdSet;
 typedef ArrayMap<ReplicaChannel*, MessageChannelId> OutReplicaChannels;
+typedef ArrayMap<MessageChannelId, ReplicaChannel*> OutReplicaChannelsFlipped;
 typedef ArrayMap<MessageChannelId, ReplicaChannel*> InReplicaChannels;
 typedef ArrayMap<ReplicaChannel*, MessageChannelId> InReplicaChannelsFlipped;
 typedef Pair<Message, TransmissionDirection::Enum> MessageDirectionPair;
@@ -222,7 +223,7 @@ DeclareEnum2(AuthorityMode,
                       /// replica is made valid
 
 /// Replicator Plugin Message Types
-DeclareEnum11(ReplicatorMessageType,
+DeclareEnum13(ReplicatorMessageType,
               ConnectConfirmation,     /// Connect confirmation
               CreateContextItems,      /// Creation context cache items
               ReplicaTypeItems,        /// Replica type cache items
@@ -233,7 +234,9 @@ DeclareEnum11(ReplicatorMessageType,
               Destroy,                 /// Destroy command
               Change,                  /// Replica channel change
               Interrupt,               /// Interrupt step command
-              ReverseReplicaChannels); /// Reverse replica channel mappings
+              ReverseReplicaChannels,  /// Reverse replica channel mappings
+              DeltaChange,             /// Replica channel change (delta encoded snapshot)
+              DeltaAck);               /// Delta encoded snapshots stored (or baselines missing)
 
 // Replica Stream Serialization Mode
 DeclareEnum5(ReplicaStreamMode,
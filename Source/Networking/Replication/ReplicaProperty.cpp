@@ -1067,7 +1067,8 @@ bool SerializeArithmetic(BitStream& bitStream,
                          const ReplicaProperty* replicaProperty,
                          const ReplicaPropertyType* replicaPropertyType,
                          TimeMs timestamp,
-                         bool forceAll)
+                         bool forceAll,
+                         bool forceChanged)
 {
   // Primitive member info
   typedef typename BasicNativeTypePrimitiveMembers<PropertyType>::Type PrimitiveType;
@@ -1143,9 +1144,10 @@ bool SerializeArithmetic(BitStream& bitStream,
         const PrimitiveType& deltaThresholdPrimitiveMember = deltaThreshold.GetPrimitiveMemberOrError<PropertyType>(i);
 
         // Has this primitive member changed?
-        // (Current value and last value primitive members differ by more than
-        // the delta threshold value primitive member?)
+        // (Forced, or current value and last value primitive members differ by
+        // more than the delta threshold value primitive member?)
         bool hasChanged =
+            forceChanged ||
             (Math::Abs(currentValuePrimitiveMember - lastValuePrimitiveMember) > deltaThresholdPrimitiveMember);
 
         // Write 'Has Changed?' Flag
@@ -1189,8 +1191,8 @@ bool SerializeArithmetic(BitStream& bitStream,
         const PrimitiveType& lastValuePrimitiveMember = lastValue.GetPrimitiveMemberOrError<PropertyType>(i);
 
         // Has this primitive member changed?
-        // (Current value and last value primitive members differ?)
-        bool hasChanged = (currentValuePrimitiveMember != lastValuePrimitiveMember);
+        // (Forced, or current value and last value primitive members differ?)
+        bool hasChanged = forceChanged || (currentValuePrimitiveMember != lastValuePrimitiveMember);
 
         // Write 'Has Changed?' Flag
         bitStream.Write(hasChanged);
@@ -1360,7 +1362,8 @@ bool SerializeQuantizedArithmetic(BitStream& bitStream,
                                   const ReplicaProperty* replicaProperty,
                                   const ReplicaPropertyType* replicaPropertyType,
                                   TimeMs timestamp,
-                                  bool forceAll)
+                                  bool forceAll,
+                                  bool forceChanged)
 {
   // Primitive member info
   typedef typename BasicNativeTypePrimitiveMembers<PropertyType>::Type PrimitiveType;
@@ -1443,9 +1446,10 @@ bool SerializeQuantizedArithmetic(BitStream& bitStream,
       const PrimitiveType& quantumPrimitiveMember = quantum.GetPrimitiveMemberOrError<PropertyType>(i);
 
       // Has this primitive member changed?
-      // (Current value and last value primitive members differ by more than the
-      // delta threshold value primitive member?)
+      // (Forced, or current value and last value primitive members differ by
+      // more than the delta threshold value primitive member?)
       bool hasChanged =
+          forceChanged ||
           (Math::Abs(currentValuePrimitiveMember - lastValuePrimitiveMember) > deltaThresholdPrimitiveMember);
 
       // Write 'Has Changed?' Flag
@@ -1579,7 +1583,10 @@ bool DeserializeQuantizedArithmetic(Variant& newValue,
   return true;
 }
 
-bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const
+bool ReplicaProperty::Serialize(BitStream& bitStream,
+                                ReplicationPhase::Enum replicationPhase,
+                                TimeMs timestamp,
+                                bool forceChanged) const
 {
   // (For the initialization replication phase we want to forcefully serialize
   // all primitive-components to ensure a valid initial value state)
@@ -1618,7 +1625,7 @@ bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum rep
 
       // Non-Boolean Arithmetic Types
       SWITCH_CASES_NON_BOOL_ARITHMETIC_CALL_AND_RETURN(
-          SerializeArithmetic, bitStream, this, replicaPropertyType, timestamp, forceAll);
+          SerializeArithmetic, bitStream, this, replicaPropertyType, timestamp, forceAll, forceChanged);
     }
   }
   // Should quantize?
@@ -1637,7 +1644,7 @@ bool ReplicaProperty::Serialize(BitStream& bitStream, ReplicationPhase::Enum rep
 
       // Non-Boolean Arithmetic Types
       SWITCH_CASES_NON_BOOL_ARITHMETIC_CALL_AND_RETURN(
-          SerializeQuantizedArithmetic, bitStream, this, replicaPropertyType, timestamp, forceAll);
+          SerializeQuantizedArithmetic, bitStream, this, replicaPropertyType, timestamp, forceAll, forceChanged);
     }
   }
 }
@@ -147,8 +147,13 @@ public:
   //
 
   /// Serializes the replica property
+  /// (Force changed writes every primitive member as changed, used to bring a
+  /// link that missed changes up to date with a change message)
   /// Returns true if successful, else false
-  bool Serialize(BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp) const;
+  bool Serialize(BitStream& bitStream,
+                 ReplicationPhase::Enum replicationPhase,
+                 TimeMs timestamp,
+                 bool forceChanged = false) const;
   /// Deserializes the replica property
   /// Returns true if successful, else false
   bool Deserialize(const BitStream& bitStream, ReplicationPhase::Enum replicationPhase, TimeMs timestamp);
@@ -69,6 +69,7 @@ class ReplicaChannelType;
 class ReplicaProperty;
 class ReplicaPropertyType;
 class Route;
+class InterestGrid;
 } // namespace Plasma
 
 // Replicator Includes
@@ -78,5 +79,7 @@ class Route;
 #include "ReplicaChannel.hpp"
 #include "Replica.hpp"
 #include "ReplicaStream.hpp"
+#include "InterestGrid.hpp"
+#include "SnapshotDelta.hpp"
 #include "ReplicatorLink.hpp"
 #include "Replicator.hpp"
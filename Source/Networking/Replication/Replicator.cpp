@@ -574,6 +574,10 @@ void Replicator::ResetConfig()
 {
   SetFrameFillWarning();
   SetFrameFillSkip();
+  SetInterestManagement();
+  SetInterestRadius();
+  SetChangeBudget();
+  SetDeltaCompression();
 }
 
 void Replicator::SetFrameFillWarning(float frameFillWarning)
@@ -594,6 +598,42 @@ float Replicator::GetFrameFillSkip() const
   return mFrameFillSkip;
 }
 
+void Replicator::SetInterestManagement(bool interestManagement)
+{
+  mInterestManagement = interestManagement;
+}
+bool Replicator::GetInterestManagement() const
+{
+  return mInterestManagement;
+}
+
+void Replicator::SetInterestRadius(float interestRadius)
+{
+  mInterestRadius = Math::Max(interestRadius, 0.001f);
+}
+float Replicator::GetInterestRadius() const
+{
+  return mInterestRadius;
+}
+
+void Replicator::SetChangeBudget(Bytes changeBudget)
+{
+  mChangeBudget = changeBudget;
+}
+Bytes Replicator::GetChangeBudget() const
+{
+  return mChangeBudget;
+}
+
+void Replicator::SetDeltaCompression(bool deltaCompression)
+{
+  mDeltaCompression = deltaCompression;
+}
+bool Replicator::GetDeltaCompression() const
+{
+  return mDeltaCompression;
+}
+
 //
 // Replica Channel Type Management
 //
@@ -1803,8 +1843,10 @@ bool Replicator::RouteChange(ReplicaChannel* replicaChannel, const Route& route,
   if (!links.Empty()) // Links in route?
   {
     // Serialize replica channel change
+    // (Delta encoded changes are sent as snapshots of the full replica channel
+    // state, so unchanged values match the baseline)
     Message message(ReplicatorMessageType::Change);
-    if (!SerializeChange(replicaChannel, message, timestamp)) // Unable?
+    if (!SerializeChange(replicaChannel, message, timestamp, UsesDeltaCompression(replicaChannel))) // Unable?
       return false;
 
     // Should include an accurate timestamp with this message?
@@ -1814,12 +1856,25 @@ bool Replicator::RouteChange(ReplicaChannel* replicaChannel, const Route& route,
       message.SetTimestamp(timestamp);
     }
 
+    // Using interest management?
+    bool usesInterestManagement = UsesInterestManagement();
+
     // For all replicator links in route
     forRange (PeerLink* link, links.All())
     {
       // Get replicator link
       ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
+      // Using interest management?
+      if (usesInterestManagement)
+      {
+        // Has replica remotely and it is relevant to them?
+        // (Queued changes are sent in priority order at the end of the update)
+        if (replicatorLink->HasReplica(replica) && replicatorLink->IsRelevant(replica))
+          replicatorLink->QueueChange(replicaChannel, message);
+        continue;
+      }
+
       // Should skip change replication?
       if (replicatorLink->ShouldSkipChangeReplication())
         continue; // Skip link
@@ -1834,13 +1889,16 @@ bool Replicator::RouteChange(ReplicaChannel* replicaChannel, const Route& route,
   // Success
   return true;
 }
-bool Replicator::SerializeChange(ReplicaChannel* replicaChannel, Message& message, TimeMs timestamp)
+bool Replicator::SerializeChange(ReplicaChannel* replicaChannel,
+                                 Message& message,
+                                 TimeMs timestamp,
+                                 bool forceChanged)
 {
   // Serialize replica channel change
   BitStream& bitStream = message.GetData();
 
   // Write replica channel
-  bool result = replicaChannel->Serialize(bitStream, ReplicationPhase::Change, timestamp);
+  bool result = replicaChannel->Serialize(bitStream, ReplicationPhase::Change, timestamp, forceChanged);
   if (!result) // Unable?
   {
     Assert(false);
@@ -1851,6 +1909,42 @@ bool Replicator::SerializeChange(ReplicaChannel* replicaChannel, Message& messag
   return true;
 }
 
+bool Replicator::UsesInterestManagement() const
+{
+  return GetInterestManagement() && GetRole() == Role::Server;
+}
+bool Replicator::UsesDeltaCompression(ReplicaChannel* replicaChannel) const
+{
+  return GetDeltaCompression() &&
+         replicaChannel->GetReplicaChannelType()->GetReliabilityMode() == ReliabilityMode::Unreliable;
+}
+void Replicator::UpdateInterest(const PeerLinkSet& links)
+{
+  ZoneScoped;
+
+  // User callback (update interest positions and observers)
+  UpdatingInterest();
+
+  // Add all positioned replicas to the interest grid
+  mInterestGrid.Clear();
+  forRange (Replica* replica, mReplicaSet.All())
+    if (replica->HasInterestPosition())
+      mInterestGrid.Add(replica, replica->GetInterestPosition());
+
+  // Cells the size of the interest radius keep queries to a few cells
+  mInterestGrid.Build(GetInterestRadius());
+
+  // For all links
+  forRange (PeerLink* link, links.All())
+  {
+    // Get replicator link
+    ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
+
+    // Find replicas relevant to this link
+    replicatorLink->UpdateRelevance(mInterestGrid, GetInterestRadius());
+  }
+}
+
 bool Replicator::RouteInterrupt(const Route& route)
 {
   Assert(GetRole() == Role::Server);
@@ -1957,6 +2051,13 @@ void Replicator::OnUpdate()
     replicatorLink->UpdateStart(now);
   }
 
+  // Using interest management?
+  if (UsesInterestManagement())
+  {
+    // Find the replicas relevant to each link
+    UpdateInterest(links);
+  }
+
   //
   // Update
   //
@@ -1986,6 +2087,9 @@ void Replicator::OnUpdate()
     // Get replicator link
     ReplicatorLink* replicatorLink = link->GetPlugin<ReplicatorLink>("ReplicatorLink");
 
+    // Send queued changes in priority order
+    replicatorLink->SendQueuedChanges(now);
+
     // Handle update end
     replicatorLink->UpdateEnd(now);
   }
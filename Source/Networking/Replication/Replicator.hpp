@@ -215,6 +215,31 @@ public:
   void SetFrameFillSkip(float frameFillSkip = 0.9);
   float GetFrameFillSkip() const;
 
+  /// [Server] Controls whether or not changes are only sent to the links they
+  /// are relevant to, in priority order
+  /// Replicas with an interest position are relevant to a link if they are
+  /// within the interest radius of one of the link's interest observers
+  void SetInterestManagement(bool interestManagement = false);
+  bool GetInterestManagement() const;
+
+  /// Controls how far from a link's interest observers replicas are relevant
+  void SetInterestRadius(float interestRadius = 100);
+  float GetInterestRadius() const;
+
+  /// Controls how many bytes of changes may be sent to each link every frame
+  /// while interest management is enabled (0 is unlimited)
+  /// Changes that don't fit are sent on a later frame, and the longer they wait
+  /// the higher their priority becomes
+  void SetChangeBudget(Bytes changeBudget = 0);
+  Bytes GetChangeBudget() const;
+
+  /// Controls whether or not unreliable replica channel changes are sent as
+  /// snapshots delta encoded against the last snapshot each link acknowledged
+  /// Values that match the acknowledged snapshot cost almost nothing to send,
+  /// at the cost of keeping recent snapshots per link and replica channel
+  void SetDeltaCompression(bool deltaCompression = false);
+  bool GetDeltaCompression() const;
+
   //
   // Replica Channel Type Management
   //
@@ -334,6 +359,17 @@ public:
   {
   }
 
+  //
+  // Interest Management Interface
+  //
+
+  /// [Server] Called at the start of every update while interest management
+  /// is enabled, before relevance is found
+  /// Update replica interest positions and link interest observers here
+  virtual void UpdatingInterest()
+  {
+  }
+
   //
   // Handshake Sequence Interface
   //
@@ -501,8 +537,19 @@ public:
   /// Returns true if successful, else false
   bool RouteChange(ReplicaChannel* replicaChannel, const Route& route, TimeMs timestamp);
   /// Serializes a replica channel change
+  /// (Force changed serializes the full replica channel state as a change)
   /// Returns true if successful, else false
-  bool SerializeChange(ReplicaChannel* replicaChannel, Message& message, TimeMs timestamp);
+  bool SerializeChange(ReplicaChannel* replicaChannel, Message& message, TimeMs timestamp, bool forceChanged = false);
+
+  /// Returns true if interest management is enabled and we are the server,
+  /// else false
+  bool UsesInterestManagement() const;
+  /// Returns true if delta compression is enabled and the replica channel's
+  /// changes are unreliable, else false
+  bool UsesDeltaCompression(ReplicaChannel* replicaChannel) const;
+  /// [Server] Rebuilds the interest grid and finds the replicas relevant to
+  /// each link
+  void UpdateInterest(const PeerLinkSet& links);
 
   /// [Server] Routes an interrupt command
   /// Returns true if successful, else false
@@ -786,6 +833,11 @@ public:
   float mFrameFillSkip;                         /// Controls when to skip change replication for the
                                                 /// current frame because of remaining outgoing
                                                 /// bandwidth utilization ratio on any given link
+  bool mInterestManagement;                     /// Send changes only to links they are relevant to?
+  float mInterestRadius;                        /// Interest radius around link interest observers
+  Bytes mChangeBudget;                          /// Change bytes per link per frame (0 is unlimited)
+  bool mDeltaCompression;                       /// Send unreliable changes as delta encoded snapshots?
+  InterestGrid mInterestGrid;                   /// Positioned replicas (rebuilt every update)
   ReplicaChannelTypeSet mReplicaChannelTypes;   /// Replica channel type set
   ReplicaPropertyTypeSet mReplicaPropertyTypes; /// Replica property type set
 
@@ -4,6 +4,53 @@
 namespace Plasma
 {
 
+//                                QueuedChange //
+
+QueuedChange::QueuedChange() : mReplicaChannel(nullptr), mMessage(), mPriority(0), mSendFullChange(false)
+{
+}
+QueuedChange::QueuedChange(ReplicaChannel* replicaChannel) :
+    mReplicaChannel(replicaChannel),
+    mMessage(),
+    mPriority(0),
+    mSendFullChange(true)
+{
+}
+QueuedChange::QueuedChange(ReplicaChannel* replicaChannel, const Message& message) :
+    mReplicaChannel(replicaChannel),
+    mMessage(message),
+    mPriority(0),
+    mSendFullChange(false)
+{
+}
+
+/// Sorts queued changes by replica channel
+struct QueuedChangeChannelSortPolicy
+{
+  bool operator()(const QueuedChange& lhs, const QueuedChange& rhs) const
+  {
+    return lhs.mReplicaChannel < rhs.mReplicaChannel;
+  }
+};
+
+/// Sorts queued changes by highest priority first (then by replica ID so the
+/// send order doesn't depend on memory layout)
+struct QueuedChangePrioritySortPolicy
+{
+  bool operator()(const QueuedChange& lhs, const QueuedChange& rhs) const
+  {
+    if (lhs.mPriority != rhs.mPriority)
+      return lhs.mPriority > rhs.mPriority;
+
+    ReplicaId lhsReplicaId = lhs.mReplicaChannel->GetReplica()->GetReplicaId();
+    ReplicaId rhsReplicaId = rhs.mReplicaChannel->GetReplica()->GetReplicaId();
+    if (lhsReplicaId != rhsReplicaId)
+      return lhsReplicaId < rhsReplicaId;
+
+    return lhs.mReplicaChannel->GetName() < rhs.mReplicaChannel->GetName();
+  }
+};
+
 //                               ReplicatorLink //
 
 ReplicatorLink::ReplicatorLink(Replicator* replicator) :
@@ -15,13 +62,23 @@ ReplicatorLink::ReplicatorLink(Replicator* replicator) :
     mReplicaMap(),
     mCommandChannelId(0),
     mOutReplicaChannels(),
+    mOutReplicaChannelsFlipped(),
     mInReplicaChannels(),
     mInReplicaChannelsFlipped(),
     mLastConnectRequestData(),
     mLastConnectResponseData(),
     mShouldSkipChangeReplication(false),
     mLastFrameFillSkipNotificationTime(0),
-    mLastFrameFillWarningNotificationTime(0)
+    mLastFrameFillWarningNotificationTime(0),
+    mInterestObservers(),
+    mChangeBudget(0),
+    mRelevanceFiltered(false),
+    mRelevantReplicas(),
+    mPreviousRelevantReplicas(),
+    mQueuedChanges(),
+    mDeltaBaselines(),
+    mReceivedSnapshots(),
+    mDeltaAcks()
 {
 }
 
@@ -178,6 +235,60 @@ bool ReplicatorLink::ShouldSkipChangeReplication() const
   return mShouldSkipChangeReplication;
 }
 
+//
+// Interest Management
+//
+
+void ReplicatorLink::ClearInterestObservers()
+{
+  mInterestObservers.Clear();
+}
+void ReplicatorLink::AddInterestObserver(const Vector3& position)
+{
+  mInterestObservers.PushBack(position);
+}
+const Array<Vector3>& ReplicatorLink::GetInterestObservers() const
+{
+  return mInterestObservers;
+}
+
+void ReplicatorLink::SetChangeBudget(Bytes changeBudget)
+{
+  mChangeBudget = changeBudget;
+}
+Bytes ReplicatorLink::GetChangeBudget() const
+{
+  return mChangeBudget;
+}
+
+bool ReplicatorLink::IsRelevant(Replica* replica) const
+{
+  return GetRelevanceWeight(replica) != 0;
+}
+float ReplicatorLink::GetRelevanceWeight(Replica* replica) const
+{
+  // Not filtering by relevance or replica has no position?
+  if (!mRelevanceFiltered || !replica->HasInterestPosition())
+    return 1; // Always relevant
+
+  // Find replica in relevant set
+  ReplicaRelevanceArray::range relevance =
+      LowerBound(mRelevantReplicas.All(), replica, ReplicaRelevanceSortPolicy());
+  if (relevance.Empty() || relevance.Front().mReplica != replica) // Unable?
+    return 0;
+
+  return relevance.Front().mWeight;
+}
+const ReplicaRelevanceArray& ReplicatorLink::GetRelevantReplicas() const
+{
+  return mRelevantReplicas;
+}
+
+uint ReplicatorLink::GetQueuedChangeCount() const
+{
+  return mQueuedChanges.Size();
+}
+
 //
 // Internal
 //
@@ -227,6 +338,9 @@ void ReplicatorLink::UpdateStart(TimeMs now)
 }
 void ReplicatorLink::UpdateEnd(TimeMs now)
 {
+  // Acknowledge the delta encoded snapshots stored this update
+  SendDeltaAcks();
+
   // See if we should warn the user about their outgoing bandwidth utilization
   // this frame
   {
@@ -263,6 +377,190 @@ void ReplicatorLink::UpdateEnd(TimeMs now)
   }
 }
 
+void ReplicatorLink::UpdateRelevance(const InterestGrid& interestGrid, float interestRadius)
+{
+  // Keep the previous relevant set to find the replicas which just became
+  // relevant
+  bool wasRelevanceFiltered = mRelevanceFiltered;
+  mPreviousRelevantReplicas.Swap(mRelevantReplicas);
+  mRelevantReplicas.Clear();
+
+  // No observers?
+  mRelevanceFiltered = !mInterestObservers.Empty();
+  if (!mRelevanceFiltered)
+    return; // Every replica is relevant
+
+  // Find replicas near any observer
+  forRange (const Vector3& observer, mInterestObservers.All())
+    interestGrid.Query(observer, interestRadius, mRelevantReplicas);
+
+  // Sort by replica, keeping the highest weight of any replica found by
+  // several observers
+  Sort(mRelevantReplicas.All(), ReplicaRelevanceSortPolicy());
+  uint relevantCount = 0;
+  for (uint i = 0; i < mRelevantReplicas.Size(); ++i)
+  {
+    ReplicaRelevance& relevance = mRelevantReplicas[i];
+    if (relevantCount != 0 && mRelevantReplicas[relevantCount - 1].mReplica == relevance.mReplica)
+      mRelevantReplicas[relevantCount - 1].mWeight =
+          Math::Max(mRelevantReplicas[relevantCount - 1].mWeight, relevance.mWeight);
+    else
+      mRelevantReplicas[relevantCount++] = relevance;
+  }
+  mRelevantReplicas.Resize(relevantCount);
+
+  // Was every replica relevant before?
+  if (!wasRelevanceFiltered)
+    return; // Nothing could have been missed
+
+  // For all replicas which just became relevant
+  ReplicaRelevanceArray::range previous = mPreviousRelevantReplicas.All();
+  forRange (ReplicaRelevance& relevance, mRelevantReplicas.All())
+  {
+    while (!previous.Empty() && previous.Front().mReplica < relevance.mReplica)
+      previous.PopFront();
+    if (!previous.Empty() && previous.Front().mReplica == relevance.mReplica)
+      continue; // Skip, was already relevant
+
+    // Not expected remotely?
+    Replica* replica = relevance.mReplica;
+    if (!HasReplica(replica))
+      continue; // Skip
+
+    // Send the full state of every replica channel we replicate changes on
+    forRange (ReplicaChannel* replicaChannel, replica->GetReplicaChannels().All())
+    {
+      if (uint(replicaChannel->GetAuthority()) != uint(GetReplicator()->GetRole()))
+        continue;
+      if (!(replicaChannel->GetReplicaChannelType()->GetSerializationFlags() & SerializationFlags::OnChange))
+        continue;
+
+      QueueFullChange(replicaChannel);
+    }
+  }
+}
+
+void ReplicatorLink::QueueChange(ReplicaChannel* replicaChannel, const Message& message)
+{
+  Assert(message.GetType() == ReplicatorMessageType::Change);
+  mQueuedChanges.PushBack(QueuedChange(replicaChannel, message));
+}
+void ReplicatorLink::QueueFullChange(ReplicaChannel* replicaChannel)
+{
+  mQueuedChanges.PushBack(QueuedChange(replicaChannel));
+}
+
+void ReplicatorLink::SendQueuedChanges(TimeMs timestamp)
+{
+  if (mQueuedChanges.Empty())
+    return;
+
+  // Merge changes queued more than once for the same replica channel (they are
+  // sent as a full change since one change message can't replace several)
+  Sort(mQueuedChanges.All(), QueuedChangeChannelSortPolicy());
+  uint queuedCount = 0;
+  for (uint i = 0; i < mQueuedChanges.Size(); ++i)
+  {
+    QueuedChange& queuedChange = mQueuedChanges[i];
+    if (queuedCount != 0 && mQueuedChanges[queuedCount - 1].mReplicaChannel == queuedChange.mReplicaChannel)
+    {
+      QueuedChange& mergedChange = mQueuedChanges[queuedCount - 1];
+      mergedChange.mPriority = Math::Max(mergedChange.mPriority, queuedChange.mPriority);
+      mergedChange.mSendFullChange = true;
+      mergedChange.mMessage = Message();
+      continue;
+    }
+
+    // Replica is no longer relevant?
+    // (Its full state will be queued again once it becomes relevant)
+    Replica* replica = queuedChange.mReplicaChannel->GetReplica();
+    float weight = GetRelevanceWeight(replica);
+    if (weight == 0)
+      continue; // Drop
+
+    // Accumulate priority
+    queuedChange.mPriority += replica->GetReplicationPriority() * weight;
+
+    if (queuedCount != i)
+      mQueuedChanges[queuedCount] = queuedChange;
+    ++queuedCount;
+  }
+  mQueuedChanges.Resize(queuedCount);
+
+  // Skipping change replication this frame?
+  if (ShouldSkipChangeReplication())
+  {
+    // Everything queued will need to be sent in full
+    forRange (QueuedChange& queuedChange, mQueuedChanges.All())
+    {
+      queuedChange.mSendFullChange = true;
+      queuedChange.mMessage = Message();
+    }
+    return;
+  }
+
+  // Get change budget (0 is unlimited)
+  Bytes changeBudget = mChangeBudget ? mChangeBudget : GetReplicator()->GetChangeBudget();
+
+  // Send changes in priority order
+  Sort(mQueuedChanges.All(), QueuedChangePrioritySortPolicy());
+  Bytes bytesSent = 0;
+  uint sentCount = 0;
+  for (; sentCount < mQueuedChanges.Size(); ++sentCount)
+  {
+    QueuedChange& queuedChange = mQueuedChanges[sentCount];
+
+    // Send full change?
+    if (queuedChange.mSendFullChange)
+    {
+      // Serialize the full replica channel state as a change
+      queuedChange.mMessage = Message(ReplicatorMessageType::Change);
+      if (!GetReplicator()->SerializeChange(queuedChange.mReplicaChannel, queuedChange.mMessage, timestamp, true))
+      {
+        Assert(false);
+        continue;
+      }
+
+      // Should include an accurate timestamp with this message?
+      if (Replicator::ShouldIncludeAccurateTimestampOnChange(queuedChange.mReplicaChannel))
+        queuedChange.mMessage.SetTimestamp(timestamp);
+    }
+
+    // Exceeds the budget? (The first change is always sent so large changes
+    // can't stall the queue)
+    Bytes messageBytes = queuedChange.mMessage.GetData().GetBytesWritten();
+    if (changeBudget != 0 && bytesSent != 0 && bytesSent + messageBytes > changeBudget)
+      break;
+
+    // Send replica channel change
+    SendChange(queuedChange.mReplicaChannel, queuedChange.mMessage);
+    bytesSent += messageBytes;
+  }
+
+  // Keep the changes that were not sent, they will need to be sent in full
+  mQueuedChanges.Erase(mQueuedChanges.SubRange(0, sentCount));
+  forRange (QueuedChange& queuedChange, mQueuedChanges.All())
+  {
+    queuedChange.mSendFullChange = true;
+    queuedChange.mMessage = Message();
+  }
+}
+
+void ReplicatorLink::RemoveQueuedChanges(Replica* replica)
+{
+  uint queuedCount = 0;
+  for (uint i = 0; i < mQueuedChanges.Size(); ++i)
+  {
+    if (mQueuedChanges[i].mReplicaChannel->GetReplica() == replica)
+      continue; // Remove
+
+    if (queuedCount != i)
+      mQueuedChanges[queuedCount] = mQueuedChanges[i];
+    ++queuedCount;
+  }
+  mQueuedChanges.Resize(queuedCount);
+}
+
 //
 // Replica Helpers
 //
@@ -427,6 +725,9 @@ void ReplicatorLink::RemoveLiveReplica(Replica* replica)
     bool result = RemoveReplicaFromLiveSet(replica);
     Assert(result); // (Erase should have succeeded)
   }
+
+  // Remove any changes waiting to be sent
+  RemoveQueuedChanges(replica);
 }
 
 //
@@ -1160,6 +1461,11 @@ bool ReplicatorLink::DeserializeChange(const Message& message, TimeMs timestamp)
     return false;
   }
 
+  // Deserialize replica channel change
+  return DeserializeChange(replicaChannel, bitStream, timestamp);
+}
+bool ReplicatorLink::DeserializeChange(ReplicaChannel* replicaChannel, const BitStream& bitStream, TimeMs timestamp)
+{
   // Get replica channel type
   ReplicaChannelType* replicaChannelType = replicaChannel->GetReplicaChannelType();
   ReturnIf(!replicaChannelType, false, "ReplicaChannelType was null");
@@ -1251,6 +1557,13 @@ bool ReplicatorLink::SendChange(ReplicaChannel* replicaChannel, Message& message
     return false;
   }
 
+  // Using delta compression?
+  if (GetReplicator()->UsesDeltaCompression(replicaChannel))
+  {
+    // Send change message as a delta encoded snapshot
+    return SendDeltaChange(replicaChannel, message, channelId);
+  }
+
   // Send change message
   Status status;
   LinkPlugin::Send(
@@ -1272,6 +1585,193 @@ bool ReplicatorLink::ReceiveChange(const Message& message)
   return DeserializeChange(message, timestamp);
 }
 
+bool ReplicatorLink::SendDeltaChange(ReplicaChannel* replicaChannel,
+                                     const Message& message,
+                                     MessageChannelId channelId)
+{
+  Assert(message.GetType() == ReplicatorMessageType::Change);
+
+  // Get delta baseline
+  DeltaBaseline& deltaBaseline = mDeltaBaselines.FindOrInsert(replicaChannel);
+
+  // Get snapshot sequence (0 is reserved for no baseline)
+  uint16 sequence = deltaBaseline.mNextSequence;
+  if (++deltaBaseline.mNextSequence == 0)
+    deltaBaseline.mNextSequence = 1;
+
+  // Baseline is too old to still be kept by them?
+  if (deltaBaseline.mBaselineSequence != 0 && uint16(sequence - deltaBaseline.mBaselineSequence) >= cSnapshotWindow)
+  {
+    // Clear baseline (Encode against nothing instead)
+    deltaBaseline.mBaselineSequence = 0;
+    deltaBaseline.mBaseline.Clear(false);
+  }
+
+  // Serialize delta change
+  // (The change message contains the full replica channel state)
+  const BitStream& snapshot = message.GetData();
+  Message deltaMessage(ReplicatorMessageType::DeltaChange);
+  if (message.HasTimestamp())
+    deltaMessage.SetTimestamp(message.GetTimestamp());
+  BitStream& bitStream = deltaMessage.GetData();
+  bitStream.Write(sequence);
+  bitStream.Write(deltaBaseline.mBaselineSequence);
+  WriteSnapshotDelta(bitStream, deltaBaseline.mBaseline, snapshot);
+  Bits deltaBits = bitStream.GetBitsWritten();
+
+  // Send delta change message
+  Status status;
+  LinkPlugin::Send(status, PlasmaMove(deltaMessage), false, channelId);
+  if (status.Failed()) // Unable?
+    return false;
+
+  // Keep snapshot until they acknowledge storing it (or it falls out of the window)
+  deltaBaseline.mSentSnapshots.Add(sequence, snapshot);
+
+  // Update stats
+  UpdateDeltaChangeStats(snapshot.GetBitsWritten(), deltaBits);
+
+  // Success
+  return true;
+}
+bool ReplicatorLink::ReceiveDeltaChange(const Message& message)
+{
+  Assert(message.GetType() == ReplicatorMessageType::DeltaChange);
+
+  // Get replica channel
+  ReplicaChannel* replicaChannel = GetIncomingReplicaChannel(message.GetChannelId());
+  if (!replicaChannel) // Unable?
+    return false;
+
+  // Read snapshot sequences
+  const BitStream& bitStream = message.GetData();
+  uint16 sequence = 0;
+  uint16 baselineSequence = 0;
+  if (!bitStream.Read(sequence) || !bitStream.Read(baselineSequence) || sequence == 0) // Unable?
+    return false;
+
+  // Get baseline
+  SnapshotWindow& receivedSnapshots = mReceivedSnapshots.FindOrInsert(replicaChannel);
+  BitStream emptyBaseline;
+  const BitStream* baseline = &emptyBaseline;
+  if (baselineSequence != 0) // Has baseline?
+    baseline = receivedSnapshots.Find(baselineSequence);
+
+  // Read snapshot
+  BitStream snapshot;
+  if (!baseline || !ReadSnapshotDelta(bitStream, *baseline, snapshot)) // Unable?
+  {
+    // Tell them to stop encoding against this baseline (unless a newer snapshot was stored)
+    DeltaAckMap::iterator ackIter = mDeltaAcks.FindIterator(message.GetChannelId());
+    if (ackIter == mDeltaAcks.End())
+      mDeltaAcks.Insert(message.GetChannelId(), uint16(0));
+    else if (ackIter->second == baselineSequence)
+      ackIter->second = 0;
+    return false;
+  }
+
+  // Keep snapshot (it may become a baseline)
+  receivedSnapshots.Add(sequence, snapshot);
+
+  // Acknowledge the newest stored snapshot at the end of the update
+  uint16& ackSequence = mDeltaAcks.FindOrInsert(message.GetChannelId());
+  if (ackSequence == 0 || IsNewerSequence(sequence, ackSequence))
+    ackSequence = sequence;
+
+  // Get timestamp from message (may or may not be an accurate timestamp)
+  TimeMs timestamp = message.GetTimestamp();
+
+  // Deserialize replica channel change
+  return DeserializeChange(replicaChannel, snapshot, timestamp);
+}
+bool ReplicatorLink::SendDeltaAcks()
+{
+  // Nothing to acknowledge?
+  if (mDeltaAcks.Empty())
+    return true;
+
+  // Write the newest stored sequence of each incoming message channel
+  // (They opened these message channels, so the IDs match their outgoing ones)
+  bool result = true;
+  for (uint first = 0; first < mDeltaAcks.Size(); first += cMaxDeltaAcksPerMessage)
+  {
+    uint count = Math::Min(uint(mDeltaAcks.Size()) - first, cMaxDeltaAcksPerMessage);
+
+    Message message(ReplicatorMessageType::DeltaAck);
+    BitStream& bitStream = message.GetData();
+    bitStream.Write(uint16(count));
+    forRange (DeltaAckMap::value_type& deltaAck, mDeltaAcks.SubRange(first, count))
+    {
+      bitStream.Write(deltaAck.first);
+      bitStream.Write(deltaAck.second);
+    }
+
+    // Send delta ack message
+    // (A lost acknowledgement only delays the next baseline, they keep encoding
+    // against one we acknowledged before)
+    Status status;
+    LinkPlugin::Send(status, PlasmaMove(message), false);
+    if (status.Failed()) // Unable?
+      result = false;
+  }
+  mDeltaAcks.Clear();
+
+  return result;
+}
+bool ReplicatorLink::ReceiveDeltaAcks(const Message& message)
+{
+  Assert(message.GetType() == ReplicatorMessageType::DeltaAck);
+
+  const BitStream& bitStream = message.GetData();
+  uint16 count = 0;
+  if (!bitStream.Read(count)) // Unable?
+    return false;
+
+  for (uint16 i = 0; i < count; ++i)
+  {
+    // Read acknowledgement
+    MessageChannelId channelId;
+    uint16 sequence = 0;
+    if (!bitStream.Read(channelId) || !bitStream.Read(sequence)) // Unable?
+      return false;
+
+    // Find outgoing replica channel (in flipped map)
+    ReplicaChannel* replicaChannel = mOutReplicaChannelsFlipped.FindValue(channelId, nullptr);
+
+    // Get delta baseline
+    DeltaBaseline* deltaBaseline = mDeltaBaselines.FindPointer(replicaChannel);
+    if (!deltaBaseline) // Unable? (Replica channel was closed)
+      continue;
+
+    // They are missing the baseline?
+    if (sequence == 0)
+    {
+      // Clear baseline (Encode against nothing until they store another snapshot)
+      deltaBaseline->mBaselineSequence = 0;
+      deltaBaseline->mBaseline.Clear(false);
+      continue;
+    }
+
+    // Stored snapshot is still kept and newer than the current baseline?
+    const BitStream* snapshot = deltaBaseline->mSentSnapshots.Find(sequence);
+    if (snapshot &&
+        (deltaBaseline->mBaselineSequence == 0 || IsNewerSequence(sequence, deltaBaseline->mBaselineSequence)))
+    {
+      // Use snapshot as the new baseline
+      deltaBaseline->mBaselineSequence = sequence;
+      deltaBaseline->mBaseline = *snapshot;
+    }
+  }
+
+  // Success
+  return true;
+}
+void ReplicatorLink::RemoveSentSnapshots(ReplicaChannel* replicaChannel)
+{
+  // Remove delta baseline (and the snapshots sent with it)
+  mDeltaBaselines.EraseValue(replicaChannel);
+}
+
 bool ReplicatorLink::SendInterrupt(Message& message)
 {
   Assert(GetReplicator()->GetRole() == Role::Server);
@@ -1447,9 +1947,9 @@ MessageChannelId ReplicatorLink::OpenOutgoingReplicaChannel(ReplicaChannel* repl
   MessageChannelId channelId = channel->GetChannelId();
   Assert(channelId != 0);
 
-  // Add outgoing message channel
-  OutReplicaChannels::pointer_bool_pair result = mOutReplicaChannels.Insert(replicaChannel, channelId);
-  if (!result.second) // Unable?
+  // Add outgoing message channel (in regular map)
+  OutReplicaChannels::pointer_bool_pair result1 = mOutReplicaChannels.Insert(replicaChannel, channelId);
+  if (!result1.second) // Unable?
   {
     // Close outgoing message channel
     LinkPlugin::GetLink()->CloseOutgoingChannel(channelId);
@@ -1458,6 +1958,20 @@ MessageChannelId ReplicatorLink::OpenOutgoingReplicaChannel(ReplicaChannel* repl
     return 0;
   }
 
+  // Add outgoing message channel (in flipped map)
+  OutReplicaChannelsFlipped::pointer_bool_pair result2 = mOutReplicaChannelsFlipped.Insert(channelId, replicaChannel);
+  if (!result2.second) // Unable?
+  {
+    // Remove outgoing message channel (in regular map)
+    mOutReplicaChannels.Erase(result1.first);
+
+    // Close outgoing message channel
+    LinkPlugin::GetLink()->CloseOutgoingChannel(channelId);
+
+    Assert(false);
+    return 0;
+  }
+
   // Success
   return channelId;
 }
@@ -1471,8 +1985,14 @@ void ReplicatorLink::CloseOutgoingReplicaChannel(ReplicaChannel* replicaChannel)
   // Close outgoing message channel
   LinkPlugin::GetLink()->CloseOutgoingChannel(iter->second);
 
-  // Remove outgoing message channel
+  // Remove outgoing message channel (in flipped map)
+  mOutReplicaChannelsFlipped.EraseValue(iter->second);
+
+  // Remove outgoing message channel (in regular map)
   mOutReplicaChannels.Erase(iter);
+
+  // Remove sent snapshots (if any)
+  RemoveSentSnapshots(replicaChannel);
 }
 MessageChannelId ReplicatorLink::GetOutgoingReplicaChannel(ReplicaChannel* replicaChannel) const
 {
@@ -1523,6 +2043,10 @@ void ReplicatorLink::ClearIncomingReplicaChannel(ReplicaChannel* replicaChannel)
 
   // Remove incoming message channel (in regular map)
   mInReplicaChannels.EraseValue(channelId);
+
+  // Remove received snapshots and acknowledgements (if any)
+  mReceivedSnapshots.EraseValue(replicaChannel);
+  mDeltaAcks.EraseValue(channelId);
 }
 ReplicaChannel* ReplicatorLink::GetIncomingReplicaChannel(MessageChannelId channelId) const
 {
@@ -1849,6 +2373,14 @@ void ReplicatorLink::OnPluginMessageReceive(MoveReference<Message> message, bool
       ReceiveChange(message);
       break;
 
+    case ReplicatorMessageType::DeltaChange:
+      ReceiveDeltaChange(message);
+      break;
+
+    case ReplicatorMessageType::DeltaAck:
+      ReceiveDeltaAcks(message);
+      break;
+
     case ReplicatorMessageType::ReverseReplicaChannels:
       ReceiveReverseReplicaChannels(message);
       break;
@@ -1900,6 +2432,14 @@ void ReplicatorLink::OnPluginMessageReceive(MoveReference<Message> message, bool
       ReceiveChange(message);
       break;
 
+    case ReplicatorMessageType::DeltaChange:
+      ReceiveDeltaChange(message);
+      break;
+
+    case ReplicatorMessageType::DeltaAck:
+      ReceiveDeltaAcks(message);
+      break;
+
     case ReplicatorMessageType::Interrupt:
       continueProcessingCustomMessages = false;
       break;
@@ -4,6 +4,28 @@
 namespace Plasma
 {
 
+//                                QueuedChange //
+
+/// Queued Change
+/// A replica channel change waiting to be sent to a link in priority order
+struct QueuedChange
+{
+  /// Constructors
+  QueuedChange();
+  QueuedChange(ReplicaChannel* replicaChannel);
+  QueuedChange(ReplicaChannel* replicaChannel, const Message& message);
+
+  /// Data
+  ReplicaChannel* mReplicaChannel; /// Changed replica channel
+  Message mMessage;                /// Change message (unused if sending a full change)
+  float mPriority;                 /// Priority accumulated while waiting to be sent
+  bool mSendFullChange;            /// Send the full replica channel state?
+                                   /// (The link missed earlier changes)
+};
+
+/// Typedefs
+typedef Array<QueuedChange> QueuedChangeArray;
+
 //                               ReplicatorLink //
 
 /// Replicator Link Plugin
@@ -80,6 +102,38 @@ public:
   /// Returns true if change replication should be skipped for this link
   bool ShouldSkipChangeReplication() const;
 
+  //
+  // Interest Management
+  //
+
+  /// Removes all interest observers
+  void ClearInterestObservers();
+  /// Adds an interest observer at the specified position
+  /// Replicas within the replicator's interest radius of any observer are
+  /// relevant to this link (if there are no observers every replica is
+  /// relevant)
+  void AddInterestObserver(const Vector3& position);
+  /// Returns the interest observer positions
+  const Array<Vector3>& GetInterestObservers() const;
+
+  /// Controls how many bytes of changes may be sent to this link each frame
+  /// while interest management is enabled (0 uses the replicator's change
+  /// budget)
+  void SetChangeBudget(Bytes changeBudget = 0);
+  Bytes GetChangeBudget() const;
+
+  /// Returns true if the replica is relevant to this link, else false
+  /// (Updated at the start of every frame while interest management is enabled)
+  bool IsRelevant(Replica* replica) const;
+  /// Returns the replica's priority weight for this link, else 0 if the replica
+  /// is not relevant
+  float GetRelevanceWeight(Replica* replica) const;
+  /// Returns the positioned replicas relevant to this link (sorted by replica)
+  const ReplicaRelevanceArray& GetRelevantReplicas() const;
+
+  /// Returns the number of replica channel changes waiting to be sent
+  uint GetQueuedChangeCount() const;
+
   //
   // Internal
   //
@@ -89,6 +143,22 @@ public:
   /// Called at the end of the operating replicator's update
   void UpdateEnd(TimeMs now);
 
+  /// Finds the replicas relevant to this link using the interest grid
+  /// Replicas which just became relevant have their full state queued, since
+  /// their changes were not sent while they were irrelevant
+  void UpdateRelevance(const InterestGrid& interestGrid, float interestRadius);
+
+  /// Queues a replica channel change to be sent in priority order
+  void QueueChange(ReplicaChannel* replicaChannel, const Message& message);
+  /// Queues the replica channel's full state to be sent in priority order
+  void QueueFullChange(ReplicaChannel* replicaChannel);
+  /// Sends queued changes in priority order until the change budget is used
+  /// Changes which are not sent accumulate priority and are sent as full
+  /// changes on a later frame
+  void SendQueuedChanges(TimeMs timestamp);
+  /// Removes all queued changes of the specified replica
+  void RemoveQueuedChanges(Replica* replica);
+
   //
   // Replica Helpers
   //
@@ -224,6 +294,7 @@ public:
   /// Deserializes a replica channel change
   /// Returns true if successful, else false
   bool DeserializeChange(const Message& message, TimeMs timestamp);
+  bool DeserializeChange(ReplicaChannel* replicaChannel, const BitStream& bitStream, TimeMs timestamp);
   /// Sends a replica channel change
   /// Returns true if successful, else false
   bool SendChange(ReplicaChannel* replicaChannel, Message& message);
@@ -231,6 +302,23 @@ public:
   /// Returns true if successful, else false
   bool ReceiveChange(const Message& message);
 
+  /// Sends a replica channel snapshot (a full change) delta encoded against the
+  /// last snapshot they acknowledged
+  /// Returns true if successful, else false
+  bool SendDeltaChange(ReplicaChannel* replicaChannel, const Message& message, MessageChannelId channelId);
+  /// Receives a delta encoded replica channel snapshot
+  /// Returns true if successful, else false
+  bool ReceiveDeltaChange(const Message& message);
+  /// Sends the sequences of the delta encoded snapshots stored this update
+  /// Returns true if successful, else false
+  bool SendDeltaAcks();
+  /// Receives the sequences of the delta encoded snapshots they stored, which
+  /// can become baselines
+  /// Returns true if successful, else false
+  bool ReceiveDeltaAcks(const Message& message);
+  /// Removes the snapshots sent to them for the specified replica channel
+  void RemoveSentSnapshots(ReplicaChannel* replicaChannel);
+
   /// [Server] Sends an interrupt command
   /// Returns true if successful, else false
   bool SendInterrupt(Message& message);
@@ -321,6 +409,8 @@ public:
   MessageChannelId mCommandChannelId;                 /// Command channel ID
   OutReplicaChannels mOutReplicaChannels;             /// Outgoing replica channel map (replica channel to
                                                       /// message channel ID)
+  OutReplicaChannelsFlipped mOutReplicaChannelsFlipped; /// Outgoing replica channel map flipped
+                                                        /// (message channel ID to replica channel)
   InReplicaChannels mInReplicaChannels;               /// Incoming replica channel map (message channel ID
                                                       /// to replica channel)
   InReplicaChannelsFlipped mInReplicaChannelsFlipped; /// Incoming replica channel map flipped
@@ -333,6 +423,16 @@ public:
                                                       /// notification time
   TimeMs mLastFrameFillWarningNotificationTime;       /// Last frame fill warning
                                                       /// notification time
+  Array<Vector3> mInterestObservers;                  /// Interest observer positions
+  Bytes mChangeBudget;                                /// Change bytes per frame (0 uses the replicator's)
+  bool mRelevanceFiltered;                            /// Were replicas filtered by relevance last update?
+  ReplicaRelevanceArray mRelevantReplicas;            /// Relevant replicas (sorted by replica)
+  ReplicaRelevanceArray mPreviousRelevantReplicas;    /// Relevant replicas from the previous update
+  QueuedChangeArray mQueuedChanges;                   /// Changes waiting to be sent
+  DeltaBaselineMap mDeltaBaselines;                   /// Acknowledged snapshots (outgoing replica channel to baseline)
+  ReceivedSnapshotsMap mReceivedSnapshots;            /// Recently received snapshots (incoming replica channel to
+                                                      /// snapshots)
+  DeltaAckMap mDeltaAcks;                             /// Snapshot sequences to acknowledge at the end of the update
 
 private:
   /// No copy constructor
@@ -0,0 +1,164 @@
+// MIT Licensed (see LICENSE.md).
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+// Snapshots are compared a word at a time
+static const Bits cDeltaWordBits = 32;
+
+// Returns the number of words needed to hold the specified number of bits
+static uint GetDeltaWordCount(Bits bits)
+{
+  return uint((BITS_TO_BYTES(bits) + 3) / 4);
+}
+
+// Returns the word at the specified index (bytes past the end are zero)
+static uint32 GetDeltaWord(const BitStream& bitStream, uint index)
+{
+  const byte* data = bitStream.GetData();
+  Bytes byteCount = BITS_TO_BYTES(bitStream.GetBitsWritten());
+
+  uint32 word = 0;
+  for (Bytes i = index * 4; i < index * 4 + 4; ++i)
+  {
+    word <<= 8;
+    if (i < byteCount)
+      word |= data[i];
+  }
+  return word;
+}
+
+//                               Snapshot Delta //
+
+Bits WriteSnapshotDelta(BitStream& bitStream, const BitStream& baseline, const BitStream& snapshot)
+{
+  Bits bitsWrittenStart = bitStream.GetBitsWritten();
+
+  // Write snapshot size (a replica channel's snapshots are usually the same
+  // size)
+  Bits snapshotBits = snapshot.GetBitsWritten();
+  bool sameSize = (snapshotBits == baseline.GetBitsWritten());
+  bitStream.Write(sameSize);
+  if (!sameSize)
+    bitStream.Write(uint32(snapshotBits));
+
+  // For all snapshot words
+  uint wordCount = GetDeltaWordCount(snapshotBits);
+  for (uint i = 0; i < wordCount; ++i)
+  {
+    // Write 'Has Changed?' Flag
+    uint32 delta = GetDeltaWord(snapshot, i) ^ GetDeltaWord(baseline, i);
+    bitStream.Write(delta != 0);
+    if (delta == 0) // Unchanged?
+      continue;
+
+    // Only write the bits between the first and last differing bit
+    // (Small changes to a value only differ in its lowest bits)
+    uint leadingZeros = 0;
+    while (!(delta & (uint32(1) << (cDeltaWordBits - 1 - leadingZeros))))
+      ++leadingZeros;
+    uint trailingZeros = 0;
+    while (!(delta & (uint32(1) << trailingZeros)))
+      ++trailingZeros;
+    uint significantBits = cDeltaWordBits - leadingZeros - trailingZeros;
+
+    bitStream.WriteQuantized(leadingZeros, uint(0), uint(cDeltaWordBits - 1));
+    bitStream.WriteQuantized(significantBits, uint(1), uint(cDeltaWordBits));
+    uint32 significantMax = uint32(0xFFFFFFFF) >> (cDeltaWordBits - significantBits);
+    bitStream.WriteQuantized(delta >> trailingZeros, uint32(0), significantMax);
+  }
+
+  return bitStream.GetBitsWritten() - bitsWrittenStart;
+}
+
+bool ReadSnapshotDelta(const BitStream& bitStream, const BitStream& baseline, BitStream& snapshot)
+{
+  // Read snapshot size
+  bool sameSize;
+  if (!bitStream.Read(sameSize)) // Unable?
+    return false;
+  uint32 snapshotBits = uint32(baseline.GetBitsWritten());
+  if (!sameSize && !bitStream.Read(snapshotBits)) // Unable?
+    return false;
+
+  // Reserve snapshot bytes
+  Bytes byteCount = BITS_TO_BYTES(snapshotBits);
+  snapshot.Clear(false);
+  snapshot.Reserve(byteCount);
+
+  // For all snapshot words
+  uint wordCount = GetDeltaWordCount(snapshotBits);
+  for (uint i = 0; i < wordCount; ++i)
+  {
+    // Read 'Has Changed?' Flag
+    bool hasChanged;
+    if (!bitStream.Read(hasChanged)) // Unable?
+      return false;
+
+    uint32 delta = 0;
+    if (hasChanged) // Has changed?
+    {
+      // Read the bits between the first and last differing bit
+      uint leadingZeros;
+      uint significantBits;
+      if (!bitStream.ReadQuantized(leadingZeros, uint(0), uint(cDeltaWordBits - 1)) ||
+          !bitStream.ReadQuantized(significantBits, uint(1), uint(cDeltaWordBits)) ||
+          leadingZeros + significantBits > cDeltaWordBits) // Unable?
+        return false;
+      uint32 significantMax = uint32(0xFFFFFFFF) >> (cDeltaWordBits - significantBits);
+      if (!bitStream.ReadQuantized(delta, uint32(0), significantMax)) // Unable?
+        return false;
+
+      delta <<= (cDeltaWordBits - leadingZeros - significantBits);
+    }
+
+    // Write the word's bytes
+    uint32 word = GetDeltaWord(baseline, i) ^ delta;
+    for (Bytes j = 0; j < 4 && i * 4 + j < byteCount; ++j)
+      snapshot.WriteByte(uint8(word >> (24 - j * 8)));
+  }
+
+  // Trim the last byte's unused bits
+  snapshot.SetBitsWritten(snapshotBits);
+  return true;
+}
+
+bool IsNewerSequence(uint16 sequence, uint16 otherSequence)
+{
+  return int16(sequence - otherSequence) > 0;
+}
+
+//                               SnapshotWindow //
+
+SnapshotWindow::SnapshotWindow()
+{
+  for (uint i = 0; i < cSnapshotWindow; ++i)
+    mSequences[i] = 0;
+}
+
+void SnapshotWindow::Add(uint16 sequence, const BitStream& snapshot)
+{
+  Assert(sequence != 0);
+
+  uint index = sequence % cSnapshotWindow;
+  mSequences[index] = sequence;
+  mSnapshots[index] = snapshot;
+}
+
+const BitStream* SnapshotWindow::Find(uint16 sequence) const
+{
+  uint index = sequence % cSnapshotWindow;
+  if (sequence == 0 || mSequences[index] != sequence) // Not kept?
+    return nullptr;
+
+  return &mSnapshots[index];
+}
+
+//                                DeltaBaseline //
+
+DeltaBaseline::DeltaBaseline() : mNextSequence(1), mBaselineSequence(0), mBaseline(), mSentSnapshots()
+{
+}
+
+} // namespace Plasma
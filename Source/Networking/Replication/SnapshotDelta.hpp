@@ -0,0 +1,83 @@
+// MIT Licensed (see LICENSE.md).
+#pragma once
+
+namespace Plasma
+{
+
+//                               Snapshot Delta //
+
+/// Number of recently received snapshots kept for each replica channel
+/// (Snapshots are only delta encoded against an acknowledged baseline this
+/// recent, older baselines are no longer kept by the receiver)
+static const uint16 cSnapshotWindow = 16;
+
+/// Most snapshot acknowledgements written to one delta ack message
+/// (More are split across several messages, keeping each one within a packet)
+static const uint cMaxDeltaAcksPerMessage = 256;
+
+/// Writes the snapshot as a bit-packed XOR against the baseline
+/// Every 32-bit word that matches the baseline costs a single bit, other words
+/// only write the bits between their first and last differing bit
+/// Returns the number of bits written
+Bits WriteSnapshotDelta(BitStream& bitStream, const BitStream& baseline, const BitStream& snapshot);
+/// Reads a snapshot delta written against the baseline into the snapshot
+/// Returns true if successful, else false
+bool ReadSnapshotDelta(const BitStream& bitStream, const BitStream& baseline, BitStream& snapshot);
+
+/// Returns true if the sequence is newer than the other sequence, else false
+/// (Wrap aware)
+bool IsNewerSequence(uint16 sequence, uint16 otherSequence);
+
+//                               SnapshotWindow //
+
+/// Snapshot Window
+/// The recent snapshots of a replica channel. The receiver keeps the snapshots
+/// it stored so the sender may encode following snapshots against them, the
+/// sender keeps the snapshots it sent until the receiver acknowledges one
+struct SnapshotWindow
+{
+  /// Constructor
+  SnapshotWindow();
+
+  /// Stores the snapshot
+  void Add(uint16 sequence, const BitStream& snapshot);
+  /// Returns the snapshot with the specified sequence, else nullptr if it is no
+  /// longer kept
+  const BitStream* Find(uint16 sequence) const;
+
+  /// Data
+  uint16 mSequences[cSnapshotWindow];    /// Snapshot sequences (0 if empty)
+  BitStream mSnapshots[cSnapshotWindow]; /// Snapshots (indexed by sequence)
+};
+
+/// Typedefs
+typedef ArrayMap<ReplicaChannel*, SnapshotWindow> ReceivedSnapshotsMap;
+
+//                                DeltaBaseline //
+
+/// Delta Baseline
+/// The last replica channel snapshot acknowledged by a link, which following
+/// snapshots sent to that link are encoded against
+struct DeltaBaseline
+{
+  /// Constructor
+  DeltaBaseline();
+
+  /// Data
+  uint16 mNextSequence;          /// Sequence of the next snapshot sent (never 0)
+  uint16 mBaselineSequence;      /// Sequence of the acknowledged baseline (0 if none)
+  BitStream mBaseline;           /// Acknowledged baseline snapshot
+  SnapshotWindow mSentSnapshots; /// Recently sent snapshots (one may become the baseline)
+};
+
+/// Typedefs
+typedef ArrayMap<ReplicaChannel*, DeltaBaseline> DeltaBaselineMap;
+
+//                                  DeltaAck //
+
+/// Snapshots to acknowledge at the end of the update, the newest stored
+/// sequence of each incoming message channel (0 if the baseline was missing)
+/// (Transport receipts only say the message arrived, not that it was stored)
+typedef ArrayMap<MessageChannelId, uint16> DeltaAckMap;
+
+} // namespace Plasma
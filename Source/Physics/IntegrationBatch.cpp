@@ -0,0 +1,220 @@
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+namespace Physics
+{
+
+void IntegrationBatch::Clear()
+{
+  mBodies.Clear();
+}
+
+void IntegrationBatch::Add(RigidBody* body)
+{
+  ErrorIf(body->GetStatic() || body->GetKinematic(), "Only dynamic bodies can be integrated.");
+  mBodies.PushBack(body);
+}
+
+uint IntegrationBatch::GetBodyCount() const
+{
+  return mBodies.Size();
+}
+
+void IntegrationBatch::ResizeState(uint componentCount, Array<real>* components)
+{
+  uint bodyCount = mBodies.Size();
+  uint paddedCount = (bodyCount + 3) & ~3u;
+  for(uint i = 0; i < componentCount; ++i)
+  {
+    components[i].Resize(paddedCount);
+    for(uint lane = bodyCount; lane < paddedCount; ++lane)
+      components[i][lane] = real(0.0);
+  }
+}
+
+#if defined(USESSE)
+
+void IntegrationBatch::IntegrateVelocity(real dt, real maxVelocity)
+{
+  using namespace Math::Simd;
+
+  uint bodyCount = mBodies.Size();
+  ResizeState(3, mVelocity);
+  ResizeState(3, mAngularVelocity);
+  ResizeState(3, mInvMass);
+  ResizeState(3, mForce);
+  ResizeState(3, mTorque);
+  ResizeState(9, mInvInertia);
+  ResizeState(3, mGyroscopic);
+
+  // Gather
+  for(uint i = 0; i < bodyCount; ++i)
+  {
+    RigidBody* body = mBodies[i];
+    // Same as Integration::IntegrateVelocity, 2d bodies can't move out of the plane
+    if(body->mState.IsSet(RigidBodyStates::Mode2D))
+    {
+      body->mVelocity.z = real(0.0);
+      body->mAngularVelocity.x = real(0.0);
+      body->mAngularVelocity.y = real(0.0);
+    }
+
+    Vec3 invMass = body->mInvMass.GetInvMasses();
+    Mat3 invInertia = body->mInvInertia.GetInvWorldTensor();
+    // The gyroscopic term needs a 3x3 solve per body so it isn't worth spreading across lanes
+    Vec3 gyroscopic = SolveGyroscopic(body, dt);
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      mVelocity[axis][i] = body->mVelocity[axis];
+      mAngularVelocity[axis][i] = body->mAngularVelocity[axis];
+      mInvMass[axis][i] = invMass[axis];
+      mForce[axis][i] = body->mForceAccumulator[axis];
+      mTorque[axis][i] = body->mTorqueAccumulator[axis];
+      mGyroscopic[axis][i] = gyroscopic[axis];
+      for(uint column = 0; column < 3; ++column)
+        mInvInertia[axis * 3 + column][i] = invInertia(axis, column);
+    }
+  }
+
+  // Integrate
+  SimVec dtVec = Set(dt);
+  SimVec maxVec = Set(maxVelocity);
+  SimVec minVec = Set(-maxVelocity);
+  uint paddedCount = mVelocity[0].Size();
+  for(uint i = 0; i < paddedCount; i += 4)
+  {
+    // v += invMass * F * dt
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      SimVec acceleration = UnAlignedLoad(&mForce[axis][i]) * UnAlignedLoad(&mInvMass[axis][i]);
+      SimVec velocity = MultiplyAdd(acceleration, dtVec, UnAlignedLoad(&mVelocity[axis][i]));
+      UnAlignedStore(Clamp(velocity, minVec, maxVec), &mVelocity[axis][i]);
+    }
+
+    // w += invInertia * T * dt + gyroscopic
+    SimVec torqueX = UnAlignedLoad(&mTorque[0][i]);
+    SimVec torqueY = UnAlignedLoad(&mTorque[1][i]);
+    SimVec torqueZ = UnAlignedLoad(&mTorque[2][i]);
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      SimVec explicitW = UnAlignedLoad(&mInvInertia[axis * 3 + 0][i]) * torqueX;
+      explicitW = MultiplyAdd(UnAlignedLoad(&mInvInertia[axis * 3 + 1][i]), torqueY, explicitW);
+      explicitW = MultiplyAdd(UnAlignedLoad(&mInvInertia[axis * 3 + 2][i]), torqueZ, explicitW);
+      SimVec deltaW = MultiplyAdd(explicitW, dtVec, UnAlignedLoad(&mGyroscopic[axis][i]));
+      SimVec angularVelocity = UnAlignedLoad(&mAngularVelocity[axis][i]) + deltaW;
+      UnAlignedStore(Clamp(angularVelocity, minVec, maxVec), &mAngularVelocity[axis][i]);
+    }
+  }
+
+  // Scatter
+  for(uint i = 0; i < bodyCount; ++i)
+  {
+    RigidBody* body = mBodies[i];
+    body->mVelocityOld = body->mVelocity;
+    body->mAngularVelocityOld = body->mAngularVelocity;
+    body->mVelocity.Set(mVelocity[0][i], mVelocity[1][i], mVelocity[2][i]);
+    body->mAngularVelocity.Set(mAngularVelocity[0][i], mAngularVelocity[1][i], mAngularVelocity[2][i]);
+    body->mForceAccumulator.ZeroOut();
+    body->mTorqueAccumulator.ZeroOut();
+  }
+}
+
+void IntegrationBatch::IntegratePosition(real dt)
+{
+  using namespace Math::Simd;
+
+  uint bodyCount = mBodies.Size();
+  ResizeState(3, mVelocity);
+  ResizeState(3, mAngularVelocity);
+  ResizeState(3, mInvMass);
+  ResizeState(3, mForce);
+  ResizeState(4, mRotation);
+
+  // Gather
+  for(uint i = 0; i < bodyCount; ++i)
+  {
+    RigidBody* body = mBodies[i];
+    Vec3 invMass = body->mInvMass.GetInvMasses();
+    Quat rotation = body->GetWorldRotationQuat();
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      mVelocity[axis][i] = body->mVelocity[axis];
+      mAngularVelocity[axis][i] = body->mAngularVelocity[axis];
+      mInvMass[axis][i] = invMass[axis];
+      mForce[axis][i] = body->mForceAccumulator[axis];
+    }
+    mRotation[0][i] = rotation.x;
+    mRotation[1][i] = rotation.y;
+    mRotation[2][i] = rotation.z;
+    mRotation[3][i] = rotation.w;
+  }
+
+  // Integrate, the results are the offsets to apply (written over the velocity and rotation)
+  SimVec dtVec = Set(dt);
+  SimVec halfDtVec = Set(dt * real(.5));
+  SimVec halfVec = Set(real(0.5));
+  uint paddedCount = mVelocity[0].Size();
+  for(uint i = 0; i < paddedCount; i += 4)
+  {
+    // offset = (v + invMass * F * dt / 2) * dt
+    for(uint axis = 0; axis < 3; ++axis)
+    {
+      SimVec acceleration = UnAlignedLoad(&mForce[axis][i]) * UnAlignedLoad(&mInvMass[axis][i]);
+      SimVec velocity = MultiplyAdd(acceleration, halfDtVec, UnAlignedLoad(&mVelocity[axis][i]));
+      UnAlignedStore(velocity * dtVec, &mVelocity[axis][i]);
+    }
+
+    // offset = (Quat(w, 0) * rotation) * 0.5 * dt
+    SimVec wX = UnAlignedLoad(&mAngularVelocity[0][i]);
+    SimVec wY = UnAlignedLoad(&mAngularVelocity[1][i]);
+    SimVec wZ = UnAlignedLoad(&mAngularVelocity[2][i]);
+    SimVec qX = UnAlignedLoad(&mRotation[0][i]);
+    SimVec qY = UnAlignedLoad(&mRotation[1][i]);
+    SimVec qZ = UnAlignedLoad(&mRotation[2][i]);
+    SimVec qW = UnAlignedLoad(&mRotation[3][i]);
+    SimVec x = wX * qW + wY * qZ - wZ * qY;
+    SimVec y = wY * qW + wZ * qX - wX * qZ;
+    SimVec z = wZ * qW + wX * qY - wY * qX;
+    SimVec w = Negate(wX * qX) - wY * qY - wZ * qZ;
+    UnAlignedStore(x * halfVec * dtVec, &mRotation[0][i]);
+    UnAlignedStore(y * halfVec * dtVec, &mRotation[1][i]);
+    UnAlignedStore(z * halfVec * dtVec, &mRotation[2][i]);
+    UnAlignedStore(w * halfVec * dtVec, &mRotation[3][i]);
+  }
+
+  // Scatter through the body so the cached transform and colliders are updated
+  for(uint i = 0; i < bodyCount; ++i)
+  {
+    RigidBody* body = mBodies[i];
+    body->UpdateCenterMass(Vec3(mVelocity[0][i], mVelocity[1][i], mVelocity[2][i]));
+    body->UpdateOrientation(Quat(mRotation[0][i], mRotation[1][i], mRotation[2][i], mRotation[3][i]));
+    body->GenerateIntegrationUpdate();
+  }
+}
+
+#else
+
+void IntegrationBatch::IntegrateVelocity(real dt, real maxVelocity)
+{
+  for(uint i = 0; i < mBodies.Size(); ++i)
+  {
+    RigidBody* body = mBodies[i];
+    Integration::IntegrateVelocity(body, dt);
+    body->mForceAccumulator.ZeroOut();
+    body->mTorqueAccumulator.ZeroOut();
+  }
+}
+
+void IntegrationBatch::IntegratePosition(real dt)
+{
+  for(uint i = 0; i < mBodies.Size(); ++i)
+    Integration::IntegratePosition(mBodies[i], dt);
+}
+
+#endif
+
+}//namespace Physics
+
+}//namespace Plasma
@@ -0,0 +1,50 @@
+#pragma once
+
+namespace Plasma
+{
+
+class RigidBody;
+
+namespace Physics
+{
+
+///Integrates a batch of dynamic rigid bodies four at a time. The bodies' state
+///is copied into structure of arrays form (one array per component) so that
+///each lane of a simd vector holds a different body, integrated, and then
+///written back to the bodies once. The math is the same as Integration's and
+///falls back to it when the simd library isn't available.
+class IntegrationBatch
+{
+public:
+  void Clear();
+  ///The body must not be static or kinematic.
+  void Add(RigidBody* body);
+  uint GetBodyCount() const;
+
+  ///Integrates force to velocity for all bodies and clears their force and torque.
+  void IntegrateVelocity(real dt, real maxVelocity);
+  ///Integrates velocity to position for all bodies.
+  void IntegratePosition(real dt);
+
+private:
+  ///Resizes the state arrays for the current bodies, padded to a multiple of 4.
+  void ResizeState(uint componentCount, Array<real>* components);
+
+  Array<RigidBody*> mBodies;
+
+  //The state of every body, one array per component. Padding lanes are zero.
+  Array<real> mVelocity[3];
+  Array<real> mAngularVelocity[3];
+  Array<real> mInvMass[3];
+  Array<real> mForce[3];
+  Array<real> mTorque[3];
+  //Row major world space inverse inertia tensor.
+  Array<real> mInvInertia[9];
+  //The gyroscopic change in angular velocity (computed per body, see SolveGyroscopic).
+  Array<real> mGyroscopic[3];
+  Array<real> mRotation[4];
+};
+
+}//namespace Physics
+
+}//namespace Plasma
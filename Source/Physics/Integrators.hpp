@@ -10,6 +10,9 @@ namespace Physics
 
 DeclareEnum4(IntegrationMethods, Euler, Verlet, Rk2, Rk4);
 
+///Returns the change in angular velocity from the gyroscopic torque over the timestep.
+Vec3 SolveGyroscopic(RigidBody* body, float dt);
+
 //Integration is put in a struct so that it is easier to friend these functions
 struct Integration
 {
@@ -166,6 +166,14 @@ void Island::Solve(real dt, bool allowSleeping, uint debugFlags)
   UpdateSleep(dt, allowSleeping, debugFlags);
 }
 
+void Island::SolveConstraints(real dt)
+{
+  mSolver->UpdateData();
+  mSolver->WarmStart();
+  mSolver->SolveVelocities();
+  mSolver->Commit();
+}
+
 void Island::SolvePositions(real dt)
 {
   mSolver->SolvePositions();
@@ -34,6 +34,9 @@ public:
   void IntegratePosition(real dt);
   void CommitConstraints();
   void Solve(real dt, bool allowSleeping, uint debugFlags);
+  ///Solves the constraints without sending any events or changing sleep state.
+  ///Islands share no bodies so this is safe to run on a worker thread.
+  void SolveConstraints(real dt);
   void SolvePositions(real dt);
   void UpdateSleep(real dt, bool allowSleeping, uint debugFlags);
   ///Helper function to mark everything as not on an island.
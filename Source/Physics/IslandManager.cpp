@@ -387,12 +387,72 @@ void IslandManager::Solve(real dt, bool allowSleeping, uint debugFlags)
     return;
   }
 
+  JobSystem* jobSystem = PL::gJobs;
+  if(mPhysicsSolverConfig->mSolveIslandsInParallel && jobSystem != nullptr &&
+     jobSystem->GetWorkerCount() > 0 && mIslandCount > 1)
+  {
+    SolveParallel(jobSystem, dt, allowSleeping, debugFlags);
+    return;
+  }
+
   //solve all of the islands.
   IslandList::range islandRange = mIslands.All();
   for(; !islandRange.Empty(); islandRange.PopFront())
     islandRange.Front().Solve(dt, allowSleeping, debugFlags);
 }
 
+/// Sorts islands so the most expensive ones get started first (better load balancing).
+struct IslandCostSorter
+{
+  bool operator()(const Island* lhs, const Island* rhs) const
+  {
+    return (lhs->ContactCount + lhs->JointCount) > (rhs->ContactCount + rhs->JointCount);
+  }
+};
+
+struct IslandSolveTask
+{
+  void operator()(uint index)
+  {
+    (*mIslands)[index]->SolveConstraints(mDt);
+  }
+
+  Array<Island*>* mIslands;
+  real mDt;
+};
+
+void IslandManager::SolveParallel(JobSystem* jobSystem, real dt, bool allowSleeping, uint debugFlags)
+{
+  // Committing the constraints updates their atoms which can dispatch script
+  // events (e.g. CustomJoint), so this has to happen on the calling thread.
+  mParallelIslands.Clear();
+  IslandList::range islandRange = mIslands.All();
+  for(; !islandRange.Empty(); islandRange.PopFront())
+  {
+    Island& island = islandRange.Front();
+    island.CommitConstraints();
+    mParallelIslands.PushBack(&island);
+  }
+
+  // The order islands are solved in doesn't change the results since they share no bodies
+  Sort(mParallelIslands.All(), IslandCostSorter());
+
+  IslandSolveTask task;
+  task.mIslands = &mParallelIslands;
+  task.mDt = dt;
+  jobSystem->ParallelFor(mParallelIslands.Size(), task);
+
+  // Joint events and sleeping go through the space's shared managers. Walk the islands in
+  // their original order so events are queued exactly as the serial solve would queue them.
+  islandRange = mIslands.All();
+  for(; !islandRange.Empty(); islandRange.PopFront())
+  {
+    Island& island = islandRange.Front();
+    island.mSolver->BatchEvents();
+    island.UpdateSleep(dt, allowSleeping, debugFlags);
+  }
+}
+
 void IslandManager::SolvePositions(real dt)
 {
   IslandList::range islandRange = mIslands.All();
@@ -553,6 +613,7 @@ IConstraintSolver* IslandManager::GetNewSolver()
   if(mPhysicsSolverConfig != nullptr)
     solver->SetConfiguration(mPhysicsSolverConfig);
   solver->SetHeap(mSpace->mHeap);
+  solver->SetJobSystem(PL::gJobs);
 
   return solver;
 }
@@ -29,6 +29,9 @@ public:
   void BuildIslands(ColliderList& colliders);
   void PostProcessIslands();
   void Solve(real dt, bool allowSleeping, uint debugFlags);
+  /// Solves each island's constraints on the job system. Anything that touches
+  /// shared state (script events, joint events, sleeping) stays on the calling thread.
+  void SolveParallel(JobSystem* jobSystem, real dt, bool allowSleeping, uint debugFlags);
   void SolvePositions(real dt);
   void Draw(uint flags);
 
@@ -59,6 +62,8 @@ public:
   PhysicsSolverConfig* mPhysicsSolverConfig;
 
   PhysicsSpace* mSpace;
+  /// Scratch list of islands to hand out to worker threads (kept to avoid per-frame allocations).
+  Array<Island*> mParallelIslands;
   bool mShareSolver;
   IConstraintSolver* mSharedSolver;
 };
@@ -1,8 +1,8 @@
 #pragma once
 
-#include "Math/SimMath.hpp"
-#include "Math/SimVectors.hpp"
-#include "Math/SimMatrix3.hpp"
+#include "Core/Common/SimMath.hpp"
+#include "Core/Common/SimVectors.hpp"
+#include "Core/Common/SimMatrix3.hpp"
 
 namespace Plasma
 {
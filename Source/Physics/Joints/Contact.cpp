@@ -2,8 +2,8 @@
 
 #ifdef USESSE
 #include "ConstraintFragmentsSse.hpp"
-#include "Math/SimVectors.hpp"
-#include "Math/SimMatrix3.hpp"
+#include "Core/Common/SimVectors.hpp"
+#include "Core/Common/SimMatrix3.hpp"
 #endif
 //////////////////////////////////////////////////////////////////////////
 ///C: dot(p2 - p1,n) = 0
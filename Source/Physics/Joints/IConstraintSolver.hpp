@@ -23,7 +23,7 @@ public:
   typedef InList<Contact,&Contact::SolverLink> ContactList;
   typedef InList<Joint,&Joint::SolverLink> JointList;
 
-  IConstraintSolver() { mHeap = nullptr; };
+  IConstraintSolver() { mHeap = nullptr; mJobSystem = nullptr; };
   virtual ~IConstraintSolver() {};
 
   void SetConfiguration(PhysicsSolverConfig* config) 
@@ -36,6 +36,12 @@ public:
     mHeap = heap;
   }
 
+  /// The job system used by solvers that can split up their work (may be null).
+  void SetJobSystem(JobSystem* jobSystem)
+  {
+    mJobSystem = jobSystem;
+  }
+
   ///Add functions for joints
   virtual void AddJoint(Joint* joint) {}
   virtual void AddContact(Contact* contact) {}
@@ -66,6 +72,7 @@ public:
 
   PhysicsSolverConfig* mSolverConfig;
   Memory::Heap* mHeap;
+  JobSystem* mJobSystem;
 };
 
 }//namespace Physics
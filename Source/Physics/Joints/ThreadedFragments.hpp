@@ -9,9 +9,11 @@ namespace Physics
 template <typename JointType>
 struct ConstraintBatch
 {
-  ConstraintBatch() { ConstraintCount = 0; }
+  ConstraintBatch() { ConstraintCount = 0; MoleculeOffset = 0; }
   ~ConstraintBatch() { Joints.Clear(); }
   uint ConstraintCount;
+  /// Where this batch's molecules start in the solver's molecule buffer.
+  uint MoleculeOffset;
   typedef InList<JointType,&JointType::SolverLink> JointList;
   JointList Joints;
 
@@ -28,6 +30,8 @@ struct ConstraintPhase
   typedef ConstraintBatch<JointType> JointBatch;
   typedef InList<JointBatch> JointBatches;
   JointBatches Batches;
+  /// Random access to the batches so they can be handed out to worker threads.
+  Array<JointBatch*> BatchArray;
 
   IntrusiveLink(ConstraintPhase<JointType>,link);
 };
@@ -101,15 +105,96 @@ void GroupOperationTwoParamFragment(ConstraintGroup<typename ListType::value_typ
   }
 }
 
+/// Runs an operation on every batch of every phase. Batches within a phase share no
+/// bodies so they are run across the job system's workers, with a barrier between each phase.
+/// The operation is called as operation(batchJoints, moleculeWalker) where the walker
+/// has already been offset to the start of that batch's molecules.
+template <typename ListType, typename Functor>
+void ParallelGroupOperationFragment(JobSystem* jobSystem, ConstraintGroup<typename ListType::value_type>& group,
+                                    MoleculeWalker& molecules, Functor& operation)
+{
+  typedef ConstraintGroup<typename ListType::value_type> JointGroup;
+  typedef ConstraintPhase<typename ListType::value_type> JointPhase;
+
+  struct BatchTask
+  {
+    void operator()(uint index)
+    {
+      ConstraintBatch<typename ListType::value_type>* batch = (*mBatches)[index];
+      MoleculeWalker batchMolecules = mMolecules;
+      batchMolecules += batch->MoleculeOffset;
+      (*mOperation)(batch->Joints, batchMolecules);
+    }
+
+    Array<ConstraintBatch<typename ListType::value_type>*>* mBatches;
+    MoleculeWalker mMolecules;
+    Functor* mOperation;
+  };
+
+  BatchTask task;
+  task.mMolecules = molecules;
+  task.mOperation = &operation;
+
+  typename JointGroup::PhaseTypeList::range phaseRange = group.Phases.All();
+  for(; !phaseRange.Empty(); phaseRange.PopFront())
+  {
+    JointPhase& phase = phaseRange.Front();
+    task.mBatches = &phase.BatchArray;
+    if(jobSystem != nullptr)
+      jobSystem->ParallelFor(phase.BatchArray.Size(), task);
+    else
+    {
+      for(uint i = 0; i < phase.BatchArray.Size(); ++i)
+        task(i);
+    }
+  }
+}
+
+/// Fills out each phase's batch array and assigns every batch its starting molecule
+/// (in the same order the serial walk would visit them). Returns the next free molecule index.
+template <typename JointType>
+uint ComputeBatchOffsets(ConstraintGroup<JointType>& group, uint moleculeOffset)
+{
+  typedef ConstraintGroup<JointType> JointGroup;
+  typedef ConstraintPhase<JointType> JointPhase;
+
+  typename JointGroup::PhaseTypeList::range phaseRange = group.Phases.All();
+  for(; !phaseRange.Empty(); phaseRange.PopFront())
+  {
+    JointPhase& phase = phaseRange.Front();
+    phase.BatchArray.Clear();
+    phase.BatchArray.Reserve(phase.BatchCount);
+
+    typename JointPhase::JointBatches::range range = phase.Batches.All();
+    for(; !range.Empty(); range.PopFront())
+    {
+      typename JointPhase::JointBatch& batch = range.Front();
+      batch.MoleculeOffset = moleculeOffset;
+      moleculeOffset += batch.ConstraintCount;
+      phase.BatchArray.PushBack(&batch);
+    }
+  }
+  return moleculeOffset;
+}
+
+/// The body a constraint writes velocities to (null for static objects which are never written).
+template <typename JointType>
+RigidBody* GetSolverBody(JointType* joint, uint index)
+{
+  return joint->GetCollider(index)->GetActiveBody();
+}
+
 template <typename ListType>
-void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value_type>& phases)
+void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value_type>& phases, uint batchesPerPhase = 2)
 {
   typedef ConstraintPhase<typename ListType::value_type> PhaseType;
   typedef ConstraintBatch<typename ListType::value_type> BatchType;
 
-  HashSet<uint> bodySet;
+  // Bodies are keyed by the active rigid body (not the collider) since multiple colliders
+  // on one composite body all write to the same velocity. Static objects have no body
+  // that gets written so they never force constraints into separate phases.
+  HashSet<RigidBody*> bodySet;
   uint batchSize = 32;
-  uint batchesPerPhase = 2;
 
   PhaseType* phase = nullptr;
   BatchType* batch = nullptr;
@@ -136,12 +221,13 @@ void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value
       typename ListType::pointer joint = &(range.Front());
       range.PopFront();
 
-      //get the id of the two bodies involved in this joint
-      uint idA = joint->GetCollider(0)->mId;
-      uint idB = joint->GetCollider(1)->mId;
+      //get the two bodies involved in this joint
+      RigidBody* bodyA = GetSolverBody(joint, 0);
+      RigidBody* bodyB = GetSolverBody(joint, 1);
 
       //if either of the bodies have been used in this phase, then skip this joint
-      if(!bodySet.Find(idA).Empty() || !bodySet.Find(idB).Empty())
+      if((bodyA != nullptr && !bodySet.Find(bodyA).Empty()) ||
+         (bodyB != nullptr && !bodySet.Find(bodyB).Empty()))
         continue;
 
       //if adding this joint would make the batch too large, make a new batch and add the old to the phase
@@ -165,8 +251,10 @@ void SplitConstraints(ListType& joints, ConstraintGroup<typename ListType::value
       }
 
       //mark both of these bodies as being used for this phase
-      bodySet.Insert(idA);
-      bodySet.Insert(idB);
+      if(bodyA != nullptr)
+        bodySet.Insert(bodyA);
+      if(bodyB != nullptr)
+        bodySet.Insert(bodyB);
 
       //put the joint in this batch
       ListType::Unlink(joint);
@@ -23,14 +23,17 @@ namespace Plasma
 namespace Physics
 {
 
-template <typename JointList>
-void ThreadSolveFunction(JointList& joints, MoleculeWalker molecules, uint startIndex)
+/// Binds the iteration count so velocity iteration matches the other batch operations.
+template <typename ListType>
+struct IterateVelocitiesBatchOperation
 {
-  MoleculeWalker mols = molecules;
-  mols += startIndex;
+  void operator()(ListType& joints, MoleculeWalker& molecules)
+  {
+    IterateVelocitiesFragmentList<ListType>(joints, molecules, mIteration);
+  }
 
-  IterateVelocitiesFragment(joints,mols,0);
-}
+  uint mIteration;
+};
 
 ThreadedSolver::ThreadedSolver()
 {
@@ -120,11 +123,22 @@ void ThreadedSolver::UpdateData()
 
   MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
 
-  SplitConstraints(mContacts,mContactPhases);
-  SplitConstraints(mJoints,mJointPhases);
+  // Make enough batches per phase to keep every thread busy
+  uint batchesPerPhase = 2;
+  if(mJobSystem != nullptr)
+    batchesPerPhase = Math::Max(batchesPerPhase, (mJobSystem->GetWorkerCount() + 1) * 2);
+
+  SplitConstraints(mContacts,mContactPhases,batchesPerPhase);
+  SplitConstraints(mJoints,mJointPhases,batchesPerPhase);
+
+  // Contacts come first in the molecule buffer, followed by joints
+  uint moleculeOffset = ComputeBatchOffsets(mContactPhases, 0);
+  ComputeBatchOffsets(mJointPhases, moleculeOffset);
 
-  GroupOperationParamFragment<ContactList>(mContactPhases,molecules,UpdateDataFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases,molecules,UpdateDataFragmentList<JointList>);
+  void (*contactOperation)(ContactList&, MoleculeWalker&) = UpdateDataFragmentList<ContactList>;
+  void (*jointOperation)(JointList&, MoleculeWalker&) = UpdateDataFragmentList<JointList>;
+  ParallelGroupOperationFragment<ContactList>(mJobSystem,mContactPhases,molecules,contactOperation);
+  ParallelGroupOperationFragment<JointList>(mJobSystem,mJointPhases,molecules,jointOperation);
 }
 
 void ThreadedSolver::WarmStart()
@@ -134,8 +148,10 @@ void ThreadedSolver::WarmStart()
 
   MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
 
-  GroupOperationParamFragment<ContactList>(mContactPhases,molecules, WarmStartFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases,molecules, WarmStartFragmentList<JointList>);
+  void (*contactOperation)(ContactList&, MoleculeWalker&) = WarmStartFragmentList<ContactList>;
+  void (*jointOperation)(JointList&, MoleculeWalker&) = WarmStartFragmentList<JointList>;
+  ParallelGroupOperationFragment<ContactList>(mJobSystem,mContactPhases,molecules,contactOperation);
+  ParallelGroupOperationFragment<JointList>(mJobSystem,mJointPhases,molecules,jointOperation);
 }
 
 void ThreadedSolver::SolveVelocities()
@@ -149,8 +165,12 @@ void ThreadedSolver::IterateVelocities(uint iteration)
 {
   MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
 
-  GroupOperationTwoParamFragment<ContactList>(mContactPhases,molecules,iteration,IterateVelocitiesFragmentList<ContactList>);
-  GroupOperationTwoParamFragment<JointList>(mJointPhases,molecules,iteration,IterateVelocitiesFragmentList<JointList>);
+  IterateVelocitiesBatchOperation<ContactList> contactOperation;
+  contactOperation.mIteration = iteration;
+  IterateVelocitiesBatchOperation<JointList> jointOperation;
+  jointOperation.mIteration = iteration;
+  ParallelGroupOperationFragment<ContactList>(mJobSystem,mContactPhases,molecules,contactOperation);
+  ParallelGroupOperationFragment<JointList>(mJobSystem,mJointPhases,molecules,jointOperation);
 }
 
 void ThreadedSolver::SolvePositions()
@@ -189,8 +209,10 @@ void ThreadedSolver::Commit()
 {
   MoleculeWalker molecules(mMolecules.Data(),sizeof(ConstraintMolecule),0);
 
-  GroupOperationParamFragment<ContactList>(mContactPhases,molecules,CommitFragmentList<ContactList>);
-  GroupOperationParamFragment<JointList>(mJointPhases,molecules,CommitFragmentList<JointList>);
+  void (*contactOperation)(ContactList&, MoleculeWalker&) = CommitFragmentList<ContactList>;
+  void (*jointOperation)(JointList&, MoleculeWalker&) = CommitFragmentList<JointList>;
+  ParallelGroupOperationFragment<ContactList>(mJobSystem,mContactPhases,molecules,contactOperation);
+  ParallelGroupOperationFragment<JointList>(mJobSystem,mJointPhases,molecules,jointOperation);
 }
 
 void ThreadedSolver::BatchEvents()
@@ -7,7 +7,9 @@ namespace Physics
 {
 
 /// A constraint solver designed to thread the constraints
-/// into as many threads as possible.
+/// into as many threads as possible. Constraints are split into phases
+/// of batches that share no bodies, each phase's batches are run across
+/// the job system's workers with a barrier between phases.
 class ThreadedSolver : public IConstraintSolver
 {
 public:
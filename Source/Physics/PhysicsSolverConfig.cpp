@@ -298,6 +298,7 @@ LightningDefineType(PhysicsSolverConfig, builder, type)
   //LightningBindGetterSetterProperty(SolverType);
 
   LightningBindGetterSetterProperty(PositionCorrectionType);
+  LightningBindGetterSetterProperty(SolveIslandsInParallel);
 }
 
 PhysicsSolverConfig::PhysicsSolverConfig()
@@ -306,6 +307,7 @@ PhysicsSolverConfig::PhysicsSolverConfig()
   mPositionCorrectionType = PhysicsSolverPositionCorrection::Baumgarte;
   mSolverType = PhysicsSolverType::Basic;
   mSubType = PhysicsSolverSubType::BasicSolving;
+  mSolveIslandsInParallel = false;
 }
 
 PhysicsSolverConfig::~PhysicsSolverConfig()
@@ -325,6 +327,7 @@ void PhysicsSolverConfig::Serialize(Serializer& stream)
   SerializeEnumNameDefault(PhysicsSolverPositionCorrection, mPositionCorrectionType, PhysicsSolverPositionCorrection::PostStabilization);
   SerializeEnumNameDefault(PhysicsSolverType, mSolverType, PhysicsSolverType::Basic);
   SerializeEnumNameDefault(PhysicsSolverSubType, mSubType, PhysicsSolverSubType::BlockSolving);
+  SerializeNameDefault(mSolveIslandsInParallel, false);
 
   // Serialize our composition of constraint config blocks
   BoundType* selfBoundType = this->LightningGetDerivedType();
@@ -429,6 +432,16 @@ void PhysicsSolverConfig::SetSubCorrectionType(PhysicsSolverSubType::Enum subTyp
   mSubType = subType;
 }
 
+bool PhysicsSolverConfig::GetSolveIslandsInParallel()
+{
+  return mSolveIslandsInParallel;
+}
+
+void PhysicsSolverConfig::SetSolveIslandsInParallel(bool state)
+{
+  mSolveIslandsInParallel = state;
+}
+
 ConstraintConfigBlock& PhysicsSolverConfig::GetContactBlock()
 {
   return mContactBlock;
@@ -469,6 +482,7 @@ void PhysicsSolverConfig::CopyTo(PhysicsSolverConfig* destination)
   destination->mPositionCorrectionType = mPositionCorrectionType;
   destination->mSolverType = mSolverType;
   destination->mSubType = mSubType;
+  destination->mSolveIslandsInParallel = mSolveIslandsInParallel;
 
   // Clear the old blocks from our destination
   DeleteObjectsInContainer(destination->mBlocks);
@@ -131,6 +131,10 @@ public:
   /// What kind of solver to use for post stabilization. Mostly for testing.
   PhysicsSolverSubType::Enum GetSubCorrectionType();
   void SetSubCorrectionType(PhysicsSolverSubType::Enum subType);
+  /// Should independent islands (groups of objects that don't touch) be solved
+  /// on worker threads? Events are still sent in the same order as when solving serially.
+  bool GetSolveIslandsInParallel();
+  void SetSolveIslandsInParallel(bool state);
 
   //-------------------------------------------------------------------Internal
   ConstraintConfigBlock& GetContactBlock();
@@ -155,6 +159,7 @@ public:
   PhysicsSolverType::Enum mSolverType;
   PhysicsSolverPositionCorrection::Enum mPositionCorrectionType;
   PhysicsSolverSubType::Enum mSubType;
+  bool mSolveIslandsInParallel;
 
   Array<ConstraintConfigBlock*> mBlocks;
 
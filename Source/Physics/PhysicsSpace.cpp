@@ -710,6 +710,7 @@ void PhysicsSpace::IterateTimestep(real dt)
 void PhysicsSpace::IntegrateBodiesVelocity(real dt)
 {
   ZoneScoped;
+  mIntegrationBatch.Clear();
   RigidBodyList::range range = mRigidBodies.All();
 
   while(!range.Empty())
@@ -732,30 +733,39 @@ void PhysicsSpace::IntegrateBodiesVelocity(real dt)
       continue;
     }
 
+    // Dynamic bodies are integrated together afterwards (which clears their forces)
     if(!body.GetStatic())
-      Physics::Integration::IntegrateVelocity(&body, dt);
+    {
+      mIntegrationBatch.Add(&body);
+      continue;
+    }
 
     body.mForceAccumulator.ZeroOut();
     body.mTorqueAccumulator.ZeroOut();
   }
+
+  mIntegrationBatch.IntegrateVelocity(dt, mMaxVelocity);
 }
 
 void PhysicsSpace::IntegrateBodiesPosition(real dt)
 {
+  mIntegrationBatch.Clear();
   RigidBodyList::range range = mRigidBodies.All();
-
-  while(!range.Empty())
+  for(; !range.Empty(); range.PopFront())
   {
     RigidBody& body = range.Front();
+    if(!body.GetStatic())
+      mIntegrationBatch.Add(&body);
+  }
 
+  mIntegrationBatch.IntegratePosition(dt);
+
+  // Attempt to sleep the bodies.
+  for(range = mRigidBodies.All(); !range.Empty(); range.PopFront())
+  {
+    RigidBody& body = range.Front();
     if(!body.GetStatic())
-    {
-      Physics::Integration::IntegratePosition(&body, dt);
-      // Attempt to sleep the body.
       body.UpdateSleepTimer(dt);
-    }
-
-    range.PopFront();
   }
 }
 
@@ -790,6 +800,18 @@ void PhysicsSpace::BroadPhase()
   }
 
   mBroadPhase->RegisterCollisions();
+
+  JobSystem* jobSystem = PL::gJobs;
+  if(jobSystem != nullptr && jobSystem->GetWorkerCount() > 0)
+  {
+    QueryBroadPhaseParallel(jobSystem, dataArray);
+
+    // Sort the pairs for determinism!
+    if(GetDeterministic())
+      jobSystem->ParallelSort(mPossiblePairs, mPossiblePairsScratch, &ClientPairSorter);
+    return;
+  }
+
   // Query the dynamic broad phase
   mBroadPhase->SelfQuery(mPossiblePairs);
   // Query the static broad phase
@@ -800,11 +822,110 @@ void PhysicsSpace::BroadPhase()
     Sort(mPossiblePairs.All(), &ClientPairSorter);
 }
 
+// How many tasks the dynamic self query is split into.
+const uint cSelfQueryTaskCount = 64;
+// How many objects are queried against the static broad phase per task.
+const uint cBatchQueryTaskSize = 64;
+
+struct BroadPhaseQueryTask
+{
+  void operator()(uint index)
+  {
+    ClientPairArray& results = (*mResults)[index];
+    if(index < mSelfQueryTaskCount)
+    {
+      mBroadPhase->SelfQueryTask(index, results);
+      return;
+    }
+
+    BroadPhaseDataArray& data = *mData;
+    uint start = (index - mSelfQueryTaskCount) * cBatchQueryTaskSize;
+    uint end = Math::Min(start + cBatchQueryTaskSize, (uint)data.Size());
+    for(uint i = start; i < end; ++i)
+      mBroadPhase->Query(data[i], results);
+  }
+
+  BroadPhasePackage* mBroadPhase;
+  BroadPhaseDataArray* mData;
+  Array<ClientPairArray>* mResults;
+  uint mSelfQueryTaskCount;
+};
+
+void PhysicsSpace::QueryBroadPhaseParallel(JobSystem* jobSystem, BroadPhaseDataArray& dataArray)
+{
+  // Either query falls back to running on this thread if the broad phase can't split it
+  uint selfQueryTaskCount = mBroadPhase->SplitSelfQuery(cSelfQueryTaskCount);
+  if(selfQueryTaskCount == 0)
+    mBroadPhase->SelfQuery(mPossiblePairs);
+
+  uint batchQueryTaskCount = 0;
+  if(mBroadPhase->SupportsParallelQueries())
+    batchQueryTaskCount = (dataArray.Size() + cBatchQueryTaskSize - 1) / cBatchQueryTaskSize;
+  else
+    mBroadPhase->BatchQuery(dataArray, mPossiblePairs);
+
+  // Every task fills its own buffer which are then appended in task order. The tasks
+  // don't depend on the worker count so the pairs always come out in the same order.
+  uint taskCount = selfQueryTaskCount + batchQueryTaskCount;
+  if(mBroadPhaseResults.Size() < taskCount)
+    mBroadPhaseResults.Resize(taskCount);
+
+  BroadPhaseQueryTask task;
+  task.mBroadPhase = mBroadPhase;
+  task.mData = &dataArray;
+  task.mResults = &mBroadPhaseResults;
+  task.mSelfQueryTaskCount = selfQueryTaskCount;
+  jobSystem->ParallelFor(taskCount, task);
+
+  uint pairCount = mPossiblePairs.Size();
+  for(uint i = 0; i < taskCount; ++i)
+    pairCount += mBroadPhaseResults[i].Size();
+  mPossiblePairs.Reserve(pairCount);
+
+  for(uint i = 0; i < taskCount; ++i)
+  {
+    mPossiblePairs.Append(mBroadPhaseResults[i].All());
+    mBroadPhaseResults[i].Clear();
+  }
+}
+
+// How many possible pairs one narrow phase batch tests.
+const uint cNarrowPhaseBatchSize = 64;
+
+struct NarrowPhaseTask
+{
+  void operator()(uint index)
+  {
+    mSpace->TestNarrowPhaseBatch(index);
+  }
+
+  PhysicsSpace* mSpace;
+};
+
 void PhysicsSpace::NarrowPhase()
 {
   ZoneScoped;
   ProfileScopeTree("NarrowPhase", "Iteration", Color::Salmon);
 
+  uint pairCount = mPossiblePairs.Size();
+  uint batchCount = (pairCount + cNarrowPhaseBatchSize - 1) / cNarrowPhaseBatchSize;
+  if(mNarrowPhaseBatches.Size() < batchCount)
+    mNarrowPhaseBatches.Resize(batchCount);
+
+  // The pair tests only read the colliders so the batches can run on any thread
+  NarrowPhaseTask task;
+  task.mSpace = this;
+  JobSystem* jobSystem = PL::gJobs;
+  if(jobSystem != nullptr && jobSystem->GetWorkerCount() > 0 && batchCount > 1)
+  {
+    jobSystem->ParallelFor(batchCount, task);
+  }
+  else
+  {
+    for(uint i = 0; i < batchCount; ++i)
+      task(i);
+  }
+
   HeapAllocator allocator(mHeap);
   Physics::ManifoldArray tempManifolds;
   tempManifolds.SetAllocator(allocator);
@@ -812,39 +933,43 @@ void PhysicsSpace::NarrowPhase()
   Array<NodePointerPair> Collisions;
   Collisions.SetAllocator(allocator);
 
-  size_t size = mPossiblePairs.Size();
-  for(size_t pairIndex = 0; pairIndex < size; ++pairIndex)
+  bool tracking = mBroadPhase->IsTracking();
+  for(uint batchIndex = 0; batchIndex < batchCount; ++batchIndex)
   {
-    ClientPair* clientPair = &mPossiblePairs[pairIndex];
-    Collider* collider1 = static_cast<Collider*>(clientPair->mClientData[0]);
-    Collider* collider2 = static_cast<Collider*>(clientPair->mClientData[1]);
-    // Convert the proxy to a collider
-    ColliderPair pair(collider1, collider2);
+    NarrowPhaseBatch& batch = mNarrowPhaseBatches[batchIndex];
 
-    // Test for collision
-    if(!mCollisionManager->TestCollision(pair, tempManifolds))
-    {
-      tempManifolds.Clear();
-      continue;
-    }
+    // Add all manifolds to the contact manager
+    for(size_t i = 0; i < batch.mManifolds.Size(); ++i)
+      mContactManager->AddManifold(batch.mManifolds[i]);
 
     // If tracking is enabled, we need to record the collision
-    if(mBroadPhase->IsTracking())
-    {
-      NodePointerPair nodePair(clientPair->mClientData[0],
-                               clientPair->mClientData[1]);
-      Collisions.PushBack(nodePair);
-    }
+    if(tracking)
+      Collisions.Append(batch.mCollisions.All());
 
-    // Add all manifolds to the contact manager
-    for(size_t i = 0; i < tempManifolds.Size(); ++i)
+    // Test the pairs that couldn't run on a worker thread
+    for(size_t i = 0; i < batch.mDeferredPairs.Size(); ++i)
     {
-      Physics::Manifold& manifold = tempManifolds[i];
-      mContactManager->AddManifold(tempManifolds[i]);
-      manifold.Clear();
+      ClientPair* clientPair = &mPossiblePairs[batch.mDeferredPairs[i]];
+      ColliderPair pair(static_cast<Collider*>(clientPair->mClientData[0]),
+                        static_cast<Collider*>(clientPair->mClientData[1]));
+
+      if(!mCollisionManager->TestCollision(pair, tempManifolds))
+      {
+        tempManifolds.Clear();
+        continue;
+      }
+
+      if(tracking)
+        Collisions.PushBack(NodePointerPair(clientPair->mClientData[0], clientPair->mClientData[1]));
+
+      for(size_t j = 0; j < tempManifolds.Size(); ++j)
+        mContactManager->AddManifold(tempManifolds[j]);
+      tempManifolds.Clear();
     }
 
-    tempManifolds.Clear();
+    batch.mManifolds.Clear();
+    batch.mCollisions.Clear();
+    batch.mDeferredPairs.Clear();
   }
 
   mBroadPhase->RecordFrameResults(Collisions);
@@ -853,6 +978,44 @@ void PhysicsSpace::NarrowPhase()
   mIslandManager->BuildIslands(mDynamicColliders);
 }
 
+void PhysicsSpace::TestNarrowPhaseBatch(uint batchIndex)
+{
+  NarrowPhaseBatch& batch = mNarrowPhaseBatches[batchIndex];
+  bool tracking = mBroadPhase->IsTracking();
+
+  uint start = batchIndex * cNarrowPhaseBatchSize;
+  uint end = Math::Min(start + cNarrowPhaseBatchSize, (uint)mPossiblePairs.Size());
+  for(uint pairIndex = start; pairIndex < end; ++pairIndex)
+  {
+    ClientPair* clientPair = &mPossiblePairs[pairIndex];
+    Collider* collider1 = static_cast<Collider*>(clientPair->mClientData[0]);
+    Collider* collider2 = static_cast<Collider*>(clientPair->mClientData[1]);
+
+    // Height maps build their internal edge info lazily while colliding,
+    // so they can only be tested by one thread at a time.
+    if(collider1->GetColliderType() == Collider::cHeightMap ||
+       collider2->GetColliderType() == Collider::cHeightMap)
+    {
+      batch.mDeferredPairs.PushBack(pairIndex);
+      continue;
+    }
+
+    // Convert the proxy to a collider
+    ColliderPair pair(collider1, collider2);
+
+    // Test for collision, only keeping the manifolds if they collided
+    uint manifoldCount = batch.mManifolds.Size();
+    if(!mCollisionManager->TestCollision(pair, batch.mManifolds))
+    {
+      batch.mManifolds.Resize(manifoldCount);
+      continue;
+    }
+
+    if(tracking)
+      batch.mCollisions.PushBack(NodePointerPair(clientPair->mClientData[0], clientPair->mClientData[1]));
+  }
+}
+
 void PhysicsSpace::PreSolve(real dt)
 {
   // Send out pre-solve events
@@ -165,9 +165,14 @@ public:
   void IntegrateBodiesPosition(real dt);
   /// Updates all BroadPhases and then finds all possible collision pairs.
   void BroadPhase();
+  /// Runs the dynamic self query and the static queries as tasks on the job system.
+  void QueryBroadPhaseParallel(JobSystem* jobSystem, BroadPhaseDataArray& dataArray);
   /// Takes the possible collisions from the BroadPhase step and checks if they
   /// actually collide. If they do collide then they are added to the IslandManager.
   void NarrowPhase();
+  /// Tests one batch of the possible pairs, filling out that batch's results.
+  /// Safe to call from any thread as long as batches don't overlap.
+  void TestNarrowPhaseBatch(uint batchIndex);
   /// Sends out any pre-solve events so users can modify state before resolution.
   void PreSolve(real dt);
   /// Solves the constraints of all islands.
@@ -360,9 +365,28 @@ private:
   Physics::CollisionManager* mCollisionManager;
   Physics::ContactManager* mContactManager;
   Physics::IslandManager* mIslandManager;
+  /// The dynamic bodies being integrated this step.
+  Physics::IntegrationBatch mIntegrationBatch;
   // Stores the objects returned from the broad phase for that frame.  It is
   // not created on the stack each frame to avoid allocations.
   ClientPairArray mPossiblePairs;
+  /// The merge target when sorting the possible pairs in parallel.
+  ClientPairArray mPossiblePairsScratch;
+  /// The pairs found by each parallel broad phase query task.
+  Array<ClientPairArray> mBroadPhaseResults;
+
+  /// The results of testing one contiguous run of the possible pairs.
+  struct NarrowPhaseBatch
+  {
+    Physics::ManifoldArray mManifolds;
+    /// Collided pairs to record when the broad phase is tracking.
+    Array<NodePointerPair> mCollisions;
+    /// Pairs that have to be tested on the main thread (see TestNarrowPhaseBatch).
+    Array<uint> mDeferredPairs;
+  };
+  // Batches cover a fixed number of pairs (independent of the thread count) and are
+  // merged in order so contacts are always created in the same order.
+  Array<NarrowPhaseBatch> mNarrowPhaseBatches;
 
   // Stores all broad phase information.
   BroadPhasePackage* mBroadPhase;
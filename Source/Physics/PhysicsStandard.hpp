@@ -122,6 +122,7 @@ public:
 #include "Joints/GenericBasicSolver.hpp"
 #include "Island.hpp"
 #include "IslandManager.hpp"
+#include "IntegrationBatch.hpp"
 #include "PhysicsSolverConfig.hpp"
 #include "Joints/PositionCorrectionFragments.hpp"
 #include "Joints/JointDebugDrawConfig.hpp"
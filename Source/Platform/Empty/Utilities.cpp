@@ -120,6 +120,11 @@ void GetMemoryStatus(MemoryInfo& data)
 {
 }
 
+uint GetProcessorCount()
+{
+  return 1;
+}
+
 String GetEnvironmentalVariable(StringParam variable)
 {
   return String();
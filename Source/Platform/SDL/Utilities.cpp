@@ -255,6 +255,12 @@ void GetMemoryStatus(MemoryInfo& data)
 }
 #endif
 
+uint GetProcessorCount()
+{
+  int count = SDL_GetCPUCount();
+  return count > 0 ? (uint)count : 1;
+}
+
 String GetVersionString()
 {
   SDL_version version;
@@ -322,6 +322,13 @@ void GetMemoryStatus(MemoryInfo& data)
   }
 }
 
+uint GetProcessorCount()
+{
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwNumberOfProcessors > 0 ? (uint)info.dwNumberOfProcessors : 1;
+}
+
 typedef void(WINAPI* GetNativeSystemInfoPtr)(LPSYSTEM_INFO);
 
 String GetVersionString()
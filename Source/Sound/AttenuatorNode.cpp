@@ -203,7 +203,7 @@ float AttenuatorNode::GetVolumeChangeFromOutputsThreaded()
   float volume = 0.0f;
 
   // Get all volumes from outputs
-  forRange (HandleOf<SoundNode> node, GetOutputs(AudioThreads::MixThread)->All())
+  forRange (SoundNode* node, GetOutputs(AudioThreads::MixThread)->All())
     volume += node->GetVolumeChangeFromOutputsThreaded();
 
   // If there are multiple listeners, the sounds they hear are added together
@@ -49,7 +49,8 @@ AudioMixer::AudioMixer() :
     mMutingThreaded(false),
     mPeakInputVolume(0.0f),
     mSendMicrophoneInputCompressed(false),
-    mSendMicrophoneInputUncompressed(false)
+    mSendMicrophoneInputUncompressed(false),
+    mLastMixFramesThreaded(0)
 {
 }
 
@@ -85,6 +86,11 @@ void AudioMixer::StartMixing(Status& status)
 
   if (ThreadingEnabled)
   {
+    // Start up the shared decoding threads
+    DecodingThreads.Initialize();
+    // Start up the threads that help the mix thread evaluate the node graph
+    MixWorkers.Initialize();
+
     // Start up the mix thread
     MixThread.Initialize(StartMix, this, "Audio mix");
     if (!MixThread.IsValid())
@@ -121,6 +127,24 @@ void AudioMixer::ShutDown()
     MixThread.Close();
   }
 
+  // Mix timings can be printed to compare thread counts and latencies
+  unsigned mixWorkerCount = MixWorkers.GetThreadCount();
+  MixWorkers.ShutDown();
+  DecodingThreads.ShutDown();
+
+  MixTimingStats stats = GetMixTimingStats();
+  if (stats.mMixes > 0 && Environment::GetValue<bool>("AudioMixStats", false))
+  {
+    PlasmaPrint("Audio mixed %u times with %u helper threads: average %.2f ms, longest %.2f ms, "
+                "%.2f ms of audio per mix, %u missed deadlines\n",
+                stats.mMixes,
+                mixWorkerCount,
+                stats.mTotalMixTime * 1000.0 / stats.mMixes,
+                stats.mLongestMixTime * 1000.0,
+                stats.mDeadline * 1000.0,
+                stats.mDeadlineMisses);
+  }
+
   // Shut down audio output, input, and API
   AudioIO.StopStreams(true, true);
   AudioIO.ShutDown();
@@ -164,13 +188,33 @@ void AudioMixer::MixLoopThreaded()
     clock_t time = clock();
 #endif
 
+    MixTimer.Reset();
+
     // Execute tasks
     HandleTasksThreaded();
 
     // Mix current sounds to output buffer
     // Will return false when it's okay to shut down
+    mLastMixFramesThreaded = 0;
     running = MixCurrentInstancesThreaded();
 
+    // Compare the time taken with the length of the audio produced
+    unsigned outputSampleRate = AudioIO.GetStreamSampleRate(StreamTypes::Output);
+    if (mLastMixFramesThreaded > 0 && outputSampleRate > 0)
+    {
+      double mixTime = MixTimer.UpdateAndGetTime();
+      double deadline = (double)mLastMixFramesThreaded / outputSampleRate;
+
+      mTimingStatsLock.Lock();
+      ++mTimingStats.mMixes;
+      if (mixTime > deadline)
+        ++mTimingStats.mDeadlineMisses;
+      mTimingStats.mTotalMixTime += mixTime;
+      mTimingStats.mLongestMixTime = Math::Max(mTimingStats.mLongestMixTime, mixTime);
+      mTimingStats.mDeadline = deadline;
+      mTimingStatsLock.Unlock();
+    }
+
 #ifdef TRACK_TIME
     double timeDiff = (double)(clock() - time) / CLOCKS_PER_SEC;
     if (timeDiff > maxTime)
@@ -324,6 +368,14 @@ float AudioMixer::GetPeakInputVolume()
   }
 }
 
+MixTimingStats AudioMixer::GetMixTimingStats()
+{
+  mTimingStatsLock.Lock();
+  MixTimingStats stats = mTimingStats;
+  mTimingStatsLock.Unlock();
+  return stats;
+}
+
 void AudioMixer::SendListenerRemovedEvent(ListenerNode* listener)
 {
   SoundEvent event(listener);
@@ -346,6 +398,7 @@ bool AudioMixer::MixCurrentInstancesThreaded()
   unsigned outputChannels = AudioIO.GetStreamChannels(StreamTypes::Output);
   // Number of frames in the output
   unsigned outputFrames = samplesNeeded / outputChannels;
+  mLastMixFramesThreaded = outputFrames;
 
   int mixChannels = mSystemChannels.Get(AudioThreads::MixThread);
 
@@ -401,9 +454,9 @@ bool AudioMixer::MixCurrentInstancesThreaded()
       // Otherwise, interpolate between two mix frames
       else
       {
-        Plasma::Array<float> samples(mixChannels);
-        OutputResampler.GetNextFrame(samples.Data());
-        frame.SetSamples(samples.Data(), mixChannels);
+        float samples[AudioConstants::cMaxChannels];
+        OutputResampler.GetNextFrame(samples);
+        frame.SetSamples(samples, mixChannels);
       }
 
       // Apply the system volume
@@ -448,13 +501,9 @@ bool AudioMixer::MixCurrentInstancesThreaded()
   if (!VolumeInterpolatorThreaded.Finished())
   {
     // Apply the interpolated volume to each frame
-    for (unsigned i = 0; i < MixedOutput.Size(); i += outputChannels)
-    {
-      float volume = VolumeInterpolatorThreaded.NextValue();
-
-      for (unsigned j = 0; j < outputChannels; ++j)
-        MixedOutput[i + j] *= volume;
-    }
+    FrameVolumes.Resize(outputFrames);
+    VolumeInterpolatorThreaded.NextValues(FrameVolumes.Data(), outputFrames);
+    MixKernels::ScaleFrames(MixedOutput.Data(), FrameVolumes.Data(), outputFrames, outputChannels);
   }
 
   // If shutting down, wait for volume to ramp down to plasma
@@ -462,13 +511,9 @@ bool AudioMixer::MixCurrentInstancesThreaded()
   {
     // Ramp the volume down to plasma
     VolumeInterpolatorThreaded.SetValues(1.0f, 0.0f, outputFrames);
-    for (unsigned i = 0; i < MixedOutput.Size(); i += outputChannels)
-    {
-      float volume = VolumeInterpolatorThreaded.NextValue();
-
-      for (unsigned j = 0; j < outputChannels; ++j)
-        MixedOutput[i + j] *= volume;
-    }
+    FrameVolumes.Resize(outputFrames);
+    VolumeInterpolatorThreaded.NextValues(FrameVolumes.Data(), outputFrames);
+    MixKernels::ScaleFrames(MixedOutput.Data(), FrameVolumes.Data(), outputFrames, outputChannels);
 
     // Copy the data to the ring buffer
     AudioIO.OutputRingBuffer.Write(MixedOutput.Data(), MixedOutput.Size());
@@ -572,8 +617,8 @@ void AudioMixer::GetAudioInputDataThreaded(unsigned howManySamples)
     // Need to adjust channels
     if (inputChannels != mixChannels)
     {
-      // Get input data in a temporary array
-      Plasma::Array<float> inputSamples;
+      // Get input data in the scratch array
+      BufferType& inputSamples = InputScratch;
       AudioIO.GetInputDataThreaded(inputSamples, inputFrames * inputChannels);
 
       // Reset the InputBuffer
@@ -596,22 +641,24 @@ void AudioMixer::GetAudioInputDataThreaded(unsigned howManySamples)
     // Need to resample
     if (inputRate != cSystemSampleRate)
     {
-      // Temporary array for resampled data
-      Plasma::Array<float> resampledInput;
+      // Use the scratch array for resampled data
+      BufferType& resampledInput = InputScratch;
+      resampledInput.Clear();
       // Set the resampling factor on the resampler object
       InputResampler.SetFactor((double)inputRate / (double)cSystemSampleRate);
       // Set the buffer on the resampler
       InputResampler.SetInputBuffer(InputBuffer.Data(), InputBuffer.Size() / mixChannels, mixChannels);
       // Array to get a frame of samples from the resampler
-      Plasma::Array<float> frame(mixChannels);
+      float frame[AudioConstants::cMaxChannels];
 
       bool working(true);
       while (working)
       {
         // Get the next frame of resampled data
-        working = InputResampler.GetNextFrame(frame.Data());
+        working = InputResampler.GetNextFrame(frame);
         // Add it to the array
-        resampledInput.Append(frame.All());
+        for (int i = 0; i < mixChannels; ++i)
+          resampledInput.PushBack(frame[i]);
       }
 
       // Swap the resampled data into the InputBuffer
@@ -929,22 +976,12 @@ void AudioFrame::SetSamples(const float* samples, unsigned channels)
 
 void AudioFrame::Clamp()
 {
-  for (unsigned i = 0; i < cMaxChannels; ++i)
-    mSamples[i] = Math::Clamp(mSamples[i], -1.0f, 1.0f);
+  MixKernels::ClampSamples(mSamples, -1.0f, 1.0f, cMaxChannels);
 }
 
 float AudioFrame::GetMaxValue()
 {
-  float value = Math::Abs(mSamples[0]);
-
-  for (unsigned i = 1; i < cMaxChannels; ++i)
-  {
-    float newValue = Math::Abs(mSamples[i]);
-    if (newValue > value)
-      value = newValue;
-  }
-
-  return value;
+  return MixKernels::GetPeakValue(mSamples, cMaxChannels);
 }
 
 float AudioFrame::GetMonoValue()
@@ -952,20 +989,12 @@ float AudioFrame::GetMonoValue()
   if (mStoredChannels == 1)
     return mSamples[0];
 
-  float value = mSamples[0];
-
-  for (unsigned i = 1; i < cMaxChannels; ++i)
-    value += mSamples[i];
-
-  value /= mStoredChannels;
-
-  return value;
+  return MixKernels::SumSamples(mSamples, cMaxChannels) / mStoredChannels;
 }
 
 void AudioFrame::operator*=(float multiplier)
 {
-  for (unsigned i = 0; i < cMaxChannels; ++i)
-    mSamples[i] *= multiplier;
+  MixKernels::ScaleSamples(mSamples, multiplier, cMaxChannels);
 }
 
 void AudioFrame::operator=(const AudioFrame& copy)
@@ -19,6 +19,28 @@ public:
   HandleOf<SoundNode> mObject;
 };
 
+// Mix Timing Stats
+
+// How long the mix thread takes compared to the audio it has to produce. A mix
+// that takes longer than the audio it produced misses its deadline.
+struct MixTimingStats
+{
+  MixTimingStats() : mMixes(0), mDeadlineMisses(0), mTotalMixTime(0.0), mLongestMixTime(0.0), mDeadline(0.0)
+  {
+  }
+
+  // Number of mixes
+  unsigned mMixes;
+  // Number of mixes that took longer than their deadline
+  unsigned mDeadlineMisses;
+  // The time spent mixing, in seconds
+  double mTotalMixTime;
+  // The longest mix, in seconds
+  double mLongestMixTime;
+  // The length of the audio produced by the last mix, in seconds
+  double mDeadline;
+};
+
 // Audio Mixer
 
 class AudioMixer : public EventObject
@@ -73,6 +95,8 @@ public:
   // Sends an event when a listener is removed so SoundNodes can remove stored
   // information
   void SendListenerRemovedEvent(ListenerNode* listener);
+  // Returns the timing of the mixes so far
+  MixTimingStats GetMixTimingStats();
 
   // Number of channels used for the mixed output
   Threaded<int> mSystemChannels;
@@ -84,8 +108,14 @@ public:
   // Audio input data for the current mix, matching the current output sample
   // rate and channels
   Array<float> InputBuffer;
+  // Keeps its capacity so that adjusting the input doesn't allocate every mix
+  BufferType InputScratch;
   // If true, will send microphone input data to external system
   ThreadedInt mSendMicrophoneInputData;
+  // Decodes audio files when the system is threaded
+  DecodingThreadPool DecodingThreads;
+  // Evaluates independent parts of the node graph when the system is threaded
+  MixWorkerPool MixWorkers;
   // List of decoding tasks used if the system is not threaded
   Array<AudioFileDecoder*> DecodingTasks;
   // The maximum number of decoding tasks that will be processed on one update
@@ -123,6 +153,8 @@ private:
   BufferType BufferForOutput;
   // Array for finished mixed output
   BufferType MixedOutput;
+  // Volume of each output frame while the system volume is interpolating
+  BufferType FrameVolumes;
   // Thread for mix loop
   Thread MixThread;
   // For interpolating the overall system volume on the mix thread.
@@ -150,6 +182,14 @@ private:
   RingBuffer InputDataBuffer;
   // Stored microphone input samples when sending compressed input
   Array<float> PreviousInputSamples;
+  // Times each mix on the mix thread
+  Timer MixTimer;
+  // The timing of the mixes so far
+  MixTimingStats mTimingStats;
+  // Lock used when reading or updating the timing stats
+  ThreadLock mTimingStatsLock;
+  // Number of frames of output produced by the last mix
+  unsigned mLastMixFramesThreaded;
 
   // Index of the mix thread task buffer to write to
   int mMixThreadTaskWriteIndex;
@@ -119,7 +119,7 @@ float VolumeNode::GetVolumeChangeFromOutputsThreaded()
   float outputVolume = 0.0f;
 
   // Get all volumes from outputs
-  forRange (HandleOf<SoundNode> node, GetOutputs(AudioThreads::MixThread)->All())
+  forRange (SoundNode* node, GetOutputs(AudioThreads::MixThread)->All())
     outputVolume += node->GetVolumeChangeFromOutputsThreaded();
 
   // Return the output volume modified by this node's volume
@@ -337,7 +337,7 @@ float PanningNode::GetVolumeChangeFromOutputsThreaded()
 {
   float volume = (mLeftVolume.Get(AudioThreads::MixThread) + mRightVolume.Get(AudioThreads::MixThread)) / 2.0f;
 
-  forRange (HandleOf<SoundNode> node, GetOutputs(AudioThreads::MixThread)->All())
+  forRange (SoundNode* node, GetOutputs(AudioThreads::MixThread)->All())
     volume *= node->GetVolumeChangeFromOutputsThreaded();
 
   return volume;
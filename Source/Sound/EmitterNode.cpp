@@ -126,9 +126,10 @@ bool EmitterNode::GetOutputSamples(BufferType* outputBuffer,
   else
     outputBuffer->Swap(mInputSamplesThreaded);
 
-  // Adjust each frame with gain values
-  BufferRange outputRange1 = outputBuffer->All(), outputRange2 = outputBuffer->All();
-  for (unsigned i = 0; i < bufferSize; i += numberOfChannels)
+  // Get the volume for each frame
+  unsigned frames = bufferSize / numberOfChannels;
+  mFrameVolumesThreaded.Resize(frames);
+  for (unsigned i = 0; i < frames; ++i)
   {
     float volume = 1.0f;
     // If interpolating volume, get new volume value
@@ -140,32 +141,20 @@ bool EmitterNode::GetOutputSamples(BufferType* outputBuffer,
     }
 
     // Adjust the volume if this is a directional emitter
-    volume *= listenerData.mDirectionalVolume;
-
-    // Combine all channels into one value
-    // Leave unspatialized audio in all channels at minimum volume
-    float monoValue = 0.0f;
-    for (unsigned j = 0; j < numberOfChannels; ++j, outputRange1.PopFront())
-    {
-      monoValue += outputRange1.Front();
-      outputRange1.Front() *= cMinimumVolume * volume;
-    }
-    monoValue /= numberOfChannels;
-    monoValue *= volume;
-
-    // Add spatialized audio using gain values
-    for (unsigned j = 0; j < numberOfChannels; ++j, outputRange2.PopFront())
-    {
-      float multiplier = listenerData.mPreviousGains[j];
-
-      // If the gain values changed, interpolate from old to new value
-      if (valuesChanged)
-        multiplier += (listenerData.mGainValues[j] - listenerData.mPreviousGains[j]) * ((float)i / (float)bufferSize);
-
-      outputRange2.Front() += monoValue * multiplier;
-    }
+    mFrameVolumesThreaded[i] = volume * listenerData.mDirectionalVolume;
   }
 
+  // Adjust each frame with gain values, leaving unspatialized audio in all
+  // channels at minimum volume. If the gain values changed, interpolate from
+  // the old to the new values.
+  MixKernels::SpatializeFrames(outputBuffer->Data(),
+                               mFrameVolumesThreaded.Data(),
+                               listenerData.mPreviousGains,
+                               valuesChanged ? listenerData.mGainValues : nullptr,
+                               cMinimumVolume,
+                               frames,
+                               numberOfChannels);
+
   // If gain values changed, copy new ones to previous values
   if (valuesChanged)
     memcpy(listenerData.mPreviousGains, listenerData.mGainValues, sizeof(float) * cMaxChannels);
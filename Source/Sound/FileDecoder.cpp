@@ -227,14 +227,6 @@ int PacketDecoder::GetPacketFromFile(byte* packetDataToWrite,
 
 // File Decoder
 
-OsInt StartThreadForDecoding(void* data)
-{
-  tracy::SetThreadName("Decoding");
-  ZoneScoped;
-  ((AudioFileDecoder*)data)->DecodingLoopThreaded();
-  return 0;
-}
-
 AudioFileDecoder::AudioFileDecoder(int channels,
                                    unsigned samplesPerChannel,
                                    FileDecoderCallback callback,
@@ -243,7 +235,12 @@ AudioFileDecoder::AudioFileDecoder(int channels,
     mSamplesPerChannel(samplesPerChannel),
     mCallback(callback),
     mCallbackData(callbackData),
-    mShutDownSignal(0)
+    mFramesDecoded(0),
+    mPlaybackFrame(0),
+    mPacketsRequested(0),
+    mQueued(false),
+    mDecoding(false),
+    mRemoved(false)
 {
   // Set all decoder pointers to null
   memset(mDecoders, 0, sizeof(OpusDecoder*) * cMaxChannels);
@@ -251,7 +248,7 @@ AudioFileDecoder::AudioFileDecoder(int channels,
 
 AudioFileDecoder::~AudioFileDecoder()
 {
-  StopDecodingThread();
+  StopDecoding();
 }
 
 void AudioFileDecoder::RunDecodingTask()
@@ -263,15 +260,36 @@ void AudioFileDecoder::RunDecodingTask()
 
 void AudioFileDecoder::DecodeNextSection()
 {
-  // If the system is threaded, increment the semaphore to trigger another
-  // decode
+  // If the system is threaded, request another packet from the decoding threads
   if (ThreadingEnabled)
-    DecodingSemaphore.Increment();
+    PL::gSound->Mixer.DecodingThreads.RequestPacket(this);
   // Otherwise add this object to the list of tasks to be run on update
   else
     PL::gSound->Mixer.DecodingTasks.PushBack(this);
 }
 
+void AudioFileDecoder::UpdatePlaybackFrameThreaded(unsigned frameIndex)
+{
+  // Multiple instances can play the same decoded data, the furthest one will run out first
+  if ((int)frameIndex > mPlaybackFrame.Get())
+    mPlaybackFrame.Set((int)frameIndex);
+}
+
+void AudioFileDecoder::RecordUnderrunThreaded()
+{
+  ++mStats.mUnderruns;
+}
+
+int AudioFileDecoder::GetFramesBufferedThreaded()
+{
+  return mFramesDecoded.Get() - mPlaybackFrame.Get();
+}
+
+const DecodingStats& AudioFileDecoder::GetStats()
+{
+  return mStats;
+}
+
 bool AudioFileDecoder::DecodePacketThreaded()
 {
   // Note: This function happens on the decoding thread
@@ -313,35 +331,31 @@ bool AudioFileDecoder::DecodePacketThreaded()
     }
   }
 
+  ++mStats.mPacketsDecoded;
+  mFramesDecoded.Set(mFramesDecoded.Get() + frames);
+
   // Pass the decoded data to the callback function
   mCallback(&newPacket, mCallbackData);
 
   return true;
 }
 
-void AudioFileDecoder::StartDecodingThread()
+void AudioFileDecoder::StartDecoding()
 {
-  // Start the decoding thread only if threading is enabled
+  // Packets are requested from the decoding threads with DecodeNextSection
+  mFramesDecoded.Set(0);
+  mPlaybackFrame.Set(0);
+
   if (ThreadingEnabled)
-  {
-    DecodeThread.Initialize(StartThreadForDecoding, this, "Audio decoding");
-  }
+    PL::gSound->Mixer.DecodingThreads.AddDecoder(this);
 }
 
-void AudioFileDecoder::StopDecodingThread()
+void AudioFileDecoder::StopDecoding()
 {
   if (ThreadingEnabled)
   {
-    // Tell the decoding thread to shut down
-    mShutDownSignal.Set(cTrue);
-
-    // Increment the semaphore to make sure the shut down signal is seen
-    DecodingSemaphore.Increment();
-
-    // Wait for the decoding thread if it isn't finished, and close it
-    if (!DecodeThread.IsCompleted())
-      DecodeThread.WaitForCompletion();
-    DecodeThread.Close();
+    // Remove any requests and wait for a packet being decoded to finish
+    PL::gSound->Mixer.DecodingThreads.RemoveDecoder(this);
   }
   else
   {
@@ -358,6 +372,157 @@ void AudioFileDecoder::ClearData()
   PacketDecoder::DestroyDecoders(mDecoders, mChannels);
 }
 
+// Decoding Thread Pool
+
+DecodingThreadPool::DecodingThreadPool() : mThreadCount(0), mShutDownSignal(0)
+{
+}
+
+void DecodingThreadPool::Initialize()
+{
+  if (!ThreadingEnabled || mThreadCount != 0)
+    return;
+
+  mShutDownSignal.Set(cFalse);
+
+  // Leave most of the processors for the mix thread and the rest of the engine
+  unsigned threadCount = Math::Clamp(Os::GetProcessorCount() / 4, 1u, cMaxThreads);
+  for (unsigned i = 0; i < threadCount; ++i)
+  {
+    Thread& thread = mThreads[mThreadCount];
+    thread.Initialize(Thread::ObjectEntryCreator<DecodingThreadPool, &DecodingThreadPool::DecodingLoopThreaded>,
+                      this,
+                      "Audio decoding");
+    if (thread.IsValid())
+      ++mThreadCount;
+  }
+}
+
+void DecodingThreadPool::ShutDown()
+{
+  // Tell the decoding threads to shut down and make sure they all wake up to see it
+  mShutDownSignal.Set(cTrue);
+  for (unsigned i = 0; i < mThreadCount; ++i)
+    mRequestSemaphore.Increment();
+
+  for (unsigned i = 0; i < mThreadCount; ++i)
+  {
+    if (!mThreads[i].IsCompleted())
+      mThreads[i].WaitForCompletion();
+    mThreads[i].Close();
+  }
+  mThreadCount = 0;
+}
+
+void DecodingThreadPool::AddDecoder(AudioFileDecoder* decoder)
+{
+  mLock.Lock();
+  decoder->mRemoved = false;
+  mLock.Unlock();
+}
+
+void DecodingThreadPool::RequestPacket(AudioFileDecoder* decoder)
+{
+  mLock.Lock();
+  // The packet that was being decoded when the decoder was removed asks for the
+  // next one, queueing it again would let a thread use it after it's destroyed
+  if (decoder->mRemoved)
+  {
+    mLock.Unlock();
+    return;
+  }
+
+  ++decoder->mPacketsRequested;
+  if (!decoder->mQueued)
+  {
+    decoder->mQueued = true;
+    mQueue.PushBack(decoder);
+  }
+  mLock.Unlock();
+
+  mRequestSemaphore.Increment();
+}
+
+void DecodingThreadPool::RemoveDecoder(AudioFileDecoder* decoder)
+{
+  mLock.Lock();
+  decoder->mRemoved = true;
+  decoder->mPacketsRequested = 0;
+  if (decoder->mQueued)
+  {
+    decoder->mQueued = false;
+    mQueue.EraseValue(decoder);
+  }
+  mLock.Unlock();
+
+  // A decoding thread holds this lock until it's done with the decoder
+  decoder->mDecodingLock.Lock();
+  decoder->mDecodingLock.Unlock();
+}
+
+AudioFileDecoder* DecodingThreadPool::GetMostUrgentDecoder()
+{
+  // There are only ever a few dozen streams so a linear search is cheaper
+  // than keeping a heap sorted while every stream's playback moves
+  AudioFileDecoder* mostUrgent = nullptr;
+  int fewestFrames = 0;
+  forRange (AudioFileDecoder* decoder, mQueue.All())
+  {
+    if (decoder->mDecoding)
+      continue;
+
+    int framesBuffered = decoder->GetFramesBufferedThreaded();
+    if (!mostUrgent || framesBuffered < fewestFrames)
+    {
+      mostUrgent = decoder;
+      fewestFrames = framesBuffered;
+    }
+  }
+
+  return mostUrgent;
+}
+
+OsInt DecodingThreadPool::DecodingLoopThreaded()
+{
+  tracy::SetThreadName("Decoding");
+
+  while (mShutDownSignal.Get() == cFalse)
+  {
+    mLock.Lock();
+    AudioFileDecoder* decoder = GetMostUrgentDecoder();
+    if (!decoder)
+    {
+      // Wait until there is another request
+      mLock.Unlock();
+      mRequestSemaphore.WaitAndDecrement();
+      continue;
+    }
+
+    // Only one thread decodes for a decoder at a time since packets must be decoded in order
+    decoder->mDecoding = true;
+    if (--decoder->mPacketsRequested == 0)
+    {
+      decoder->mQueued = false;
+      mQueue.EraseValue(decoder);
+    }
+    decoder->mDecodingLock.Lock();
+    mLock.Unlock();
+
+    {
+      ZoneScoped;
+      decoder->DecodeRequestedPacketThreaded();
+    }
+
+    // The decoder can be destroyed as soon as its lock is released
+    mLock.Lock();
+    decoder->mDecoding = false;
+    decoder->mDecodingLock.Unlock();
+    mLock.Unlock();
+  }
+
+  return 0;
+}
+
 // Decompressed File Decoder
 
 DecompressedDecoder::DecompressedDecoder(Status& status,
@@ -386,7 +551,7 @@ DecompressedDecoder::DecompressedDecoder(Status& status,
     return;
   }
 
-  StartDecodingThread();
+  StartDecoding();
 }
 
 DecompressedDecoder::~DecompressedDecoder()
@@ -394,33 +559,15 @@ DecompressedDecoder::~DecompressedDecoder()
   ClearData();
 }
 
-void DecompressedDecoder::DecodingLoopThreaded()
+void DecompressedDecoder::DecodeRequestedPacketThreaded()
 {
-	
-  // Keep looping as long as we are still decoding
-  bool decoding = true;
-  while (decoding)
-  {
-    ZoneScoped;
-  	
-    // Wait until signaled that another packet is needed
-    DecodingSemaphore.WaitAndDecrement();
-
-    // Check if we are supposed to shut down
-    if (mShutDownSignal.Get() == cTrue)
-      return;
-
-    // Decode a packet and check if we should keep looping
-    decoding = DecodePacketThreaded();
-
-    // We need to keep decoding until we get through everything so trigger
-    // another packet
-    if (decoding)
-      DecodeNextSection();
-  }
-
+  // We need to keep decoding until we get through everything so request
+  // another packet
+  if (DecodePacketThreaded())
+    DecodeNextSection();
   // Now that we're done decoding, remove all allocated data
-  ClearData();
+  else
+    ClearData();
 }
 
 int DecompressedDecoder::GetNextPacket(byte* packetData)
@@ -479,7 +626,9 @@ StreamingDecoder::StreamingDecoder(Status& status,
     mDataSize(0),
     mInputFile(inputFile),
     mFilePosition(sizeof(FileHeader)),
-    mLock(lock)
+    mLock(lock),
+    mReadAheadIndex(0),
+    mEndOfData(false)
 {
   // If no valid callback was provided or the file is not open, don't do
   // anything
@@ -490,7 +639,7 @@ StreamingDecoder::StreamingDecoder(Status& status,
   if (!PacketDecoder::CreateDecoders(status, mDecoders, mChannels))
     return;
 
-  StartDecodingThread();
+  StartDecoding();
 }
 
 StreamingDecoder::StreamingDecoder(Status& status,
@@ -506,7 +655,9 @@ StreamingDecoder::StreamingDecoder(Status& status,
     mDataSize(dataSize),
     mInputFile(nullptr),
     mFilePosition(sizeof(FileHeader)),
-    mLock(nullptr)
+    mLock(nullptr),
+    mReadAheadIndex(0),
+    mEndOfData(false)
 {
   // If no valid callback or data buffer was provided, don't do anything
   if (!callback || !inputData)
@@ -516,47 +667,79 @@ StreamingDecoder::StreamingDecoder(Status& status,
   if (!PacketDecoder::CreateDecoders(status, mDecoders, mChannels))
     return;
 
-  StartDecodingThread();
+  StartDecoding();
 }
 
-void StreamingDecoder::DecodingLoopThreaded()
+void StreamingDecoder::DecodeRequestedPacketThreaded()
 {
-  // Keep looping as long as we are still decoding
-  bool decoding = true;
-  while (decoding)
-  {
-    // Wait until signaled that another packet is needed
-    DecodingSemaphore.WaitAndDecrement();
-
-    // Check if we are supposed to shut down
-    if (mShutDownSignal.Get() == cTrue)
-      return;
-
-    // Decode a packet and check if we should keep looping
-    decoding = DecodePacketThreaded();
-  }
+  // Requests keep coming in while the last samples are played, ignore them
+  if (!mEndOfData)
+    mEndOfData = !DecodePacketThreaded();
 }
 
 int StreamingDecoder::GetNextPacket(byte* packetData)
 {
   if (mCompressedData)
     return PacketDecoder::GetPacketFromMemory(packetData, mCompressedData, mDataSize, &mDataIndex);
-  else
-    return PacketDecoder::GetPacketFromFile(packetData, mInputFile, &mFilePosition, mLock);
+
+  // Make sure the header is available to get the packet's size
+  if (!FillReadAheadBuffer(sizeof(PacketHeader)))
+    return -1;
+
+  int packetDataSize = PacketDecoder::GetPacketDataSize(mReadAheadBuffer.Data() + mReadAheadIndex);
+  if (packetDataSize <= 0 || !FillReadAheadBuffer(sizeof(PacketHeader) + packetDataSize))
+    return -1;
+
+  // Copy the packet data into the buffer
+  memcpy(packetData, mReadAheadBuffer.Data() + mReadAheadIndex + sizeof(PacketHeader), packetDataSize);
+  mReadAheadIndex += sizeof(PacketHeader) + packetDataSize;
+
+  return packetDataSize;
+}
+
+bool StreamingDecoder::FillReadAheadBuffer(unsigned bytesNeeded)
+{
+  unsigned bytesBuffered = mReadAheadBuffer.Size() - mReadAheadIndex;
+  if (bytesBuffered >= bytesNeeded)
+    return true;
+
+  if (!mInputFile || !mInputFile->IsOpen())
+    return false;
+
+  // Move the unread data to the front and read the next chunk after it
+  memmove(mReadAheadBuffer.Data(), mReadAheadBuffer.Data() + mReadAheadIndex, bytesBuffered);
+  mReadAheadBuffer.Resize(Math::Max(bytesNeeded, cReadAheadSize));
+  mReadAheadIndex = 0;
+
+  // The file is shared with the other instances of the same asset. Reading a
+  // large chunk at once means the lock is only taken once for many packets.
+  Status status;
+  size_t bytesRead = 0;
+  mLock->Lock();
+  if (mInputFile->Seek(mFilePosition))
+    bytesRead = mInputFile->Read(status, mReadAheadBuffer.Data() + bytesBuffered, mReadAheadBuffer.Size() - bytesBuffered);
+  mLock->Unlock();
+
+  if (status.Failed())
+    bytesRead = 0;
+  mFilePosition += bytesRead;
+  ++mStats.mFileReads;
+
+  mReadAheadBuffer.Resize(bytesBuffered + bytesRead);
+  return mReadAheadBuffer.Size() >= bytesNeeded;
 }
 
 void StreamingDecoder::Reset()
 {
   // Stop any current decoding
-  StopDecodingThread();
-
-  // Reset the semaphore and shut down signal
-  DecodingSemaphore.Reset();
-  mShutDownSignal.Set(cFalse);
+  StopDecoding();
 
   // Reset the read positions
   mDataIndex = 0;
   mFilePosition = sizeof(FileHeader);
+  mReadAheadBuffer.Clear();
+  mReadAheadIndex = 0;
+  mEndOfData = false;
 
   // Destroy the current decoders (since they rely on history for decoding, they
   // can't continue from the beginning of the file)
@@ -566,8 +749,8 @@ void StreamingDecoder::Reset()
   Status status;
   PacketDecoder::CreateDecoders(status, mDecoders, mChannels);
 
-  // Restart the decoding thread
-  StartDecodingThread();
+  // Restart decoding
+  StartDecoding();
 }
 
 } // namespace Plasma
@@ -80,6 +80,24 @@ public:
   GetPacketFromFile(byte* packetDataToWrite, File* inputFile, FilePosition* filePosition, ThreadLock* lockObject);
 };
 
+// Decoding Stats
+
+// Per stream information about how well decoding is keeping up. The counts are
+// incremented by whichever decoding or mix thread is working on the stream.
+struct DecodingStats
+{
+  DecodingStats() : mPacketsDecoded(0), mUnderruns(0), mFileReads(0)
+  {
+  }
+
+  // Number of packets decoded so far
+  Atomic<unsigned> mPacketsDecoded;
+  // Number of times samples were needed before they were decoded
+  Atomic<unsigned> mUnderruns;
+  // Number of times data was read from the file (streaming from file only)
+  Atomic<unsigned> mFileReads;
+};
+
 // File Decoder
 
 typedef void (*FileDecoderCallback)(DecodedPacket*, void* data);
@@ -90,8 +108,8 @@ public:
   AudioFileDecoder(int channels, unsigned samplesPerChannel, FileDecoderCallback callback, void* callbackData);
   virtual ~AudioFileDecoder();
 
-  // Should only be called when starting the decoding thread
-  virtual void DecodingLoopThreaded() = 0;
+  // Called on a decoding thread each time a requested packet is decoded
+  virtual void DecodeRequestedPacketThreaded() = 0;
   // Fills in the provided buffer with the next packet data. Returns -1 if
   // getting packet fails or if the end of the data was reached.
   virtual int GetNextPacket(byte* packetData) = 0;
@@ -99,6 +117,16 @@ public:
   void RunDecodingTask();
   // Requests the next chunk of decoded data
   void DecodeNextSection();
+  // Tells the decoder how far playback has gotten, used to decode the streams
+  // closest to running out of samples first
+  void UpdatePlaybackFrameThreaded(unsigned frameIndex);
+  // Records that samples were needed before they were decoded
+  void RecordUnderrunThreaded();
+  // Returns the number of decoded frames that haven't been played yet (can be
+  // negative if playback has caught up with decoding)
+  int GetFramesBufferedThreaded();
+  // Returns the decoding statistics for this stream
+  const DecodingStats& GetStats();
 
   // Number of channels of audio
   int mChannels;
@@ -106,13 +134,15 @@ public:
   unsigned mSamplesPerChannel;
 
 protected:
+  friend class DecodingThreadPool;
+
   // Decodes the next packet of data (assumed that this is called on a decoding
   // thread)
   bool DecodePacketThreaded();
-  // Starts up the decoding thread
-  void StartDecodingThread();
-  // Stops and shuts down the decoding thread
-  void StopDecodingThread();
+  // Resets the playback tracking before the first packet is requested
+  void StartDecoding();
+  // Stops decoding, waiting for a packet that is currently being decoded
+  void StopDecoding();
   // Destroys the decoders
   virtual void ClearData();
 
@@ -122,12 +152,70 @@ protected:
   void* mCallbackData;
   // Opus decoders for each channel
   OpusDecoder* mDecoders[AudioConstants::cMaxChannels];
-  // Thread for decoding tasks
-  Thread DecodeThread;
-  // Tells the decoding thread it should shut down
+  // Number of frames decoded so far
+  ThreadedInt mFramesDecoded;
+  // The furthest frame playback has reached
+  ThreadedInt mPlaybackFrame;
+  // Statistics about this stream
+  DecodingStats mStats;
+
+  // The following are only used by the DecodingThreadPool while holding its lock
+  // Packets requested that haven't been decoded yet
+  unsigned mPacketsRequested;
+  // True while in the pool's queue
+  bool mQueued;
+  // True while a decoding thread is decoding for this decoder
+  bool mDecoding;
+  // Set by RemoveDecoder so a packet being decoded can't queue the decoder again
+  bool mRemoved;
+  // Held by a decoding thread while decoding for this decoder
+  ThreadLock mDecodingLock;
+};
+
+// Decoding Thread Pool
+
+// Decodes the requested packets of every AudioFileDecoder on a fixed number of
+// threads. A packet is decoded for whichever queued stream has the fewest
+// decoded frames ahead of its playback, so the streams about to run dry go first.
+class DecodingThreadPool
+{
+public:
+  DecodingThreadPool();
+
+  // Starts the decoding threads
+  void Initialize();
+  // Stops the decoding threads, finishing the packets currently being decoded
+  void ShutDown();
+  // Allows the decoder to request packets again after it was removed
+  void AddDecoder(AudioFileDecoder* decoder);
+  // Adds a request for another packet from this decoder, ignored if it was removed
+  void RequestPacket(AudioFileDecoder* decoder);
+  // Removes the decoder's requests, waiting if a thread is currently decoding
+  // for it. No other packets will be decoded for it until AddDecoder is called.
+  void RemoveDecoder(AudioFileDecoder* decoder);
+
+  // The maximum number of decoding threads
+  static const unsigned cMaxThreads = 4;
+
+private:
+  // The loop run by each decoding thread
+  OsInt DecodingLoopThreaded();
+  // Returns the queued decoder with the fewest buffered frames that isn't
+  // already being decoded, or null if there aren't any (called while locked)
+  AudioFileDecoder* GetMostUrgentDecoder();
+
+  // The decoding threads
+  Thread mThreads[cMaxThreads];
+  // Number of decoding threads that were started
+  unsigned mThreadCount;
+  // Decoders that have requested packets
+  Array<AudioFileDecoder*> mQueue;
+  // Protects the queue and the decoders' request data
+  ThreadLock mLock;
+  // Incremented for each request so idle threads wake up
+  Semaphore mRequestSemaphore;
+  // Tells the decoding threads to shut down
   ThreadedInt mShutDownSignal;
-  // Tells the decoding thread it should decode another packet
-  Semaphore DecodingSemaphore;
 };
 
 // Decompressed Decoder
@@ -141,8 +229,8 @@ public:
                       void* callbackData);
   ~DecompressedDecoder();
 
-  // Should only be called when starting the decoding thread
-  void DecodingLoopThreaded() override;
+  // Decodes a packet and requests the next one until the whole file is decoded
+  void DecodeRequestedPacketThreaded() override;
   // Fills in the provided buffer with the next packet data. Returns -1 if
   // getting packet fails or if the end of the data was reached.
   int GetNextPacket(byte* packetData) override;
@@ -185,15 +273,23 @@ public:
                    FileDecoderCallback callback,
                    void* callbackData);
 
-  // Should only be called when starting the decoding thread
-  void DecodingLoopThreaded() override;
+  // Decodes a single packet until the end of the data is reached
+  void DecodeRequestedPacketThreaded() override;
   // Fills in the provided buffer with the next packet data. Returns -1 if
   // getting packet fails or if the end of the data was reached.
   int GetNextPacket(byte* packetData) override;
   // Resets streaming decoding to the beginning
   void Reset();
 
+  // The number of bytes read from the file at once when streaming from file
+  static const unsigned cReadAheadSize = 64 * 1024;
+
 private:
+  // Makes sure at least the requested number of bytes are in the read ahead
+  // buffer, reading the next chunk of the file if needed. Returns false if the
+  // end of the file was reached first.
+  bool FillReadAheadBuffer(unsigned bytesNeeded);
+
   // The data read in from the file, if streaming from memory (will not be
   // deleted)
   byte* mCompressedData;
@@ -205,10 +301,16 @@ private:
   // The file to read the data from (does not own this file and will not close
   // it)
   File* mInputFile;
-  // The current read position in the file, if streaming from file
+  // The position in the file after the read ahead buffer, if streaming from file
   FilePosition mFilePosition;
   // Used to lock when reading from the file, if streaming from file
   ThreadLock* mLock;
+  // Data read from the file that hasn't been decoded yet, if streaming from file
+  Array<byte> mReadAheadBuffer;
+  // The read position in the read ahead buffer
+  unsigned mReadAheadIndex;
+  // Set once the end of the data was reached so further requests are ignored
+  bool mEndOfData;
 };
 
 } // namespace Plasma
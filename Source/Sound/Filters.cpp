@@ -50,6 +50,85 @@ void BiQuad::AddHistoryTo(BiQuad& otherFilter)
   otherFilter.y_2 += y_2;
 }
 
+// Multi-Channel BiQuad Filter
+
+BiQuadChannels::BiQuadChannels() : a0(0), a1(0), a2(0), b1(0), b2(0)
+{
+  FlushDelays();
+}
+
+void BiQuadChannels::FlushDelays()
+{
+  memset(x_1, 0, sizeof(float) * cMaxChannels);
+  memset(x_2, 0, sizeof(float) * cMaxChannels);
+  memset(y_1, 0, sizeof(float) * cMaxChannels);
+  memset(y_2, 0, sizeof(float) * cMaxChannels);
+}
+
+void BiQuadChannels::SetValues(const float a0_, const float a1_, const float a2_, const float b1_, const float b2_)
+{
+  a0 = a0_;
+  a1 = a1_;
+  a2 = a2_;
+  b1 = b1_;
+  b2 = b2_;
+}
+
+void BiQuadChannels::ProcessFrame(const float* input, float* output, const unsigned numChannels)
+{
+  unsigned i = 0;
+#if defined(USESSE)
+  using namespace Math::Simd;
+
+  // Pad the frame so that every group of four channels can be loaded
+  float x[cMaxChannels] = {0};
+  memcpy(x, input, sizeof(float) * numChannels);
+  float y[cMaxChannels];
+
+  SimVec a0Vec = Set(a0), a1Vec = Set(a1), a2Vec = Set(a2), b1Vec = Set(b1), b2Vec = Set(b2);
+  for (; i < numChannels; i += 4)
+  {
+    SimVec xVec = UnAlignedLoad(x + i);
+    SimVec x1Vec = UnAlignedLoad(x_1 + i);
+    SimVec y1Vec = UnAlignedLoad(y_1 + i);
+    SimVec yVec = (a0Vec * xVec) + (a1Vec * x1Vec) + (a2Vec * UnAlignedLoad(x_2 + i)) - (b1Vec * y1Vec) -
+                  (b2Vec * UnAlignedLoad(y_2 + i));
+
+    UnAlignedStore(y1Vec, y_2 + i);
+    UnAlignedStore(yVec, y_1 + i);
+    UnAlignedStore(x1Vec, x_2 + i);
+    UnAlignedStore(xVec, x_1 + i);
+    UnAlignedStore(yVec, y + i);
+  }
+
+  memcpy(output, y, sizeof(float) * numChannels);
+#else
+  for (; i < numChannels; ++i)
+  {
+    float x = input[i];
+    float y = (a0 * x) + (a1 * x_1[i]) + (a2 * x_2[i]) - (b1 * y_1[i]) - (b2 * y_2[i]);
+
+    y_2[i] = y_1[i];
+    y_1[i] = y;
+    x_2[i] = x_1[i];
+    x_1[i] = x;
+
+    output[i] = y;
+  }
+#endif
+}
+
+void BiQuadChannels::AddHistoryTo(BiQuadChannels& otherFilter)
+{
+  for (unsigned i = 0; i < cMaxChannels; ++i)
+  {
+    otherFilter.x_1[i] += x_1[i];
+    otherFilter.x_2[i] += x_2[i];
+    otherFilter.y_1[i] += y_1[i];
+    otherFilter.y_2[i] += y_2[i];
+  }
+}
+
 // Delay Filter
 
 Delay::Delay(float maxDelayTime, int sampleRate) :
@@ -265,9 +344,6 @@ void OnePoleLP::ProcessAudio(const float input, float* output)
 LowPassFilter::LowPassFilter() : CutoffFrequency(20001.0f), HalfPI(Math::cPi / 2.0f), SqRoot2(Math::Sqrt(2.0f))
 {
   SetCutoffValues();
-
-  for (unsigned i = 0; i < cMaxChannels; ++i)
-    BiQuadsPerChannel[i].FlushDelays();
 }
 
 void LowPassFilter::SetCutoffValues()
@@ -284,8 +360,7 @@ void LowPassFilter::SetCutoffValues()
   float beta1 = 2.0f * alpha * (1.0f - Csq);
   float beta2 = alpha * (1.0f - (SqRoot2 * C) + Csq);
 
-  for (unsigned i = 0; i < cMaxChannels; ++i)
-    BiQuadsPerChannel[i].SetValues(alpha, 2.0f * alpha, alpha, beta1, beta2);
+  BiQuads.SetValues(alpha, 2.0f * alpha, alpha, beta1, beta2);
 }
 
 void LowPassFilter::SetCutoffFrequency(float value)
@@ -296,10 +371,7 @@ void LowPassFilter::SetCutoffFrequency(float value)
 
 void LowPassFilter::MergeWith(LowPassFilter& otherFilter)
 {
-  for (int i = 0; i < cMaxChannels; ++i)
-  {
-    BiQuadsPerChannel[i].AddHistoryTo(otherFilter.BiQuadsPerChannel[i]);
-  }
+  BiQuads.AddHistoryTo(otherFilter.BiQuads);
 }
 
 void LowPassFilter::ProcessFrame(const float* input, float* output, const unsigned numChannels)
@@ -309,10 +381,7 @@ void LowPassFilter::ProcessFrame(const float* input, float* output, const unsign
     memcpy(output, input, sizeof(float) * numChannels);
   }
   else
-  {
-    for (unsigned i = 0; i < numChannels; ++i)
-      output[i] = BiQuadsPerChannel[i].DoBiQuad(input[i]);
-  }
+    BiQuads.ProcessFrame(input, output, numChannels);
 }
 
 void LowPassFilter::ProcessBuffer(const float* input,
@@ -340,9 +409,6 @@ float LowPassFilter::GetCutoffFrequency()
 HighPassFilter::HighPassFilter() : CutoffFrequency(10.0f), HalfPI(Math::cPi / 2.0f), SqRoot2(Math::Sqrt(2.0f))
 {
   SetCutoffValues();
-
-  for (unsigned i = 0; i < cMaxChannels; ++i)
-    BiQuadsPerChannel[i].FlushDelays();
 }
 
 void HighPassFilter::SetCutoffValues()
@@ -358,8 +424,7 @@ void HighPassFilter::SetCutoffValues()
   float beta1 = 2.0f * alpha * (Csq - 1.0f);
   float beta2 = alpha * (1.0f - (SqRoot2 * C) + Csq);
 
-  for (unsigned i = 0; i < cMaxChannels; ++i)
-    BiQuadsPerChannel[i].SetValues(alpha, -2.0f * alpha, alpha, beta1, beta2);
+  BiQuads.SetValues(alpha, -2.0f * alpha, alpha, beta1, beta2);
 }
 
 void HighPassFilter::SetCutoffFrequency(const float value)
@@ -370,10 +435,7 @@ void HighPassFilter::SetCutoffFrequency(const float value)
 
 void HighPassFilter::MergeWith(HighPassFilter& otherFilter)
 {
-  for (int i = 0; i < cMaxChannels; ++i)
-  {
-    BiQuadsPerChannel[i].AddHistoryTo(otherFilter.BiQuadsPerChannel[i]);
-  }
+  BiQuads.AddHistoryTo(otherFilter.BiQuads);
 }
 
 void HighPassFilter::ProcessFrame(const float* input, float* output, const unsigned numChannels)
@@ -381,10 +443,7 @@ void HighPassFilter::ProcessFrame(const float* input, float* output, const unsig
   if (CutoffFrequency < 20.0f)
     memcpy(output, input, sizeof(float) * numChannels);
   else
-  {
-    for (unsigned i = 0; i < numChannels; ++i)
-      output[i] = BiQuadsPerChannel[i].DoBiQuad(input[i]);
-  }
+    BiQuads.ProcessFrame(input, output, numChannels);
 }
 
 // Band Pass Filter
@@ -38,6 +38,33 @@ private:
   float b2;
 };
 
+// Multi-Channel BiQuad Filter
+
+// A BiQuad filter for each channel of a frame, all using the same coefficients.
+// The history is stored per value rather than per channel so that four
+// channels can be filtered at once.
+class BiQuadChannels
+{
+public:
+  BiQuadChannels();
+
+  void FlushDelays();
+  void SetValues(const float a0, const float a1, const float a2, const float b1, const float b2);
+  void ProcessFrame(const float* input, float* output, const unsigned numChannels);
+  void AddHistoryTo(BiQuadChannels& otherFilter);
+
+private:
+  float x_1[AudioConstants::cMaxChannels];
+  float x_2[AudioConstants::cMaxChannels];
+  float y_1[AudioConstants::cMaxChannels];
+  float y_2[AudioConstants::cMaxChannels];
+  float a0;
+  float a1;
+  float a2;
+  float b1;
+  float b2;
+};
+
 // Delay Filter
 
 class Delay
@@ -165,7 +192,7 @@ private:
   float SqRoot2;
   float HalfPI;
 
-  BiQuad BiQuadsPerChannel[AudioConstants::cMaxChannels];
+  BiQuadChannels BiQuads;
 
   void SetCutoffValues();
 };
@@ -187,7 +214,7 @@ private:
   float SqRoot2;
   float HalfPI;
 
-  BiQuad BiQuadsPerChannel[AudioConstants::cMaxChannels];
+  BiQuadChannels BiQuads;
 
   void SetCutoffValues();
 };
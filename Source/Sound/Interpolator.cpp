@@ -60,6 +60,12 @@ float InterpolatingObject::NextValue()
     return CustomCurveObject.GetValue((float)mCurrentFrame++, (float)mTotalFrames, mStartValue, mEndValue);
 }
 
+void InterpolatingObject::NextValues(float* values, const unsigned count)
+{
+  for (unsigned i = 0; i < count; ++i)
+    values[i] = NextValue();
+}
+
 float InterpolatingObject::ValueAtIndex(const unsigned index)
 {
   if (mTotalFrames == 0 || index >= mTotalFrames || mEndValue == mStartValue)
@@ -48,6 +48,8 @@ public:
   // Calculates the next sequential value in the interpolation. If past the end
   // point, returns end value.
   float NextValue();
+  // Calculates the next count sequential values into the values array.
+  void NextValues(float* values, const unsigned count);
   // Calculates the interpolated value at a specified index. If past the end,
   // returns end value.
   float ValueAtIndex(const unsigned index);
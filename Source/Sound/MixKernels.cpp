@@ -0,0 +1,300 @@
+// MIT Licensed (see LICENSE.md).
+
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+namespace MixKernels
+{
+
+#if defined(USESSE)
+using namespace Math::Simd;
+
+// Returns a vector where each lane holds the value of the frame that lane's
+// sample belongs to. The first lane is the sample at firstSample in a block
+// which starts on a frame boundary.
+static SimVec SpreadFrameValues(const float* frameValues, const unsigned firstSample, const unsigned channels)
+{
+  return Set4(frameValues[firstSample / channels],
+              frameValues[(firstSample + 1) / channels],
+              frameValues[(firstSample + 2) / channels],
+              frameValues[(firstSample + 3) / channels]);
+}
+
+// Returns a vector where each lane holds the value of that lane's channel.
+static SimVec SpreadChannelValues(const float* channelValues, const unsigned firstSample, const unsigned channels)
+{
+  return Set4(channelValues[firstSample % channels],
+              channelValues[(firstSample + 1) % channels],
+              channelValues[(firstSample + 2) % channels],
+              channelValues[(firstSample + 3) % channels]);
+}
+
+// The number of samples in a block of whole frames which fills whole vectors,
+// or zero if the channel count doesn't fit in vectors evenly.
+static unsigned GetSamplesPerBlock(const unsigned channels)
+{
+  if (channels == 1 || channels == 2 || channels == 4)
+    return 4;
+  else if (channels == 8)
+    return 8;
+  else
+    return 0;
+}
+#endif
+
+void AddSamples(float* destination, const float* source, const unsigned count)
+{
+  unsigned i = 0;
+#if defined(USESSE)
+  for (; i + 4 <= count; i += 4)
+    UnAlignedStore(UnAlignedLoad(destination + i) + UnAlignedLoad(source + i), destination + i);
+#endif
+
+  for (; i < count; ++i)
+    destination[i] += source[i];
+}
+
+void AddScaledSamples(float* destination, const float* source, const float scale, const unsigned count)
+{
+  unsigned i = 0;
+#if defined(USESSE)
+  SimVec scaleVec = Set(scale);
+  for (; i + 4 <= count; i += 4)
+    UnAlignedStore(MultiplyAdd(UnAlignedLoad(source + i), scaleVec, UnAlignedLoad(destination + i)), destination + i);
+#endif
+
+  for (; i < count; ++i)
+    destination[i] += source[i] * scale;
+}
+
+void MultiplySamples(float* samples, const float* multipliers, const unsigned count)
+{
+  unsigned i = 0;
+#if defined(USESSE)
+  for (; i + 4 <= count; i += 4)
+    UnAlignedStore(UnAlignedLoad(samples + i) * UnAlignedLoad(multipliers + i), samples + i);
+#endif
+
+  for (; i < count; ++i)
+    samples[i] *= multipliers[i];
+}
+
+void ScaleSamples(float* samples, const float scale, const unsigned count)
+{
+  unsigned i = 0;
+#if defined(USESSE)
+  SimVec scaleVec = Set(scale);
+  for (; i + 4 <= count; i += 4)
+    UnAlignedStore(UnAlignedLoad(samples + i) * scaleVec, samples + i);
+#endif
+
+  for (; i < count; ++i)
+    samples[i] *= scale;
+}
+
+void ClampSamples(float* samples, const float minValue, const float maxValue, const unsigned count)
+{
+  unsigned i = 0;
+#if defined(USESSE)
+  SimVec minVec = Set(minValue);
+  SimVec maxVec = Set(maxValue);
+  for (; i + 4 <= count; i += 4)
+    UnAlignedStore(Clamp(UnAlignedLoad(samples + i), minVec, maxVec), samples + i);
+#endif
+
+  for (; i < count; ++i)
+    samples[i] = Math::Clamp(samples[i], minValue, maxValue);
+}
+
+float GetPeakValue(const float* samples, const unsigned count)
+{
+  float peak = 0.0f;
+  unsigned i = 0;
+#if defined(USESSE)
+  if (count >= 4)
+  {
+    SimVec peakVec = ZeroOutVec();
+    for (; i + 4 <= count; i += 4)
+      peakVec = Math::Simd::Max(peakVec, Math::Simd::Abs(UnAlignedLoad(samples + i)));
+
+    float lanes[4];
+    UnAlignedStore(peakVec, lanes);
+    peak = Math::Max(Math::Max(lanes[0], lanes[1]), Math::Max(lanes[2], lanes[3]));
+  }
+#endif
+
+  for (; i < count; ++i)
+    peak = Math::Max(peak, Math::Abs(samples[i]));
+
+  return peak;
+}
+
+float SumSamples(const float* samples, const unsigned count)
+{
+  float sum = 0.0f;
+  unsigned i = 0;
+#if defined(USESSE)
+  if (count >= 4)
+  {
+    SimVec sumVec = ZeroOutVec();
+    for (; i + 4 <= count; i += 4)
+      sumVec += UnAlignedLoad(samples + i);
+
+    float lanes[4];
+    UnAlignedStore(sumVec, lanes);
+    sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+#endif
+
+  for (; i < count; ++i)
+    sum += samples[i];
+
+  return sum;
+}
+
+void BlendSamples(float* destination, const float* source, const float sourceAmount, const unsigned count)
+{
+  float destinationAmount = 1.0f - sourceAmount;
+  unsigned i = 0;
+#if defined(USESSE)
+  SimVec sourceVec = Set(sourceAmount);
+  SimVec destinationVec = Set(destinationAmount);
+  for (; i + 4 <= count; i += 4)
+  {
+    SimVec result = (UnAlignedLoad(source + i) * sourceVec) + (UnAlignedLoad(destination + i) * destinationVec);
+    UnAlignedStore(result, destination + i);
+  }
+#endif
+
+  for (; i < count; ++i)
+    destination[i] = (source[i] * sourceAmount) + (destination[i] * destinationAmount);
+}
+
+void InterpolateFrame(const float* first,
+                      const float* second,
+                      const float percent,
+                      float* output,
+                      const unsigned channels)
+{
+  unsigned i = 0;
+#if defined(USESSE)
+  SimVec percentVec = Set(percent);
+  for (; i + 4 <= channels; i += 4)
+  {
+    SimVec firstVec = UnAlignedLoad(first + i);
+    UnAlignedStore(firstVec + ((UnAlignedLoad(second + i) - firstVec) * percentVec), output + i);
+  }
+#endif
+
+  for (; i < channels; ++i)
+    output[i] = first[i] + ((second[i] - first[i]) * percent);
+}
+
+void ScaleFrames(float* samples, const float* frameVolumes, const unsigned frameCount, const unsigned channels)
+{
+  unsigned frame = 0;
+#if defined(USESSE)
+  unsigned blockSamples = GetSamplesPerBlock(channels);
+  if (blockSamples != 0)
+  {
+    unsigned blockFrames = blockSamples / channels;
+    for (; frame + blockFrames <= frameCount; frame += blockFrames)
+    {
+      float* block = samples + (frame * channels);
+      for (unsigned i = 0; i < blockSamples; i += 4)
+        UnAlignedStore(UnAlignedLoad(block + i) * SpreadFrameValues(frameVolumes + frame, i, channels), block + i);
+    }
+  }
+#endif
+
+  for (; frame < frameCount; ++frame)
+  {
+    float* frameSamples = samples + (frame * channels);
+    for (unsigned i = 0; i < channels; ++i)
+      frameSamples[i] *= frameVolumes[frame];
+  }
+}
+
+void SpatializeFrames(float* samples,
+                      const float* frameVolumes,
+                      const float* startGains,
+                      const float* endGains,
+                      const float unspatializedVolume,
+                      const unsigned frameCount,
+                      const unsigned channels)
+{
+  float gainChanges[AudioConstants::cMaxChannels];
+  for (unsigned i = 0; i < channels; ++i)
+    gainChanges[i] = endGains ? endGains[i] - startGains[i] : 0.0f;
+
+  float totalSamples = (float)(frameCount * channels);
+  unsigned frame = 0;
+
+#if defined(USESSE)
+  unsigned blockSamples = GetSamplesPerBlock(channels);
+  if (blockSamples != 0)
+  {
+    unsigned blockFrames = blockSamples / channels;
+
+    // The gains for each lane only depend on the lane's position in the block
+    SimVec startGainVecs[2];
+    SimVec gainChangeVecs[2];
+    for (unsigned i = 0; i < blockSamples; i += 4)
+    {
+      startGainVecs[i / 4] = SpreadChannelValues(startGains, i, channels);
+      gainChangeVecs[i / 4] = SpreadChannelValues(gainChanges, i, channels);
+    }
+
+    float monoValues[4];
+    float volumes[4];
+    float percents[4];
+    for (; frame + blockFrames <= frameCount; frame += blockFrames)
+    {
+      float* block = samples + (frame * channels);
+
+      // Get the per frame values before changing the samples
+      for (unsigned i = 0; i < blockFrames; ++i)
+      {
+        float volume = frameVolumes[frame + i];
+        monoValues[i] = (SumSamples(block + (i * channels), channels) / channels) * volume;
+        volumes[i] = unspatializedVolume * volume;
+        percents[i] = (float)((frame + i) * channels) / totalSamples;
+      }
+
+      for (unsigned i = 0; i < blockSamples; i += 4)
+      {
+        SimVec gains = startGainVecs[i / 4];
+        if (endGains)
+          gains += gainChangeVecs[i / 4] * SpreadFrameValues(percents, i, channels);
+
+        SimVec result = UnAlignedLoad(block + i) * SpreadFrameValues(volumes, i, channels);
+        result += SpreadFrameValues(monoValues, i, channels) * gains;
+        UnAlignedStore(result, block + i);
+      }
+    }
+  }
+#endif
+
+  for (; frame < frameCount; ++frame)
+  {
+    float* frameSamples = samples + (frame * channels);
+    float volume = frameVolumes[frame];
+    float monoValue = (SumSamples(frameSamples, channels) / channels) * volume;
+    float percent = (float)(frame * channels) / totalSamples;
+
+    for (unsigned i = 0; i < channels; ++i)
+    {
+      float gain = startGains[i];
+      if (endGains)
+        gain += gainChanges[i] * percent;
+
+      frameSamples[i] = (frameSamples[i] * (unspatializedVolume * volume)) + (monoValue * gain);
+    }
+  }
+}
+
+} // namespace MixKernels
+
+} // namespace Plasma
@@ -0,0 +1,54 @@
+// MIT Licensed (see LICENSE.md).
+
+#pragma once
+
+namespace Plasma
+{
+
+// Mix Kernels
+
+// The per sample operations used by the mix thread. When the SIMD library is
+// available these work on four samples at a time, otherwise they are plain
+// loops. Buffers are interleaved frames and don't need any particular alignment.
+namespace MixKernels
+{
+
+// Adds the source samples to the destination samples.
+void AddSamples(float* destination, const float* source, const unsigned count);
+// Adds the source samples multiplied by scale to the destination samples.
+void AddScaledSamples(float* destination, const float* source, const float scale, const unsigned count);
+// Multiplies each sample by the matching value in the multipliers array.
+void MultiplySamples(float* samples, const float* multipliers, const unsigned count);
+// Multiplies all samples by the same value.
+void ScaleSamples(float* samples, const float scale, const unsigned count);
+// Keeps all samples between the minimum and maximum values.
+void ClampSamples(float* samples, const float minValue, const float maxValue, const unsigned count);
+// Returns the largest absolute value of the samples.
+float GetPeakValue(const float* samples, const unsigned count);
+// Returns the sum of the samples.
+float SumSamples(const float* samples, const unsigned count);
+// Sets destination = (source * sourceAmount) + (destination * (1 - sourceAmount)).
+void BlendSamples(float* destination, const float* source, const float sourceAmount, const unsigned count);
+// Interpolates between two frames: output = first + ((second - first) * percent).
+void InterpolateFrame(const float* first,
+                      const float* second,
+                      const float percent,
+                      float* output,
+                      const unsigned channels);
+// Multiplies every sample in each frame by that frame's volume.
+void ScaleFrames(float* samples, const float* frameVolumes, const unsigned frameCount, const unsigned channels);
+// Spatializes each frame: the channels are kept at the unspatialized volume and
+// the average of the channels is added to each one using the gain values. If
+// endGains is not null the gains are interpolated from startGains across the
+// frames. Both gain arrays must hold AudioConstants::cMaxChannels values.
+void SpatializeFrames(float* samples,
+                      const float* frameVolumes,
+                      const float* startGains,
+                      const float* endGains,
+                      const float unspatializedVolume,
+                      const unsigned frameCount,
+                      const unsigned channels);
+
+} // namespace MixKernels
+
+} // namespace Plasma
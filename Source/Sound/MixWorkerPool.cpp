@@ -0,0 +1,316 @@
+// MIT Licensed (see LICENSE.md).
+
+#include "Precompiled.hpp"
+
+namespace Plasma
+{
+
+using namespace AudioConstants;
+
+// Stored in the next group counter when no groups can be claimed
+static const s32 cNoGroupsToClaim = 0x3FFFFFFF;
+
+// Mix Worker Pool
+
+MixWorkerPool::MixWorkerPool() :
+    mThreadCount(0),
+    mShutDownSignal(0),
+    mEvaluatingGroupsThreaded(false),
+    mPartitionVersion(0),
+    mGraphVersion(0),
+    mPartitionedNode(nullptr),
+    mPartitionedGraphVersion(0),
+    mPartitionedGroupCount(0),
+    mNode(nullptr),
+    mChannels(0),
+    mListener(nullptr),
+    mGroupCount(0),
+    mNextGroup(cNoGroupsToClaim),
+    mGroupsFinished(0)
+{
+}
+
+void MixWorkerPool::Initialize()
+{
+  if (!ThreadingEnabled || mThreadCount != 0)
+    return;
+
+  mShutDownSignal.Set(cFalse);
+
+  // The mix thread evaluates groups as well, and the decoding threads and the
+  // rest of the engine need processors too
+  unsigned threadCount = Math::Clamp(Os::GetProcessorCount() / 2, 1u, cMaxThreads + 1) - 1;
+  for (unsigned i = 0; i < threadCount; ++i)
+  {
+    Thread& thread = mThreads[mThreadCount];
+    thread.Initialize(
+        Thread::ObjectEntryCreator<MixWorkerPool, &MixWorkerPool::WorkerLoopThreaded>, this, "Audio mix worker");
+    if (thread.IsValid())
+      ++mThreadCount;
+  }
+}
+
+void MixWorkerPool::ShutDown()
+{
+  // Tell the worker threads to shut down and make sure they all wake up to see it
+  mShutDownSignal.Set(cTrue);
+  for (unsigned i = 0; i < mThreadCount; ++i)
+    mWorkSemaphore.Increment();
+
+  for (unsigned i = 0; i < mThreadCount; ++i)
+  {
+    if (!mThreads[i].IsCompleted())
+      mThreads[i].WaitForCompletion();
+    mThreads[i].Close();
+  }
+  mThreadCount = 0;
+}
+
+unsigned MixWorkerPool::GetThreadCount()
+{
+  return mThreadCount;
+}
+
+void MixWorkerPool::GraphChangedThreaded()
+{
+  ++mGraphVersion;
+}
+
+bool MixWorkerPool::AccumulateInputSamples(SoundNode* node,
+                                           const unsigned howManySamples,
+                                           const unsigned numberOfChannels,
+                                           ListenerNode* listener,
+                                           bool* isThereInput)
+{
+  // Only split the graph once, and only if there is another thread to help
+  if (mThreadCount == 0 || mEvaluatingGroupsThreaded || node->mInputs[AudioThreads::MixThread].Size() < 2)
+    return false;
+
+  // Walking the graph is only needed when it changed since the last partition
+  if (node != mPartitionedNode || mGraphVersion != mPartitionedGraphVersion)
+  {
+    mPartitionedGroupCount = PartitionInputs(node);
+    mPartitionedNode = node;
+    mPartitionedGraphVersion = mGraphVersion;
+  }
+
+  unsigned groupCount = mPartitionedGroupCount;
+  if (groupCount < 2)
+    return false;
+
+  ZoneScoped;
+
+  unsigned inputCount = node->mInputs[AudioThreads::MixThread].Size();
+  if (mInputBuffers.Size() < inputCount)
+    mInputBuffers.Resize(inputCount);
+  mInputHasOutput.Resize(inputCount);
+  for (unsigned i = 0; i < inputCount; ++i)
+    mInputBuffers[i].Resize(howManySamples);
+
+  mNode = node;
+  mChannels = numberOfChannels;
+  mListener = listener;
+  mGroupCount = (s32)groupCount;
+  AtomicStore(&mGroupsFinished, 0);
+  mEvaluatingGroupsThreaded = true;
+
+  // Opening the counter hands the groups to the workers
+  AtomicStore(&mNextGroup, 0);
+  unsigned threadsToWake = Math::Min(mThreadCount, groupCount - 1);
+  for (unsigned i = 0; i < threadsToWake; ++i)
+    mWorkSemaphore.Increment();
+
+  // The mix thread evaluates groups too, then waits on the ones still running
+  EvaluateGroupsThreaded();
+  mFinishedSemaphore.WaitAndDecrement();
+
+  AtomicStore(&mNextGroup, cNoGroupsToClaim);
+  mEvaluatingGroupsThreaded = false;
+
+  // Add the output together in input order
+  BufferType& inputSamples = node->mInputSamplesThreaded;
+  inputSamples.Resize(howManySamples);
+  *isThereInput = false;
+  for (unsigned i = 0; i < inputCount; ++i)
+  {
+    if (!mInputHasOutput[i])
+      continue;
+
+    if (!*isThereInput)
+    {
+      *isThereInput = true;
+      memcpy(inputSamples.Data(), mInputBuffers[i].Data(), sizeof(float) * howManySamples);
+    }
+    else
+      MixKernels::AddSamples(inputSamples.Data(), mInputBuffers[i].Data(), howManySamples);
+  }
+
+  return true;
+}
+
+unsigned MixWorkerPool::PartitionInputs(SoundNode* node)
+{
+  const SoundNode::NodeListType& inputs = node->mInputs[AudioThreads::MixThread];
+  unsigned inputCount = inputs.Size();
+
+  // Version 0 is what nodes start with
+  if (++mPartitionVersion == 0)
+    mPartitionVersion = 1;
+
+  mGroupParents.Resize(inputCount);
+  for (unsigned i = 0; i < inputCount; ++i)
+    mGroupParents[i] = i;
+
+  // Mark the node itself so loops back to it are found (Evaluate reports them)
+  node->mPartitionVersionThreaded = mPartitionVersion;
+  node->mPartitionInputThreaded = inputCount;
+
+  // Walk everything below each input. A node that was already reached from
+  // another input joins the two inputs' groups.
+  mSharedDataEntries.Clear();
+  for (unsigned i = 0; i < inputCount; ++i)
+  {
+    mNodeStack.Clear();
+    mNodeStack.PushBack(inputs[i]);
+    while (!mNodeStack.Empty())
+    {
+      SoundNode* current = mNodeStack.Back();
+      mNodeStack.PopBack();
+
+      if (current->mPartitionVersionThreaded == mPartitionVersion)
+      {
+        if (current->mPartitionInputThreaded == inputCount)
+          return 1;
+
+        JoinGroups(i, current->mPartitionInputThreaded);
+        continue;
+      }
+
+      current->mPartitionVersionThreaded = mPartitionVersion;
+      current->mPartitionInputThreaded = i;
+
+      mSharedData.Clear();
+      current->AddSharedDataThreaded(&mSharedData);
+      forRange (const void* data, mSharedData.All())
+        mSharedDataEntries.PushBack(SharedDataEntry(data, i));
+
+      forRange (SoundNode* input, current->mInputs[AudioThreads::MixThread].All())
+        mNodeStack.PushBack(input);
+    }
+  }
+
+  // Inputs reaching the same shared data are in the same group
+  Sort(mSharedDataEntries.All(), SharedDataEntryCompare);
+  for (unsigned i = 1; i < mSharedDataEntries.Size(); ++i)
+  {
+    if (mSharedDataEntries[i].mData == mSharedDataEntries[i - 1].mData)
+      JoinGroups(mSharedDataEntries[i].mInput, mSharedDataEntries[i - 1].mInput);
+  }
+
+  // Number the groups in order of their first input
+  unsigned groupCount = 0;
+  mRootGroups.Resize(inputCount);
+  for (unsigned i = 0; i < inputCount; ++i)
+  {
+    if (FindGroupRoot(i) == i)
+      mRootGroups[i] = groupCount++;
+  }
+
+  if (groupCount < 2)
+    return groupCount;
+
+  // Sort the inputs by group, keeping them in order within each group
+  mGroupStarts.Resize(groupCount + 1);
+  for (unsigned i = 0; i <= groupCount; ++i)
+    mGroupStarts[i] = 0;
+  for (unsigned i = 0; i < inputCount; ++i)
+    ++mGroupStarts[mRootGroups[FindGroupRoot(i)] + 1];
+  for (unsigned i = 1; i <= groupCount; ++i)
+    mGroupStarts[i] += mGroupStarts[i - 1];
+
+  // Each group's start is moved forward as its inputs are placed, which leaves
+  // it at the start of the next group
+  mGroupInputs.Resize(inputCount);
+  for (unsigned i = 0; i < inputCount; ++i)
+  {
+    unsigned group = mRootGroups[FindGroupRoot(i)];
+    mGroupInputs[mGroupStarts[group]++] = i;
+  }
+  for (unsigned i = groupCount; i > 0; --i)
+    mGroupStarts[i] = mGroupStarts[i - 1];
+  mGroupStarts[0] = 0;
+
+  return groupCount;
+}
+
+unsigned MixWorkerPool::FindGroupRoot(unsigned input)
+{
+  while (mGroupParents[input] != input)
+  {
+    mGroupParents[input] = mGroupParents[mGroupParents[input]];
+    input = mGroupParents[input];
+  }
+
+  return input;
+}
+
+void MixWorkerPool::JoinGroups(unsigned input1, unsigned input2)
+{
+  unsigned root1 = FindGroupRoot(input1);
+  unsigned root2 = FindGroupRoot(input2);
+
+  // The lower input stays the root so groups are numbered by their first input
+  if (root1 < root2)
+    mGroupParents[root2] = root1;
+  else if (root2 < root1)
+    mGroupParents[root1] = root2;
+}
+
+void MixWorkerPool::EvaluateGroupsThreaded()
+{
+  while (true)
+  {
+    // Claiming before reading anything else means a late worker sees the
+    // current evaluation's data
+    s32 group = AtomicFetchAdd(&mNextGroup, 1);
+    // Read before finishing the group, the next evaluation can't start until then
+    s32 groupCount = mGroupCount;
+    if (group >= groupCount)
+      return;
+
+    ZoneScoped;
+
+    const SoundNode::NodeListType& inputs = mNode->mInputs[AudioThreads::MixThread];
+    for (unsigned i = mGroupStarts[group]; i < mGroupStarts[group + 1]; ++i)
+    {
+      unsigned input = mGroupInputs[i];
+      mInputHasOutput[input] = inputs[input]->Evaluate(&mInputBuffers[input], mChannels, mListener);
+    }
+
+    if (AtomicPreIncrement(&mGroupsFinished) == groupCount)
+      mFinishedSemaphore.Increment();
+  }
+}
+
+OsInt MixWorkerPool::WorkerLoopThreaded()
+{
+  tracy::SetThreadName("Audio mix worker");
+
+  while (true)
+  {
+    mWorkSemaphore.WaitAndDecrement();
+    if (mShutDownSignal.Get() == cTrue)
+      break;
+
+    EvaluateGroupsThreaded();
+  }
+
+  return 0;
+}
+
+bool MixWorkerPool::SharedDataEntryCompare(const SharedDataEntry& lhs, const SharedDataEntry& rhs)
+{
+  return lhs.mData < rhs.mData;
+}
+
+} // namespace Plasma
@@ -0,0 +1,128 @@
+// MIT Licensed (see LICENSE.md).
+
+#pragma once
+
+namespace Plasma
+{
+
+class SoundNode;
+class ListenerNode;
+
+// Mix Worker Pool
+
+// Evaluates independent parts of the sound node graph on worker threads. The
+// first node in a mix that gathers several inputs splits them into groups
+// which share no nodes, assets or tags. The groups are claimed by the workers
+// and the mix thread through an atomic counter, and their output is added
+// together in input order so the result is the same as evaluating them one at
+// a time. The nodes below a group are never split again. The groups are kept
+// until the graph changes.
+class MixWorkerPool
+{
+public:
+  MixWorkerPool();
+
+  // Starts the worker threads
+  void Initialize();
+  // Stops the worker threads
+  void ShutDown();
+  // Returns the number of worker threads (not counting the mix thread)
+  unsigned GetThreadCount();
+  // Must be called when node inputs or the objects nodes share change, so the
+  // groups are found again on the next mix
+  void GraphChangedThreaded();
+  // If the node's inputs can be split into groups, evaluates them into the
+  // node's InputSamples buffer, sets whether any of them had output, and returns
+  // true. Returns false if the inputs should be evaluated on this thread.
+  bool AccumulateInputSamples(SoundNode* node,
+                              const unsigned howManySamples,
+                              const unsigned numberOfChannels,
+                              ListenerNode* listener,
+                              bool* isThereInput);
+
+  // The maximum number of worker threads
+  static const unsigned cMaxThreads = 3;
+
+private:
+  struct SharedDataEntry
+  {
+    SharedDataEntry()
+    {
+    }
+    SharedDataEntry(const void* data, unsigned input) : mData(data), mInput(input)
+    {
+    }
+
+    const void* mData;
+    unsigned mInput;
+  };
+
+  static bool SharedDataEntryCompare(const SharedDataEntry& lhs, const SharedDataEntry& rhs);
+  // Splits the node's inputs into groups and returns the number of groups. Will
+  // return 1 if they can't be split.
+  unsigned PartitionInputs(SoundNode* node);
+  // Returns the input at the root of the input's group
+  unsigned FindGroupRoot(unsigned input);
+  // Puts the two inputs in the same group
+  void JoinGroups(unsigned input1, unsigned input2);
+  // Evaluates groups until there are none left to claim
+  void EvaluateGroupsThreaded();
+  // The loop run by each worker thread
+  OsInt WorkerLoopThreaded();
+
+  // The worker threads
+  Thread mThreads[cMaxThreads];
+  // Number of worker threads that were started
+  unsigned mThreadCount;
+  // Incremented to wake a worker for each group that can run at the same time
+  Semaphore mWorkSemaphore;
+  // Incremented by whichever thread finishes the last group
+  Semaphore mFinishedSemaphore;
+  // Tells the worker threads to shut down
+  ThreadedInt mShutDownSignal;
+  // True while groups are being evaluated, so their nodes aren't split again
+  bool mEvaluatingGroupsThreaded;
+
+  // Used to mark the nodes reached while partitioning
+  unsigned mPartitionVersion;
+  // Incremented every time the graph changes
+  unsigned mGraphVersion;
+  // The node that was partitioned last, the graph version at the time, and the
+  // number of groups it was split into
+  SoundNode* mPartitionedNode;
+  unsigned mPartitionedGraphVersion;
+  unsigned mPartitionedGroupCount;
+  // Union-find parent of each input
+  Array<unsigned> mGroupParents;
+  // The group index of each input's root
+  Array<unsigned> mRootGroups;
+  // The inputs of each group, groups are in order of their first input
+  Array<unsigned> mGroupInputs;
+  // Where each group's inputs start in GroupInputs (with the end at the back)
+  Array<unsigned> mGroupStarts;
+  // Nodes still to be visited while partitioning
+  Array<SoundNode*> mNodeStack;
+  // The shared data of a single node
+  Array<const void*> mSharedData;
+  // The shared data of all nodes and the input they were reached from
+  Array<SharedDataEntry> mSharedDataEntries;
+
+  // The node whose inputs are being evaluated
+  SoundNode* mNode;
+  // The number of channels and the listener to evaluate the inputs with
+  unsigned mChannels;
+  ListenerNode* mListener;
+  // The output of each input (these keep their capacity between mixes)
+  Array<BufferType> mInputBuffers;
+  // Whether each input had output
+  Array<bool> mInputHasOutput;
+  // The number of groups being evaluated
+  s32 mGroupCount;
+  // The next group to claim. Set past any group count between evaluations so
+  // that a worker waking up late can't claim anything.
+  volatile s32 mNextGroup;
+  // The number of groups that are done
+  volatile s32 mGroupsFinished;
+};
+
+} // namespace Plasma
@@ -66,8 +66,8 @@ bool Resampler::GetNextFrame(float* output)
   const float* secondFrame(InputSamples + sampleIndex);
 
   // Interpolate between the two frames for each channel
-  for (unsigned i = 0; i < InputChannels; ++i)
-    output[i] = firstFrame[i] + ((secondFrame[i] - firstFrame[i]) * (float)(ResampleFrameIndex - frameIndex));
+  MixKernels::InterpolateFrame(
+      firstFrame, secondFrame, (float)(ResampleFrameIndex - frameIndex), output, InputChannels);
 
   // Advance the frame index
   ResampleFrameIndex += ResampleFactor;
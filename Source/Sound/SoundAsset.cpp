@@ -78,6 +78,7 @@ void DecompressedSoundAsset::AppendSamplesThreaded(BufferType* buffer,
 {
   // Translate from frames to sample location
   unsigned sampleIndex = frameIndex * mChannels;
+  mDecoder.UpdatePlaybackFrameThreaded(frameIndex);
 
   // Keep the original size of the buffer
   unsigned originalBufferSize = buffer->Size();
@@ -95,6 +96,10 @@ void DecompressedSoundAsset::AppendSamplesThreaded(BufferType* buffer,
   // If not, copy what we can and set the rest to plasma
   else
   {
+    // Only an underrun if the rest of the file hasn't been decoded yet
+    if (samplesAvailable < mSamples.Size())
+      mDecoder.RecordUnderrunThreaded();
+
     int samplesToCopy = (int)samplesAvailable - (int)sampleIndex;
 
     // Check if there are any samples to copy
@@ -240,6 +245,8 @@ void StreamingSoundAsset::AppendSamplesThreaded(BufferType* buffer,
     return;
   }
 
+  data->mDecoder.UpdatePlaybackFrameThreaded(frameIndex);
+
   // Translate from frames to sample location
   unsigned sampleIndex = frameIndex * mChannels;
   // Adjust the sample index to be within the current buffer
@@ -292,7 +299,11 @@ void StreamingSoundAsset::OnAddInstanceThreaded(unsigned instanceID)
     delete data;
   // Make sure the data object was created before adding it to the list
   else if (data)
+  {
     mDataPerInstanceList.PushBack(data);
+    // Start decoding right away so the first samples are ready sooner
+    data->mDecoder.DecodeNextSection();
+  }
 }
 
 void StreamingSoundAsset::OnRemoveInstanceThreaded(unsigned instanceID)
@@ -334,6 +345,11 @@ void StreamingSoundAsset::CopySamplesIntoBuffer(float* outputBuffer,
     // If there are no packets available, set the buffer to plasma and return
     if (!data->mDecodedPacketQueue.Read(packet))
     {
+      // Not counted until the first packet arrives or after the end of the file
+      unsigned samplesPlayed = data->mPreviousSamples + sampleIndex;
+      if (!data->mSamples.Empty() && samplesPlayed < mFrameCount * mChannels)
+        data->mDecoder.RecordUnderrunThreaded();
+
       // Trigger another decoded buffer
       data->mDecoder.DecodeNextSection();
 
@@ -712,7 +712,7 @@ bool SoundInstance::GetOutputForThisMixThreaded(BufferType* outputBuffer, const
 float SoundInstance::GetAttenuationThisMixThreaded()
 {
   float volume = 0.0f;
-  forRange (HandleOf<SoundNode> node, GetOutputs(AudioThreads::MixThread)->All())
+  forRange (SoundNode* node, GetOutputs(AudioThreads::MixThread)->All())
     volume += node->GetVolumeChangeFromOutputsThreaded();
 
   return volume;
@@ -742,6 +742,15 @@ bool SoundInstance::GetOutputSamples(BufferType* outputBuffer,
   return result;
 }
 
+void SoundInstance::AddSharedDataThreaded(Array<const void*>* sharedData)
+{
+  // Tags using this instance as their compressor input evaluate it directly
+  sharedData->PushBack(this);
+  sharedData->PushBack((SoundAsset*)mAssetObject);
+  forRange (TagObject* tag, TagListThreaded.All())
+    tag->AddSharedDataThreaded(sharedData);
+}
+
 void SoundInstance::AddSamplesToBufferThreaded(BufferType* buffer, unsigned outputFrames, unsigned outputChannels)
 {
   ZoneScoped;
@@ -768,7 +777,9 @@ void SoundInstance::AddSamplesToBufferThreaded(BufferType* buffer, unsigned outp
 
   unsigned inputChannels = mAssetObject->mChannels;
   unsigned inputFrames = outputFrames;
-  BufferType samples;
+  // The member buffers keep their capacity so this won't allocate every mix
+  BufferType& samples = mAssetSamplesThreaded;
+  samples.Clear();
 
   // If pitch shifting, determine number of asset frames we need
   if (mPitchShiftingThreaded)
@@ -841,8 +852,9 @@ void SoundInstance::AddSamplesToBufferThreaded(BufferType* buffer, unsigned outp
     // Save the interpolation state
     bool interpolating = Pitch.Interpolating();
 
-    // Pitch shifts the samples into a temporary buffer
-    BufferType pitchShiftedSamples(outputFrames * outputChannels);
+    // Pitch shifts the samples into the scratch buffer
+    BufferType& pitchShiftedSamples = mScratchSamplesThreaded;
+    pitchShiftedSamples.Resize(outputFrames * outputChannels);
     Pitch.ProcessBuffer(&samples, &pitchShiftedSamples);
 
     // Move the samples back into the original buffer
@@ -858,30 +870,39 @@ void SoundInstance::AddSamplesToBufferThreaded(BufferType* buffer, unsigned outp
   if (mInterpolatingVolumeThreaded || !IsWithinLimit(mVolume.Get(AudioThreads::MixThread), 1.0f, 0.01f))
   {
     float volume = mVolume.Get(AudioThreads::MixThread);
-    BufferRange sampleRange = samples.All();
-    while (!sampleRange.Empty())
+    unsigned frames = samples.Size() / outputChannels;
+
+    // If not interpolating, all samples get the same volume
+    if (!mInterpolatingVolumeThreaded)
+      MixKernels::ScaleSamples(samples.Data(), volume, samples.Size());
+    else
     {
-      // If interpolating volume, get new value
-      if (mInterpolatingVolumeThreaded)
+      mFrameVolumesThreaded.Resize(frames);
+      for (unsigned i = 0; i < frames; ++i)
       {
-        volume = VolumeInterpolatorThreaded.NextValue(), AudioThreads::MixThread;
+        // Once the interpolation is done the last value is used for the rest
+        // of the frames
+        if (mInterpolatingVolumeThreaded)
+        {
+          volume = VolumeInterpolatorThreaded.NextValue(), AudioThreads::MixThread;
 
-        mInterpolatingVolumeThreaded = !VolumeInterpolatorThreaded.Finished();
+          mInterpolatingVolumeThreaded = !VolumeInterpolatorThreaded.Finished();
 
-        if (!mInterpolatingVolumeThreaded)
-        {
-          mVolume.Set(volume, AudioThreads::MixThread);
+          if (!mInterpolatingVolumeThreaded)
+          {
+            mVolume.Set(volume, AudioThreads::MixThread);
 
-          PL::gSound->Mixer.AddTaskThreaded(CreateFunctor(&SoundInstance::DispatchEventFromMixThread,
-                                                         (SoundNode*)this,
-                                                         Events::AudioInterpolationDone),
-                                           this);
+            PL::gSound->Mixer.AddTaskThreaded(CreateFunctor(&SoundInstance::DispatchEventFromMixThread,
+                                                           (SoundNode*)this,
+                                                           Events::AudioInterpolationDone),
+                                             this);
+          }
         }
+
+        mFrameVolumesThreaded[i] = volume;
       }
 
-      // Adjust volume for all samples on this frame
-      for (unsigned j = 0; j < outputChannels; ++j, sampleRange.PopFront())
-        sampleRange.Front() *= volume;
+      MixKernels::ScaleFrames(samples.Data(), mFrameVolumesThreaded.Data(), frames, outputChannels);
     }
   }
 
@@ -951,8 +972,9 @@ void SoundInstance::TranslateChannelsThreaded(BufferType* inputSamples,
                                               const unsigned inputChannels,
                                               const unsigned outputChannels)
 {
-  // Temporary array for channel translation
-  BufferType adjustedSamples(inputFrames * outputChannels);
+  // Use the scratch array for channel translation
+  BufferType& adjustedSamples = mScratchSamplesThreaded;
+  adjustedSamples.Resize(inputFrames * outputChannels);
 
   // Step through each frame of audio data
   for (unsigned frame = 0, inputIndex = 0, outputIndex = 0; frame < inputFrames;
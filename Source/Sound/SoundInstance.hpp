@@ -252,16 +252,18 @@ private:
                         const unsigned numberOfChannels,
                         ListenerNode* listener,
                         const bool firstRequest) override;
+  // Adds the asset and tags, which are shared with other instances
+  void AddSharedDataThreaded(Array<const void*>* sharedData) override;
   // Fills the provided buffer with the audio data for the current mix
   void AddSamplesToBufferThreaded(BufferType* buffer, unsigned outputFrames, unsigned outputChannels);
   // Resets back to the loop start point
   void LoopThreaded();
   // Translates the audio data in the array to the specified output channels,
   // and puts the data back into the array
-  static void TranslateChannelsThreaded(BufferType* inputSamples,
-                                        const unsigned inputFrames,
-                                        const unsigned inputChannels,
-                                        const unsigned outputChannels);
+  void TranslateChannelsThreaded(BufferType* inputSamples,
+                                 const unsigned inputFrames,
+                                 const unsigned inputChannels,
+                                 const unsigned outputChannels);
   // Sends notification and removes instance from any associated tags.
   void FinishedCleanUpThreaded();
   // Check for whether the total volume is lower than the minimum.
@@ -362,6 +364,10 @@ private:
   unsigned mSavedOutputVersionThreaded;
   // Processed samples that are saved between mixes
   BufferType SavedSamplesThreaded;
+  // Samples read from the asset for the current mix
+  BufferType mAssetSamplesThreaded;
+  // Used when translating channels or pitch shifting the asset samples
+  BufferType mScratchSamplesThreaded;
 };
 
 } // namespace Plasma
@@ -55,7 +55,9 @@ SoundNode::SoundNode(StringParam name, int ID, bool listenerDependent, bool gene
     mValidOutputLastMix(false),
     mListenerDependentThreaded(listenerDependent),
     mBypassValue(0.0f),
-    mGeneratorThreaded(generator)
+    mGeneratorThreaded(generator),
+    mPartitionVersionThreaded(0),
+    mPartitionInputThreaded(0)
 {
   ConnectThisTo(&(PL::gSound->Mixer), Events::SoundListenerRemoved, RemoveListenerThreaded);
 }
@@ -486,35 +488,36 @@ bool SoundNode::AccumulateInputSamples(const unsigned howManySamples,
   if (mInputs[AudioThreads::MixThread].Empty())
     return false;
 
-  BufferType tempBuffer(howManySamples);
+  // If the inputs can be split into independent groups, evaluate them on the
+  // mix worker threads
   bool isThereInput(false);
+  if (PL::gSound->Mixer.MixWorkers.AccumulateInputSamples(
+          this, howManySamples, numberOfChannels, listener, &isThereInput))
+    return isThereInput;
 
-  // Reset buffer
+  // Both buffers keep their capacity between mixes, so these won't allocate
+  // once the mix size is stable
+  mInputScratchThreaded.Resize(howManySamples);
   mInputSamplesThreaded.Resize(howManySamples);
 
   // Get samples from all inputs
   forRange (SoundNode* input, mInputs[AudioThreads::MixThread].All())
   {
     // Check if this input has actual output data
-    if (input->Evaluate(&tempBuffer, numberOfChannels, listener))
+    if (input->Evaluate(&mInputScratchThreaded, numberOfChannels, listener))
     {
-      ErrorIf(tempBuffer[0] > 10.0f || tempBuffer[0] < -10.0f, "Audio data is outside of normal limits");
+      ErrorIf(mInputScratchThreaded[0] > 10.0f || mInputScratchThreaded[0] < -10.0f,
+              "Audio data is outside of normal limits");
 
       // If this is the first input data, just swap the buffers
       if (!isThereInput)
       {
         isThereInput = true;
-        mInputSamplesThreaded.Swap(tempBuffer);
+        mInputSamplesThreaded.Swap(mInputScratchThreaded);
       }
       // Otherwise add the new samples to the existing ones
       else
-      {
-        for (BufferRange myData = mInputSamplesThreaded.All(), newData = tempBuffer.All(); !myData.Empty();
-             myData.PopFront(), newData.PopFront())
-        {
-          myData.Front() += newData.Front();
-        }
-      }
+        MixKernels::AddSamples(mInputSamplesThreaded.Data(), mInputScratchThreaded.Data(), howManySamples);
     }
   }
 
@@ -527,13 +530,7 @@ void SoundNode::AddBypassThreaded(BufferType* outputBuffer)
   // with a percentage of the input buffer
   float bypassValue = mBypassValue.Get(AudioThreads::MixThread);
   if (bypassValue > 0.0f)
-  {
-    for (BufferRange outputRange = outputBuffer->All(), inputRange = mInputSamplesThreaded.All(); !outputRange.Empty();
-         outputRange.PopFront(), inputRange.PopFront())
-    {
-      outputRange.Front() = (inputRange.Front() * bypassValue) + (outputRange.Front() * (1.0f - bypassValue));
-    }
-  }
+    MixKernels::BlendSamples(outputBuffer->Data(), mInputSamplesThreaded.Data(), bypassValue, outputBuffer->Size());
 }
 
 void SoundNode::AddInputNodeThreaded(HandleOf<SoundNode> newNode)
@@ -544,6 +541,8 @@ void SoundNode::AddInputNodeThreaded(HandleOf<SoundNode> newNode)
   mInputs[AudioThreads::MixThread].PushBack(newNode);
   // Add this node to the new node's outputs
   newNode->mOutputs[AudioThreads::MixThread].PushBack(this);
+
+  PL::gSound->Mixer.MixWorkers.GraphChangedThreaded();
 }
 
 void SoundNode::RemoveInputNodeThreaded(HandleOf<SoundNode> node)
@@ -555,6 +554,8 @@ void SoundNode::RemoveInputNodeThreaded(HandleOf<SoundNode> node)
 
   // Remove this node from the input node's output list
   node->mOutputs[AudioThreads::MixThread].EraseValue(HandleOf<SoundNode>(this));
+
+  PL::gSound->Mixer.MixWorkers.GraphChangedThreaded();
 }
 
 // Simple Collapse Node
@@ -687,16 +688,10 @@ bool CombineAndPauseNode::GetOutputSamples(BufferType* outputBuffer,
     if (mInterpolatingThreaded)
     {
       // Apply volume adjustment
-      float volume;
-      BufferRange inputRange = mInputSamplesThreaded.All();
-      for (unsigned i = 0; i < outputBuffer->Size(); i += numberOfChannels)
-      {
-        volume = VolumeInterpolator.NextValue();
-
-        // Apply the volume multiplier to all samples
-        for (unsigned j = 0; j < numberOfChannels; ++j, inputRange.PopFront())
-          inputRange.Front() *= volume;
-      }
+      unsigned frames = outputBuffer->Size() / numberOfChannels;
+      mFrameVolumesThreaded.Resize(frames);
+      VolumeInterpolator.NextValues(mFrameVolumesThreaded.Data(), frames);
+      MixKernels::ScaleFrames(mInputSamplesThreaded.Data(), mFrameVolumesThreaded.Data(), frames, numberOfChannels);
 
       // Check if we're done interpolating
       if (VolumeInterpolator.Finished())
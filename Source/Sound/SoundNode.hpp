@@ -80,6 +80,8 @@ public:
   const String cName;
   // A buffer to hold the output of all input nodes
   BufferType mInputSamplesThreaded;
+  // A buffer for nodes to store a volume per frame when interpolating
+  BufferType mFrameVolumesThreaded;
 
   typedef Array<HandleOf<SoundNode>> NodeListType;
 
@@ -113,6 +115,8 @@ public:
   void RemoveInputNodeThreaded(HandleOf<SoundNode> node);
 
 private:
+  friend class MixWorkerPool;
+
   // If false, this node's output should not be saved into the MixedOutput
   // buffer
   bool mOkayToSaveThreaded;
@@ -126,6 +130,9 @@ private:
   unsigned mMixedVersionThreaded;
   // Saved output for a mix version
   BufferType mMixedOutputThreaded;
+  // The buffer each input node is evaluated into before being added to the
+  // InputSamples buffer
+  BufferType mInputScratchThreaded;
   // Number of channels in the mixed output
   unsigned mNumMixedChannelsThreaded;
   // The listener used for the mixed output
@@ -140,12 +147,21 @@ private:
   Threaded<float> mBypassValue;
   // If true, this is a node which generates audio
   bool mGeneratorThreaded;
+  // The last partition of the MixWorkerPool that reached this node, and the
+  // index of the input it was reached from
+  unsigned mPartitionVersionThreaded;
+  unsigned mPartitionInputThreaded;
 
   // Must be implemented to provide the output of this sound node
   virtual bool GetOutputSamples(BufferType* outputBuffer,
                                 const unsigned numberOfChannels,
                                 ListenerNode* listener,
                                 const bool firstRequest) = 0;
+  // Adds any objects outside of the node graph that getting this node's output
+  // modifies, so that nodes sharing them are not evaluated at the same time
+  virtual void AddSharedDataThreaded(Array<const void*>* sharedData)
+  {
+  }
   // Called on the non-threaded node when the last input is removed
   virtual void CollapseNode()
   {
@@ -37,6 +37,7 @@ public:
 #include "RingBuffer.hpp"
 #include "LockFreeQueue.hpp"
 #include "Interpolator.hpp"
+#include "MixKernels.hpp"
 #include "AudioIOInterface.hpp"
 #include "Filters.hpp"
 #include "Resampler.hpp"
@@ -47,6 +48,7 @@ public:
 #include "SoundAsset.hpp"
 #include "SoundNode.hpp"
 #include "SoundTag.hpp"
+#include "MixWorkerPool.hpp"
 #include "AudioMixer.hpp"
 #include "AttenuatorNode.hpp"
 #include "EmitterNode.hpp"
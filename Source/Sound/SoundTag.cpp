@@ -52,6 +52,7 @@ void TagObject::AddInstanceThreaded(SoundInstance* instance)
   // Add a new data object to the map
   InstanceData* data = new InstanceData();
   DataPerInstanceThreaded[instance] = data;
+  PL::gSound->Mixer.MixWorkers.GraphChangedThreaded();
 
   // If modifying volume, create the modifier
   if (mModifyingVolumeThreaded)
@@ -67,6 +68,8 @@ void TagObject::AddInstanceThreaded(SoundInstance* instance)
 
 void TagObject::RemoveInstanceThreaded(SoundInstance* instance)
 {
+  PL::gSound->Mixer.MixWorkers.GraphChangedThreaded();
+
   // Find this instance's data in the map
   InstanceData* data = DataPerInstanceThreaded.FindValue(instance, nullptr);
   if (data)
@@ -217,8 +220,9 @@ void TagObject::ProcessInstanceThreaded(BufferType* instanceOutput, unsigned cha
     if (!data->mEqualizer)
       data->mEqualizer = new Equalizer(mEqualizerGainValuesThreaded);
 
-    // Create a temporary buffer for the equalizer output
-    BufferType processedOutput(instanceOutput->Size());
+    // Use the scratch buffer for the equalizer output
+    BufferType& processedOutput = mScratchThreaded;
+    processedOutput.Resize(instanceOutput->Size());
 
     // Apply the filter to all samples
     data->mEqualizer->ProcessBuffer(instanceOutput->Data(), processedOutput.Data(), channels, instanceOutput->Size());
@@ -231,16 +235,16 @@ void TagObject::ProcessInstanceThreaded(BufferType* instanceOutput, unsigned cha
   if (mUseCompressor.Get(AudioThreads::MixThread) && !mCompressorVolumesThreaded.Empty())
   {
     // Apply the corresponding compressor volume to each sample
-    int i = 0;
-    forRange (float& sample, instanceOutput->All())
-      sample *= mCompressorVolumesThreaded[i++];
+    MixKernels::MultiplySamples(
+        instanceOutput->Data(), mCompressorVolumesThreaded.Data(), instanceOutput->Size());
   }
 }
 
 BufferType* TagObject::GetTotalInstanceOutputThreaded(unsigned howManyFrames, unsigned channels)
 {
-  // Create a temporary buffer to get output from each instance
-  BufferType instanceBuffer(howManyFrames * channels);
+  // Use the scratch buffer to get output from each instance
+  BufferType& instanceBuffer = mScratchThreaded;
+  instanceBuffer.Resize(howManyFrames * channels);
   // Resize the total output buffer
   mTotalInstanceOutputThreaded.Resize(howManyFrames * channels);
   // Set all samples to plasma
@@ -261,14 +265,39 @@ BufferType* TagObject::GetTotalInstanceOutputThreaded(unsigned howManyFrames, un
 
       // Add the instance output into the total output, adjusting with tag
       // volume and attenuated instance volume
-      for (unsigned i = 0; i < limit; ++i)
-        mTotalInstanceOutputThreaded[i] += instanceBuffer[i] * attenuatedVolume * mVolume.Get(AudioThreads::MixThread);
+      MixKernels::AddScaledSamples(mTotalInstanceOutputThreaded.Data(),
+                                   instanceBuffer.Data(),
+                                   attenuatedVolume * mVolume.Get(AudioThreads::MixThread),
+                                   limit);
     }
   }
 
   return &mTotalInstanceOutputThreaded;
 }
 
+void TagObject::AddSharedDataThreaded(Array<const void*>* sharedData)
+{
+  sharedData->PushBack(this);
+
+  // The compressor gets the output of every instance of its input tag
+  TagObject* inputTag = mCompressorInputTag.Get(AudioThreads::MixThread);
+  if (inputTag && inputTag != this)
+  {
+    sharedData->PushBack(inputTag);
+    forRange (InstanceDataMapType::pair mapPair, inputTag->DataPerInstanceThreaded.All())
+      sharedData->PushBack(mapPair.first);
+  }
+}
+
+void TagObject::SetCompressorInputTag(TagObject* tag)
+{
+  mCompressorInputTag.Set(tag, AudioThreads::MainThread);
+
+  // Tasks run in order, so the mix thread has the new tag by the time this runs
+  MixWorkerPool* mixWorkers = &PL::gSound->Mixer.MixWorkers;
+  PL::gSound->Mixer.AddTask(CreateFunctor(&MixWorkerPool::GraphChangedThreaded, mixWorkers), nullptr);
+}
+
 void TagObject::UpdateForMixThreaded(unsigned howManyFrames, unsigned channels)
 {
   if (mMixVersionThreaded == PL::gSound->Mixer.mMixVersionThreaded)
@@ -736,9 +765,9 @@ void SoundTag::SetTagForDucking(SoundTag* tag)
   if (mTagObject)
   {
     if (tag)
-      mTagObject->mCompressorInputTag.Set(tag->mTagObject, AudioThreads::MainThread);
+      mTagObject->SetCompressorInputTag(tag->mTagObject);
     else
-      mTagObject->mCompressorInputTag.Set(nullptr, AudioThreads::MainThread);
+      mTagObject->SetCompressorInputTag(nullptr);
   }
 }
 
@@ -65,6 +65,11 @@ public:
   // Accumulates audio output from all tagged sound instances into the
   // mTotalInstanceOutput buffer
   BufferType* GetTotalInstanceOutputThreaded(unsigned howManyFrames, unsigned channels);
+  // Adds this tag and everything processing an instance with it evaluates (the
+  // compressor input tag and its instances) to the shared data of the instance
+  void AddSharedDataThreaded(Array<const void*>* sharedData);
+  // Sets the tag whose audio will be used for the compressor input
+  void SetCompressorInputTag(TagObject* tag);
 
   // The maximum number of instances that can be played with this tag
   int mInstanceLimit;
@@ -86,6 +91,8 @@ private:
   unsigned mMixVersionThreaded;
   // Used to hold the total audio output of all associated sound instances
   BufferType mTotalInstanceOutputThreaded;
+  // Holds each instance's output or the equalizer output while processing
+  BufferType mScratchThreaded;
   // Current volume adjustment
   Threaded<float> mVolume;
   // If true, volume adjustment should be applied to tagged instances